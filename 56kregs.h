@@ -0,0 +1,145 @@
+#ifdef DEF_REG56
+/*
+ *  Keyword definitions
+ */
+#define	REG56_A	270
+#define	REG56_A0	136
+#define	REG56_A1	137
+#define	REG56_A10	312
+#define	REG56_A2	138
+#define	REG56_AB	318
+#define	REG56_B	271
+#define	REG56_B0	265
+#define	REG56_B1	269
+#define	REG56_B10	313
+#define	REG56_B2	267
+#define	REG56_BA	319
+#define	REG56_CCR	147
+#define	REG56_L	302
+#define	REG56_LA	306
+#define	REG56_LC	307
+#define	REG56_M0	288
+#define	REG56_M1	289
+#define	REG56_M2	290
+#define	REG56_M3	291
+#define	REG56_M4	292
+#define	REG56_M5	293
+#define	REG56_M6	294
+#define	REG56_M7	295
+#define	REG56_MR	304
+#define	REG56_N0	280
+#define	REG56_N1	281
+#define	REG56_N2	282
+#define	REG56_N3	283
+#define	REG56_N4	284
+#define	REG56_N5	285
+#define	REG56_N6	286
+#define	REG56_N7	287
+#define	REG56_OMR	305
+#define	REG56_P	303
+#define	REG56_PC	145
+#define	REG56_R0	151
+#define	REG56_R1	152
+#define	REG56_R2	153
+#define	REG56_R3	154
+#define	REG56_R4	155
+#define	REG56_R5	156
+#define	REG56_R6	157
+#define	REG56_R7	158
+#define	REG56_SP	143
+#define	REG56_SR	146
+#define	REG56_SS	310
+#define	REG56_SSH	308
+#define	REG56_SSL	309
+#define	REG56_X	314
+#define	REG56_X0	260
+#define	REG56_X1	261
+#define	REG56_Y	315
+#define	REG56_Y0	262
+#define	REG56_Y1	263
+#endif
+
+#ifdef DECL_REG56
+/*
+ *  keyword state-machine tables
+ *
+ */
+
+int reg56base[18] = {
+ 0, 2, 5, 2, 6, 8, 16, 4,
+ 5, 24, 4, 0, 32, 34, 35, 3,
+ 9, 20
+};
+
+int reg56tab[163] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -2, -2, -2, 13, -2, -2, 14, -2,
+ -2, -2, -2, -2, -2, -2, -2, -2,
+ -2, -2, -2, -2, -2, -2, -2, -2,
+ -2, -2, -2, -2, -2, -2, -2, -2,
+ -2, -2, -2, -2, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 1, 2, 3, -2, 15, -2, -2,
+ -2, -2, -1, -1, 4, 5, 6, 7,
+ 8, 16, 9, 10, -2, -2, -2, 17,
+ 11, 12, -2, -2, -2, -1, -1, -1,
+ -2, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1
+};
+
+int reg56check[163] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ 11, 11, 1, 1, 1, 2, 2, 2,
+ 5, 5, 5, 5, 5, 5, 5, 5,
+ 6, 6, 6, 6, 6, 6, 6, 6,
+ 9, 9, 9, 9, 9, 9, 9, 9,
+ 12, 12, 13, 14, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 0, 0, 0, 1, 3, 2, 4,
+ 8, 4, -1, -1, 0, 0, 0, 0,
+ 0, 7, 0, 0, 10, 15, 10, 10,
+ 0, 0, 5, 16, 17, -1, -1, -1,
+ 17, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1
+};
+
+int reg56accept[163] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ 260, 261, 136, 137, 138, 265, 269, 267,
+ 288, 289, 290, 291, 292, 293, 294, 295,
+ 280, 281, 282, 283, 284, 285, 286, 287,
+ 151, 152, 153, 154, 155, 156, 157, 158,
+ 262, 263, 312, 313, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 270, 271, -1, 318, -1, 319, 306,
+ 145, 307, -1, -1, 302, -1, -1, -1,
+ 303, -1, -1, -1, 143, 147, 146, 310,
+ 314, 315, 304, 305, 308, -1, -1, -1,
+ 309, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1
+};
+#endif
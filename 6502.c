@@ -15,6 +15,7 @@
 #include "expr.h"
 #include "error.h"
 #include "mach.h"
+#include "object.h"
 #include "procln.h"
 #include "riscasm.h"
 #include "rmac.h"
@@ -28,12 +29,12 @@
 #define	UPSEG_SIZE	0x10010L // size of 6502 code buffer, 64K+16bytes
 
 // Internal vars
-static uint16_t orgmap[1024][2];		// Mark all 6502 org changes
+static ASMCTX uint16_t orgmap[1024][2];		// Mark all 6502 org changes
 
 // Exported vars
 const char in_6502mode[] = "directive illegal in .6502 section";
-uint16_t * currentorg = &orgmap[0][0];	// Current org range
-char strtoa8[128];	// ASCII to Atari 800 internal conversion table
+ASMCTX uint16_t * currentorg;	// Current org range
+ASMCTX char strtoa8[128];	// ASCII to Atari 800 internal conversion table
 
 //
 // 6502 addressing modes;
@@ -134,8 +135,8 @@ static char imodes[] =
 	A65_IMPL, 0x98, END65
 };
 
-static char ops[NMACHOPS][NMODES];			// Opcodes
-static unsigned char inf[NMACHOPS][NMODES];	// Construction info
+static ASMCTX char ops[NMACHOPS][NMODES];			// Opcodes
+static ASMCTX unsigned char inf[NMACHOPS][NMODES];	// Construction info
 
 // Absolute-to-zeropage translation table
 static int abs2zp[] =
@@ -210,6 +211,7 @@ void Init6502()
 	}
 
 	// Set up first org section (set to zero)
+	currentorg = &orgmap[0][0];
 	orgmap[0][0] = 0;
 
 	SwitchSection(M6502);	// Switch to 6502 section
@@ -555,7 +557,7 @@ void m6502obj(int ofd)
 
 	// Write out mandatory $FFFF header
 	header[0] = header[1] = 0xFF;
-	uint32_t unused = write(ofd, header, 2);
+	WriteImage(ofd, header, 2);
 
 	for(uint16_t * l=&orgmap[0][0]; l<currentorg; l+=2)
 	{
@@ -563,9 +565,9 @@ void m6502obj(int ofd)
 		SETLE16(header, 2, l[1] - 1);
 
 		// Write header for segment
-		unused = write(ofd, header, 4);
+		WriteImage(ofd, header, 4);
 		// Write the segment data
-		unused = write(ofd, p + l[0], l[1] - l[0]);
+		WriteImage(ofd, p + l[0], l[1] - l[0]);
 	}
 }
 
@@ -11,8 +11,8 @@
 
 // Exported variables
 extern const char in_6502mode[];
-extern uint16_t * currentorg;	// Current org range
-extern char strtoa8[];
+extern ASMCTX uint16_t * currentorg;	// Current org range
+extern ASMCTX char strtoa8[];
 
 // Exported functions
 extern void Init6502();
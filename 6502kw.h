@@ -0,0 +1,534 @@
+#ifdef DEF_MP
+/*
+ *  Keyword definitions
+ */
+#define	MP__56001	64
+#define	MP__6502	2
+#define	MP__68000	3
+#define	MP__68020	58
+#define	MP__68030	59
+#define	MP__68040	60
+#define	MP__68060	61
+#define	MP__68881	62
+#define	MP__68882	63
+#define	MP__ABS	7
+#define	MP__ALIGN	69
+#define	MP__ASSERT	28
+#define	MP__BSS	4
+#define	MP__CARGS	10
+#define	MP__CCUNDEF	51
+#define	MP__COMM	8
+#define	MP__CSTRUCT	53
+#define	MP__DATA	5
+#define	MP__DC	12
+#define	MP__DCB	17
+#define	MP__DISABLE	22
+#define	MP__DPHRASE	42
+#define	MP__DS	13
+#define	MP__DSM	68
+#define	MP__DSP	16
+#define	MP__DUMP	20
+#define	MP__EJECT	46
+#define	MP__ELSE	501
+#define	MP__ENABLE	23
+#define	MP__END	34
+#define	MP__ENDC	502
+#define	MP__ENDIF	502
+#define	MP__ENDM	505
+#define	MP__ENDR	507
+#define	MP__EQU	18
+#define	MP__EQURUNDEF	50
+#define	MP__ERROR	47
+#define	MP__EVEN	1
+#define	MP__EXITM	510
+#define	MP__EXTERN	24
+#define	MP__GLOBL	24
+#define	MP__GOTO	11
+#define	MP__GPU	15
+#define	MP__GPUMAIN	56
+#define	MP__IF	500
+#define	MP__IIF	503
+#define	MP__INCBIN	21
+#define	MP__INCLUDE	33
+#define	MP__INIT	9
+#define	MP__JPAD	54
+#define	MP__LIST	38
+#define	MP__LONG	40
+#define	MP__MACRO	504
+#define	MP__MACUNDEF	14
+#define	MP__NLIST	39
+#define	MP__NOCLEAR	49
+#define	MP__NOFPU	65
+#define	MP__NOJPAD	55
+#define	MP__NOLIST	39
+#define	MP__OBJPROC	67
+#define	MP__OFFSET	7
+#define	MP__OPT	66
+#define	MP__ORG	0
+#define	MP__PHRASE	41
+#define	MP__PRGFLAGS	57
+#define	MP__PRINT	52
+#define	MP__QPHRASE	43
+#define	MP__REGBANK0	25
+#define	MP__REGBANK1	26
+#define	MP__REGUNDEF	50
+#define	MP__REPT	506
+#define	MP__SUBTTL	45
+#define	MP__TABLE	70
+#define	MP__TEXT	6
+#define	MP__TITLE	44
+#define	MP__UNDEFMAC	14
+#define	MP__WARN	48
+#define	MP_ADC	2000
+#define	MP_AND	2001
+#define	MP_ASL	2002
+#define	MP_ASSERT	28
+#define	MP_BCC	2003
+#define	MP_BCS	2004
+#define	MP_BEQ	2005
+#define	MP_BIT	2011
+#define	MP_BMI	2007
+#define	MP_BNE	2006
+#define	MP_BPL	2008
+#define	MP_BRK	2012
+#define	MP_BSS	4
+#define	MP_BVC	2009
+#define	MP_BVS	2010
+#define	MP_CARGS	10
+#define	MP_CCUNDEF	51
+#define	MP_CLC	2013
+#define	MP_CLD	2014
+#define	MP_CLI	2015
+#define	MP_CLV	2016
+#define	MP_CMP	2017
+#define	MP_COMM	8
+#define	MP_CPX	2018
+#define	MP_CPY	2019
+#define	MP_CSTRUCT	53
+#define	MP_DATA	5
+#define	MP_DC	12
+#define	MP_DCB	17
+#define	MP_DEC	2020
+#define	MP_DEX	2021
+#define	MP_DEY	2022
+#define	MP_DISABLE	22
+#define	MP_DPHRASE	42
+#define	MP_DS	13
+#define	MP_DSM	68
+#define	MP_DUMP	20
+#define	MP_EJECT	46
+#define	MP_ELSE	501
+#define	MP_ENABLE	23
+#define	MP_END	34
+#define	MP_ENDC	502
+#define	MP_ENDIF	502
+#define	MP_ENDM	505
+#define	MP_ENDR	507
+#define	MP_EOR	2023
+#define	MP_EQU	18
+#define	MP_EQURUNDEF	50
+#define	MP_ERROR	47
+#define	MP_EVEN	1
+#define	MP_EXITM	510
+#define	MP_EXTERN	24
+#define	MP_GLOBL	24
+#define	MP_GOTO	11
+#define	MP_GPUMAIN	56
+#define	MP_IF	500
+#define	MP_IIF	503
+#define	MP_INC	2024
+#define	MP_INCBIN	21
+#define	MP_INCLUDE	33
+#define	MP_INIT	9
+#define	MP_INX	2025
+#define	MP_INY	2026
+#define	MP_JMP	2027
+#define	MP_JPAD	54
+#define	MP_JSR	2028
+#define	MP_LDA	2029
+#define	MP_LDX	2030
+#define	MP_LDY	2031
+#define	MP_LIST	38
+#define	MP_LONG	40
+#define	MP_LSR	2032
+#define	MP_MACRO	504
+#define	MP_MACUNDEF	14
+#define	MP_NLIST	39
+#define	MP_NOCLEAR	49
+#define	MP_NOFPU	65
+#define	MP_NOJPAD	55
+#define	MP_NOLIST	39
+#define	MP_NOP	2033
+#define	MP_OFFSET	7
+#define	MP_OPT	66
+#define	MP_ORA	2034
+#define	MP_ORG	0
+#define	MP_PHA	2035
+#define	MP_PHP	2036
+#define	MP_PHRASE	41
+#define	MP_PLA	2037
+#define	MP_PLP	2038
+#define	MP_PRGFLAGS	57
+#define	MP_PRINT	52
+#define	MP_QPHRASE	43
+#define	MP_REGUNDEF	50
+#define	MP_REPT	506
+#define	MP_ROL	2039
+#define	MP_ROR	2040
+#define	MP_RTI	2041
+#define	MP_RTS	2042
+#define	MP_SBC	2043
+#define	MP_SEC	2044
+#define	MP_SED	2045
+#define	MP_SEI	2046
+#define	MP_STA	2047
+#define	MP_STX	2048
+#define	MP_STY	2049
+#define	MP_SUBTTL	45
+#define	MP_TAX	2050
+#define	MP_TAY	2051
+#define	MP_TEXT	6
+#define	MP_TITLE	44
+#define	MP_TSX	2052
+#define	MP_TXA	2053
+#define	MP_TXS	2054
+#define	MP_TYA	2055
+#define	MP_UNDEFMAC	14
+#define	MP_WARN	48
+#endif
+
+#ifdef DECL_MP
+/*
+ *  keyword state-machine tables
+ *
+ */
+
+int mpbase[421] = {
+ 0, 23, 41, 45, 65, 70, 78, 37,
+ 56, 85, 90, 5, 19, 97, 39, 6,
+ 67, 105, 111, 15, 7, 0, 0, 109,
+ 37, 126, 130, 130, 102, 144, 53, 123,
+ 10, 107, 153, 116, 58, 71, 62, 155,
+ 71, 96, 103, 104, 149, 154, 106, 117,
+ 134, 157, 151, 154, 147, 164, 152, 151,
+ 171, 160, 164, 154, 161, 162, 182, 182,
+ 167, 179, 175, 176, 185, 172, 191, 176,
+ 175, 179, 193, 190, 185, 181, 181, 197,
+ 202, 188, 207, 191, 211, 194, 200, 197,
+ 213, 208, 218, 212, 199, 222, 221, 224,
+ 224, 212, 225, 226, 233, 240, 242, 246,
+ 246, 225, 229, 234, 231, 255, 256, 254,
+ 241, 0, 1, 2, 241, 252, 243, 244,
+ 246, 244, 253, 247, 248, 267, 253, 265,
+ 262, 263, 272, 260, 279, 260, 264, 279,
+ 276, 271, 267, 267, 283, 288, 289, 273,
+ 279, 291, 286, 295, 289, 294, 282, 296,
+ 286, 299, 301, 303, 309, 310, 289, 294,
+ 311, 298, 312, 311, 306, 308, 304, 322,
+ 323, 307, 310, 324, 323, 327, 327, 313,
+ 317, 319, 314, 330, 335, 323, 326, 339,
+ 322, 339, 324, 339, 329, 329, 337, 336,
+ 337, 345, 336, 355, 351, 344, 341, 339,
+ 341, 342, 343, 352, 360, 352, 3, 2,
+ 9, 6, 360, 363, 362, 356, 358, 354,
+ 372, 373, 357, 360, 374, 373, 377, 377,
+ 363, 367, 369, 364, 380, 385, 373, 376,
+ 389, 372, 389, 374, 389, 379, 379, 387,
+ 386, 387, 395, 389, 387, 406, 402, 395,
+ 392, 409, 392, 393, 402, 395, 404, 412,
+ 404, 401, 401, 417, 401, 421, 423, 405,
+ 414, 421, 407, 411, 418, 414, 421, 433,
+ 426, 415, 422, 424, 419, 435, 420, 441,
+ 424, 439, 426, 434, 427, 447, 435, 430,
+ 446, 446, 6, 16, 17, 18, 19, 20,
+ 20, 439, 436, 436, 452, 436, 456, 458,
+ 440, 449, 456, 442, 446, 452, 448, 455,
+ 467, 460, 449, 456, 458, 453, 469, 454,
+ 475, 458, 460, 474, 461, 469, 462, 482,
+ 483, 471, 466, 482, 483, 483, 470, 486,
+ 489, 481, 475, 490, 482, 483, 489, 485,
+ 496, 497, 501, 499, 484, 485, 501, 506,
+ 489, 505, 498, 498, 492, 508, 511, 503,
+ 497, 512, 504, 505, 511, 507, 518, 519,
+ 523, 521, 506, 512, 508, 524, 529, 512,
+ 518, 529, 522, 522, 530, 517, 533, 534,
+ 536, 527, 537, 538, 526, 538, 541, 542,
+ 547, 543, 530, 546, 547, 549, 540, 550,
+ 551, 539, 555, 552, 555, 550, 557, 562,
+ 559, 559, 547, 561, 565, 564, 564, 552,
+ 23, 566, 570, 568, 569
+};
+
+int mptab[698] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, 1, -1,
+ 206, 207, 208, 290, -2, 114, 113, -2,
+ 115, 291, 209, 292, 293, 294, 296, 295,
+ -2, -2, -2, -2, -2, -2, -2, -2,
+ -2, -1, -1, -1, 21, 22, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 2, 3, 4, 5, 6, 88, 7,
+ 112, 8, 9, 145, 10, 11, 12, 13,
+ 14, 15, 16, 17, 18, 19, 97, 20,
+ 23, 24, 25, 26, 27, 111, 28, 89,
+ 29, 30, 90, 31, 32, 33, 34, 35,
+ 36, 37, 38, 39, 40, 42, 41, 94,
+ 45, 76, 46, 95, 77, 78, 47, 43,
+ 119, 96, 48, 49, 44, 50, -2, 51,
+ 52, 79, 54, 53, 55, 142, 80, 61,
+ 98, 62, 154, 63, 155, 56, 57, 64,
+ 58, 59, 99, 156, 60, 160, 65, 100,
+ 68, 66, 69, 67, 70, 71, 84, 72,
+ 73, 161, 81, 85, 74, 82, 75, 91,
+ 83, 86, -2, 101, -2, 87, 102, 116,
+ 105, 92, 137, 93, 106, 138, 139, 146,
+ 107, 117, 147, -2, 152, 103, 104, 120,
+ 118, 121, 108, 124, 143, 125, 153, 109,
+ 110, -2, 144, 126, 130, 122, 131, -2,
+ 132, 123, 127, 133, 134, 128, -2, 129,
+ 135, 140, 136, 148, 157, -2, 141, 149,
+ 158, -2, -2, -2, 159, -2, -2, -2,
+ 162, 150, 163, 151, 164, -2, -2, -2,
+ -2, 165, -2, -2, -2, 166, 167, -2,
+ -2, -2, 168, 169, -2, 170, 171, 172,
+ 173, -2, -2, 174, 175, 176, 177, 178,
+ 180, 181, 182, -2, -2, 183, -2, -2,
+ 185, -2, 179, 184, -2, 186, 187, -2,
+ 188, 189, 194, -2, 198, 190, -2, -2,
+ 191, -2, -2, -2, 192, -2, 193, 196,
+ 199, 197, -2, -2, -2, -2, -2, 195,
+ -2, 200, -2, -2, -2, -2, -2, -2,
+ 201, -2, -2, -2, -2, 202, 203, -2,
+ -2, -2, 204, 205, -2, 210, 211, -2,
+ 212, 213, 214, 215, 216, -2, -2, -2,
+ 217, 218, -2, -2, 219, 220, -2, 221,
+ 222, 224, 225, 223, 226, 227, 229, 230,
+ 231, -2, 234, 232, 235, 236, 237, 238,
+ 228, 233, 239, 243, 244, 240, -2, -2,
+ 245, 241, 246, 242, 247, 248, 249, 251,
+ 252, 253, 254, 255, 256, 257, 258, 250,
+ 259, -2, 260, -2, 261, 262, -2, 263,
+ -2, 264, -2, 266, 267, -2, 268, 269,
+ 265, 270, -2, 271, -2, 272, -2, -2,
+ -2, -2, -2, 274, 276, 277, 275, 273,
+ 278, 279, 280, 281, 282, 283, 284, 285,
+ 286, -2, 287, -2, 288, 289, -2, 297,
+ 298, 299, 300, -2, 301, -2, 302, 303,
+ -2, 304, -2, 305, -2, 307, 308, -2,
+ 309, 310, 306, 311, -2, 312, -2, 313,
+ -2, -2, -2, -2, -2, 315, 317, 318,
+ 316, 314, 319, 320, 321, 322, 323, 324,
+ 325, 326, 327, 328, -2, 330, 331, -2,
+ 332, 333, -2, 334, -2, 335, 336, 337,
+ 338, -2, 339, -2, 340, -2, 329, -2,
+ 341, -2, 342, 343, 344, -2, 345, -2,
+ 346, -2, 347, 348, 349, 350, 351, -2,
+ 352, 353, 354, -2, 355, -2, 356, -2,
+ 357, 358, 359, 360, -2, 361, -2, 362,
+ -2, -2, 363, -2, 364, 365, 366, -2,
+ 367, -2, 368, -2, 369, 370, 371, 372,
+ 373, 374, -2, 375, 376, 377, 378, -2,
+ -2, 379, -2, 380, 381, 382, 383, -2,
+ 384, -2, 385, -2, 386, 387, 388, -2,
+ -2, -2, -2, 389, 390, 391, -2, 392,
+ -2, 393, 394, 395, 396, -2, 397, -2,
+ 398, -2, 399, 400, 401, -2, -2, 402,
+ -2, -2, 403, 404, 405, 406, -2, 407,
+ -2, -2, -2, -2, 408, -2, -2, 409,
+ -2, 410, -2, 411, 412, -2, -2, -2,
+ -2, 413, -2, -2, 414, -2, -2, 415,
+ -2, 416, 417, 418, 419, -2, -2, -2,
+ -2, 420, -2, -2, -2, -2, -2, -2,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1
+};
+
+int mpcheck[698] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, 0, -1,
+ 113, 114, 115, 206, 207, 22, 21, 290,
+ 22, 208, 115, 208, 208, 208, 209, 208,
+ 291, 292, 293, 294, 295, 296, 296, 416,
+ 416, -1, -1, -1, 1, 1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 0, 0, 0, 0, 0, 11, 0,
+ 20, 0, 0, 32, 0, 0, 0, 0,
+ 0, 0, 0, 0, 0, 0, 15, 0,
+ 1, 1, 1, 1, 1, 19, 1, 12,
+ 1, 1, 12, 1, 1, 1, 1, 1,
+ 1, 1, 1, 1, 1, 2, 1, 14,
+ 3, 7, 3, 14, 7, 7, 3, 2,
+ 24, 14, 3, 3, 2, 3, 8, 3,
+ 3, 8, 4, 3, 4, 30, 8, 5,
+ 16, 5, 36, 5, 37, 4, 4, 5,
+ 4, 4, 16, 38, 4, 40, 5, 16,
+ 6, 5, 6, 5, 6, 6, 10, 6,
+ 6, 41, 9, 10, 6, 9, 6, 13,
+ 9, 10, 42, 17, 43, 10, 17, 23,
+ 18, 13, 28, 13, 18, 28, 28, 33,
+ 18, 23, 33, 46, 35, 17, 17, 25,
+ 23, 25, 18, 26, 31, 26, 35, 18,
+ 18, 47, 31, 26, 27, 25, 27, 48,
+ 27, 25, 26, 27, 27, 26, 29, 26,
+ 27, 29, 27, 34, 39, 45, 29, 34,
+ 39, 44, 49, 50, 39, 51, 52, 53,
+ 44, 34, 54, 34, 55, 45, 56, 56,
+ 57, 58, 59, 59, 56, 60, 61, 53,
+ 62, 63, 64, 65, 66, 67, 68, 69,
+ 70, 56, 71, 70, 72, 73, 74, 75,
+ 76, 77, 78, 79, 81, 80, 63, 63,
+ 82, 83, 75, 80, 84, 85, 86, 87,
+ 88, 89, 91, 92, 97, 90, 94, 93,
+ 90, 95, 80, 80, 90, 93, 90, 96,
+ 98, 96, 90, 84, 84, 94, 99, 94,
+ 95, 98, 100, 101, 99, 102, 102, 103,
+ 104, 105, 105, 102, 100, 106, 107, 108,
+ 109, 110, 111, 112, 116, 117, 118, 119,
+ 120, 121, 122, 123, 124, 125, 103, 103,
+ 126, 127, 109, 128, 129, 130, 128, 131,
+ 132, 133, 134, 132, 135, 136, 137, 138,
+ 139, 140, 142, 141, 143, 144, 145, 146,
+ 136, 141, 147, 148, 149, 147, 150, 151,
+ 152, 147, 153, 147, 153, 154, 155, 156,
+ 157, 158, 159, 160, 161, 162, 163, 155,
+ 164, 165, 166, 167, 168, 169, 170, 171,
+ 172, 173, 174, 175, 176, 177, 178, 179,
+ 174, 180, 181, 182, 174, 183, 184, 185,
+ 186, 174, 187, 188, 189, 190, 188, 183,
+ 191, 192, 193, 194, 195, 196, 197, 198,
+ 199, 200, 201, 202, 203, 204, 205, 210,
+ 211, 212, 213, 214, 215, 216, 217, 218,
+ 219, 220, 221, 222, 223, 224, 225, 226,
+ 227, 228, 223, 229, 230, 231, 223, 232,
+ 233, 234, 235, 223, 236, 237, 238, 239,
+ 237, 232, 240, 241, 242, 243, 244, 245,
+ 246, 247, 248, 249, 250, 251, 252, 253,
+ 254, 255, 256, 257, 258, 259, 260, 261,
+ 262, 263, 264, 265, 266, 267, 249, 268,
+ 269, 270, 271, 272, 273, 274, 275, 276,
+ 277, 278, 279, 280, 281, 282, 283, 284,
+ 285, 286, 287, 288, 289, 297, 298, 299,
+ 300, 301, 302, 303, 304, 305, 306, 307,
+ 308, 309, 310, 311, 312, 313, 314, 315,
+ 316, 317, 318, 319, 320, 321, 322, 323,
+ 324, 325, 326, 327, 328, 329, 330, 331,
+ 332, 333, 334, 335, 336, 337, 338, 339,
+ 340, 341, 342, 343, 344, 345, 346, 347,
+ 348, 349, 350, 351, 352, 353, 354, 355,
+ 356, 357, 358, 359, 360, 361, 362, 363,
+ 364, 365, 366, 367, 368, 369, 370, 371,
+ 372, 373, 374, 375, 376, 377, 378, 379,
+ 380, 381, 382, 383, 384, 385, 386, 387,
+ 388, 389, 390, 391, 392, 393, 394, 395,
+ 396, 397, 398, 399, 400, 401, 402, 403,
+ 404, 405, 406, 407, 408, 409, 410, 411,
+ 412, 413, 414, 415, 417, 418, 419, 420,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1
+};
+
+int mpaccept[698] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, 2, -1, -1, 64,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ 3, 58, 59, 60, 61, 62, 63, 25,
+ 26, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, 500, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 12, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 13, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, 2000, -1, 2001, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, 2005, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, 12, -1, -1,
+ -1, 2011, -1, -1, -1, -1, -1, 2007,
+ -1, -1, -1, -1, -1, 13, 500, -1,
+ -1, -1, -1, -1, -1, 2003, -1, -1,
+ -1, 2002, 2006, 2008, -1, 2012, 4, 2009,
+ -1, -1, -1, -1, -1, 2004, 2013, 2014,
+ 2017, -1, 2018, 2019, 2015, -1, -1, 2010,
+ 17, 2020, -1, -1, 68, -1, -1, -1,
+ -1, 2016, 2023, 34, 18, -1, -1, -1,
+ -1, -1, -1, 503, 2027, 2024, 2021, 2022,
+ -1, 2028, -1, -1, 2029, -1, -1, 2032,
+ -1, -1, -1, 66, -1, -1, 2035, 2034,
+ -1, 2037, 2025, 2026, -1, 0, -1, -1,
+ -1, -1, 2033, 2030, 2031, 2036, 2039, -1,
+ 2038, -1, 2041, 2043, 2040, 2044, 2045, 2047,
+ -1, 2050, 2051, 2046, 2042, -1, -1, 2052,
+ 2053, 2055, -1, -1, 7, -1, -1, 4,
+ -1, -1, -1, -1, -1, 17, 2048, 2049,
+ -1, -1, 2054, 68, -1, -1, 16, -1,
+ -1, 18, -1, 34, -1, -1, -1, -1,
+ 15, 503, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, 66, 0,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 8, -1, 5, -1, -1, 20, -1,
+ 501, -1, 502, -1, -1, 1, -1, -1,
+ -1, -1, 11, -1, 505, -1, 9, 54,
+ 38, 507, 40, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 506, -1, 6, -1, -1, 48, -1,
+ -1, -1, -1, 8, -1, 5, -1, -1,
+ 20, -1, 501, -1, 502, -1, -1, 1,
+ -1, -1, -1, -1, 11, -1, 505, -1,
+ 9, 54, 38, 507, 40, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, 506, -1, -1, 6,
+ -1, -1, 48, -1, 10, -1, -1, -1,
+ -1, 46, -1, 502, -1, 47, -1, 510,
+ -1, 24, -1, -1, -1, 504, -1, 39,
+ -1, 65, -1, -1, -1, -1, -1, 52,
+ -1, -1, -1, 44, -1, 69, -1, 10,
+ -1, -1, -1, -1, 46, -1, 502, -1,
+ 47, 510, -1, 24, -1, -1, -1, 504,
+ -1, 39, -1, 65, -1, -1, -1, -1,
+ -1, -1, 52, -1, -1, -1, -1, 70,
+ 44, -1, 28, -1, -1, -1, -1, 23,
+ -1, 24, -1, 21, -1, -1, -1, 55,
+ 39, 7, 41, -1, -1, -1, 45, -1,
+ 28, -1, -1, -1, -1, 23, -1, 24,
+ -1, 21, -1, -1, -1, 55, 39, -1,
+ 7, 41, -1, -1, -1, -1, 45, -1,
+ 51, 53, 22, 42, -1, 56, 33, -1,
+ 49, -1, 43, -1, -1, 51, 53, 22,
+ 42, -1, 56, 33, -1, 49, 67, -1,
+ 43, -1, -1, -1, -1, 14, 57, 50,
+ 14, -1, 14, 57, 50, 14, 50, 50,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1
+};
+#endif
@@ -9,17 +9,34 @@
 #include <stdio.h>
 #include <ctype.h>
 #include <stdlib.h>
+#include <string.h>
 
 
 #define	EOS	'\0'
+#define MAXENT	1024	/* max # of table entries */
+#define NSIZES	9		/* # of size bits (SIZB..SIZQ) */
+#define NMODES	32		/* # of addressing mode bits (M_DREG..) */
+#define MAXVAR	16		/* max # of variants in a chain */
 
 int kwnum = 1;			/* current op# for kwgen output */
 FILE * kfp;				/* keyword file */
+FILE * vfp;				/* variant table file */
 int lineno = 0;
 
+// Table entries, kept for the variant table
+struct entry {
+	char * siz;			/* size mask (C expression) */
+	char * mn0;			/* ea0 mode mask (C expression) */
+	char * mn1;			/* ea1 mode mask (C expression) */
+	char * name;		/* mnemonic (or NULL for a continuation) */
+	int cont;			/* 1, chain continues with the next entry */
+} ent[MAXENT];
+
 // Function prototypes
 void error(char *, char *);
 void procln(int, char **);
+void varrow(int, char *, int, int);
+void vartab(void);
 
 
 int main(int argc, char ** argv)
@@ -29,9 +46,12 @@ int main(int argc, char ** argv)
 	int namcnt;
 	char ln[256];
 
-	if ((argc == 2) && ((kfp = fopen(argv[1], "w")) == NULL))
+	if ((argc >= 2) && ((kfp = fopen(argv[1], "w")) == NULL))
 		error("Cannot create: %s", argv[1]);
 
+	if ((argc >= 3) && ((vfp = fopen(argv[2], "w")) == NULL))
+		error("Cannot create: %s", argv[2]);
+
 	while (fgets(ln, 256, stdin) != NULL)
 	{
 		lineno++;			/* bump line# */
@@ -66,6 +86,9 @@ int main(int argc, char ** argv)
 			procln(namcnt, namv);
 	}
 
+	if (vfp != NULL)
+		vartab();
+
 	return 0;
 }
 
@@ -81,6 +104,10 @@ void procln(int namc, char ** namv)
 	if (namc == 1)
 	{
 		fprintf(kfp, "%s\t%d\n", namv[0], kwnum - 1 + 1000);
+
+		if (ent[kwnum - 1].name == NULL)
+			ent[kwnum - 1].name = strdup(namv[0]);
+
 		return;
 	}
 
@@ -90,6 +117,14 @@ void procln(int namc, char ** namv)
 		exit(1);
 	}
 
+	if (kwnum >= MAXENT)
+		error("too many entries (%s)", namv[0]);
+
+	ent[kwnum].name = (*namv[0] != '-' ? strdup(namv[0]) : NULL);
+	ent[kwnum].mn0 = strdup(namv[2]);
+	ent[kwnum].mn1 = strdup(namv[3]);
+	ent[kwnum].cont = (namc == 7 && *namv[6] == '+');
+
 	// output keyword name
 	if (*namv[0] != '-')
 		fprintf(kfp, "%s\t%d\n", namv[0], kwnum + 1000);
@@ -97,9 +132,19 @@ void procln(int namc, char ** namv)
 	printf("/*%4d %-6s*/  {", kwnum, namv[0]);
 
 	if (*namv[1] == '!')
-		printf("CGSPECIAL");
-	else for(char * s=namv[1], i=0; *s; s++)
-		printf("%sSIZ%c", (i++ ? "|" : ""), *s);
+		ent[kwnum].siz = "CGSPECIAL";
+	else
+	{
+		char buf[128];
+		buf[0] = EOS;
+
+		for(char * s=namv[1]; *s; s++)
+			sprintf(buf + strlen(buf), "%sSIZ%c", (*buf ? "|" : ""), *s);
+
+		ent[kwnum].siz = strdup(buf);
+	}
+
+	printf("%s", ent[kwnum].siz);
 
 	printf(", %s, %s, ", namv[2], namv[3]);
 
@@ -130,6 +175,66 @@ void procln(int namc, char ** namv)
 }
 
 
+//
+// Output one row of the variant table: for each bit of a size or mode mask,
+// which of the variants starting at entry 'n' take it (bit v = entry n+v)
+//
+void varrow(int n, char * what, int nbits, int len)
+{
+	fprintf(vfp, "\t{");
+
+	for(int b=0; b<nbits; b++)
+	{
+		fprintf(vfp, "%s\n\t\t", (b ? "," : ""));
+
+		for(int v=0; v<len; v++)
+		{
+			struct entry * e = &ent[n + v];
+			char * m = (*what == 's' ? e->siz : *what == '0' ? e->mn0 : e->mn1);
+			fprintf(vfp, "%sV(%s,%d,%d)", (v ? "|" : ""), m, b, v);
+		}
+	}
+
+	fprintf(vfp, "\n\t},\n");
+}
+
+
+//
+// Output the variant table. There is a row for every entry a mnemonic (or
+// alias) starts on, telling for every size and every addressing mode of
+// both operands which variants in its chain take it. procln.c ANDs three of
+// those together, and the lowest bit set is the variant to use. The masks
+// are left to the C compiler to evaluate.
+//
+void vartab(void)
+{
+	fprintf(vfp, "// Generated by 68kgen from 68k.mch, do not edit\n");
+	fprintf(vfp, "#define V(m, b, v) ((((m) >> (b)) & 1) << (v))\n");
+
+	for(int n=1; n<kwnum; n++)
+	{
+		if (ent[n].name == NULL)
+			continue;
+
+		int len = 1;
+
+		while (ent[n + len - 1].cont)
+			len++;
+
+		if (len > MAXVAR)
+			error("too many variants for %s", ent[n].name);
+
+		fprintf(vfp, "/*%4d %-6s*/ [%d] = {\n", n, ent[n].name, n);
+		varrow(n, "siz", NSIZES, len);
+		varrow(n, "0", NMODES, len);
+		varrow(n, "1", NMODES, len);
+		fprintf(vfp, "},\n");
+	}
+
+	fprintf(vfp, "#undef V\n");
+}
+
+
 void error(char * s, char * s1)
 {
 	fprintf(stderr, s, s1);
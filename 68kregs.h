@@ -0,0 +1,174 @@
+#ifdef DEF_REG68
+/*
+ *  Keyword definitions
+ */
+#define	REG68_A0	136
+#define	REG68_A1	137
+#define	REG68_A2	138
+#define	REG68_A3	139
+#define	REG68_A4	140
+#define	REG68_A5	141
+#define	REG68_A6	142
+#define	REG68_A7	143
+#define	REG68_BC40	187
+#define	REG68_CAAR	193
+#define	REG68_CACR	192
+#define	REG68_CCR	147
+#define	REG68_CRP	210
+#define	REG68_D0	128
+#define	REG68_D1	129
+#define	REG68_D2	130
+#define	REG68_D3	131
+#define	REG68_D4	132
+#define	REG68_D5	133
+#define	REG68_D6	134
+#define	REG68_D7	135
+#define	REG68_DACR0	206
+#define	REG68_DACR1	207
+#define	REG68_DC40	186
+#define	REG68_DFC	189
+#define	REG68_DTT0	199
+#define	REG68_DTT1	200
+#define	REG68_FP0	224
+#define	REG68_FP1	225
+#define	REG68_FP2	226
+#define	REG68_FP3	227
+#define	REG68_FP4	228
+#define	REG68_FP5	229
+#define	REG68_FP6	230
+#define	REG68_FP7	231
+#define	REG68_FPCR	222
+#define	REG68_FPIAR	220
+#define	REG68_FPSR	221
+#define	REG68_IACR0	204
+#define	REG68_IACR1	205
+#define	REG68_IC40	185
+#define	REG68_ISP	195
+#define	REG68_ITT0	197
+#define	REG68_ITT1	198
+#define	REG68_MMUSR	201
+#define	REG68_MSP	194
+#define	REG68_PC	145
+#define	REG68_PSR	201
+#define	REG68_SFC	188
+#define	REG68_SP	143
+#define	REG68_SR	146
+#define	REG68_SRP	203
+#define	REG68_SSP	144
+#define	REG68_TC	196
+#define	REG68_TT0	208
+#define	REG68_TT1	209
+#define	REG68_URP	202
+#define	REG68_USP	184
+#define	REG68_VBR	191
+#endif
+
+#ifdef DECL_REG68
+/*
+ *  keyword state-machine tables
+ *
+ */
+
+int reg68base[53] = {
+ 0, 0, 2, 7, 11, 2, 23, 10,
+ 8, 22, 12, 15, 5, 4, 34, 12,
+ 20, 36, 5, 41, 25, 94, 51, 6,
+ 39, 36, 36, 42, 41, 57, 45, 46,
+ 19, 47, 48, 47, 21, 48, 49, 50,
+ 22, 23, 51, 69, 53, 54, 25, 26,
+ 54, 28, 56, 30, 57
+};
+
+int reg68tab[222] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -2, -2, -2, -2, -2, -2, -2, -2,
+ 36, 40, 46, -2, -2, -2, -2, -2,
+ -2, -2, -2, -2, -2, -2, -2, -2,
+ -2, -2, -2, -2, -2, -2, -2, -2,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 1, 2, 3, 4, 13, 5, 35,
+ 14, 6, 15, -2, 17, 7, 18, -2,
+ 8, 19, 21, 9, 10, 11, 12, 26,
+ 22, 16, 23, 28, 29, 27, -2, 20,
+ 32, 33, 34, 37, -2, 38, -2, 39,
+ 30, 31, 24, 25, -2, 41, -2, -2,
+ -2, -2, -2, -2, -2, -2, 45, -2,
+ 47, 48, -2, -2, -2, -2, -2, -2,
+ -2, -2, -2, -2, 49, -2, 50, -2,
+ 51, 52, -2, -2, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 42, -1, -1, -1, -1, -1, 43,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 44, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1
+};
+
+int reg68check[222] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ 1, 1, 1, 1, 1, 1, 1, 1,
+ 13, 18, 23, 4, 4, 4, 4, 4,
+ 4, 4, 4, 32, 32, 36, 40, 41,
+ 41, 46, 47, 47, 49, 49, 51, 51,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 0, 0, 0, 0, 2, 0, 12,
+ 3, 0, 3, 8, 4, 0, 4, 10,
+ 0, 4, 5, 0, 0, 0, 0, 7,
+ 6, 3, 6, 8, 9, 7, 15, 4,
+ 10, 11, 11, 14, 16, 14, 9, 17,
+ 9, 9, 6, 6, 19, 20, 21, 21,
+ 21, 21, 21, 21, 21, 21, 22, 24,
+ 25, 26, 27, 28, 29, 30, 31, 33,
+ 34, 35, 37, 38, 39, 42, 43, 44,
+ 45, 48, 50, 52, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 21, -1, -1, -1, -1, -1, 21,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 21, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1
+};
+
+int reg68accept[222] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ 136, 137, 138, 139, 140, 141, 142, 143,
+ -1, -1, -1, 128, 129, 130, 131, 132,
+ 133, 134, 135, 208, 209, 187, 186, 199,
+ 200, 185, 197, 198, 206, 207, 204, 205,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, 145, -1, -1, -1, 196,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, 147, -1,
+ -1, -1, -1, -1, 210, -1, 143, -1,
+ 146, -1, -1, -1, 189, -1, 224, 225,
+ 226, 227, 228, 229, 230, 231, -1, 195,
+ -1, -1, 194, 201, 188, 203, 144, 202,
+ 184, 191, 193, 192, -1, 222, -1, 221,
+ -1, -1, 220, 201, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1
+};
+#endif
@@ -0,0 +1,716 @@
+/*   1 abcd  */  {SIZN|SIZB, M_DREG, M_DREG, 0xc100, 2, m_abcd},
+/*   2 -     */  {SIZN|SIZB, M_APREDEC, M_APREDEC, 0xc108, 0, m_abcd},
+/*   3 add   */  {SIZN|SIZB|SIZW|SIZL, C_ALL, M_DREG, 0xd01c, 4, m_ea},
+/*   4 -     */  {SIZN|SIZB|SIZW|SIZL, M_DREG, C_ALTMEM, 0xd115, 5, m_ea},
+/*   5 adda  */  {SIZN|SIZW|SIZL, C_ALL, M_AREG, 0xd0c0, 6, m_adda},
+/*   6 addi  */  {SIZN|SIZW|SIZB|SIZL, M_IMMED, C_ALTDATA, 0x0607, 7, m_ea},
+/*   7 -     */  {SIZN|SIZW|SIZB|SIZL, M_IMMED, C_ALTDATA, 0x0606, 0, m_ea030},
+/*   8 addq  */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, C_ALT, 0x5000, 0, m_addq},
+/*   9 addx  */  {SIZN|SIZB|SIZW|SIZL, M_DREG, M_DREG, 0xd101, 10, m_abcd},
+/*  10 -     */  {SIZN|SIZB|SIZW|SIZL, M_APREDEC, M_APREDEC, 0xd109, 0, m_abcd},
+/*  11 and   */  {SIZN|SIZB|SIZW|SIZL, C_DATA, M_DREG, 0xc01c, 12, m_ea},
+/*  12 -     */  {SIZN|SIZB|SIZW|SIZL, M_DREG, C_ALTMEM, 0xc115, 13, m_ea},
+/*  13 andi  */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, C_ALTDATA, 0x0207, 14, m_ea},
+/*  14 -     */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, C_DATA030, 0x0206, 15, m_ea030},
+/*  15 -     */  {SIZN|SIZB, M_IMMED, M_AM_CCR, 0x023c, 16, m_imm8},
+/*  16 -     */  {SIZN|SIZW, M_IMMED, M_AM_SR, 0x027c, 0, m_imm},
+/*  17 asl   */  {SIZN|SIZB|SIZW|SIZL, M_DREG, M_DREG, 0xe120, 18, m_shr},
+/*  18 -     */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, M_DREG, 0xe100, 19, m_shi},
+/*  19 -     */  {SIZN|SIZB|SIZW|SIZL, M_DREG, M_AM_NONE, 0xe301, 20, m_reg},
+/*  20 -     */  {SIZN|SIZW, C_ALTMEM, M_AM_NONE, 0xe1c0, 0, m_ea},
+/*  21 asr   */  {SIZN|SIZB|SIZW|SIZL, M_DREG, M_DREG, 0xe020, 22, m_shr},
+/*  22 -     */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, M_DREG, 0xe000, 23, m_shi},
+/*  23 -     */  {SIZN|SIZB|SIZW|SIZL, M_DREG, M_AM_NONE, 0xe201, 24, m_reg},
+/*  24 -     */  {SIZN|SIZW, C_ALTMEM, M_AM_NONE, 0xe0c0, 0, m_ea},
+/*  25 bcc   */  {SIZN|SIZB|SIZW|SIZS, C_LABEL, M_AM_NONE, 0x6400, 26, m_br},
+/*  26 -     */  {SIZL, C_LABEL, M_AM_NONE, 0x64ff, 0, m_br30},
+/*  27 bcs   */  {SIZN|SIZB|SIZW|SIZS, C_LABEL, M_AM_NONE, 0x6500, 28, m_br},
+/*  28 -     */  {SIZL, C_LABEL, M_AM_NONE, 0x65ff, 0, m_br30},
+/*  29 beq   */  {SIZN|SIZB|SIZW|SIZS, C_LABEL, M_AM_NONE, 0x6700, 30, m_br},
+/*  30 -     */  {SIZL, C_LABEL, M_AM_NONE, 0x67ff, 0, m_br30},
+/*  31 bge   */  {SIZN|SIZB|SIZW|SIZS, C_LABEL, M_AM_NONE, 0x6c00, 32, m_br},
+/*  32 -     */  {SIZL, C_LABEL, M_AM_NONE, 0x6cff, 0, m_br30},
+/*  33 bgt   */  {SIZN|SIZB|SIZW|SIZS, C_LABEL, M_AM_NONE, 0x6e00, 34, m_br},
+/*  34 -     */  {SIZL, C_LABEL, M_AM_NONE, 0x6eff, 0, m_br30},
+/*  35 bhi   */  {SIZN|SIZB|SIZW|SIZS, C_LABEL, M_AM_NONE, 0x6200, 36, m_br},
+/*  36 -     */  {SIZL, C_LABEL, M_AM_NONE, 0x62ff, 0, m_br30},
+/*  37 ble   */  {SIZN|SIZB|SIZW|SIZS, C_LABEL, M_AM_NONE, 0x6f00, 38, m_br},
+/*  38 -     */  {SIZL, C_LABEL, M_AM_NONE, 0x6fff, 0, m_br30},
+/*  39 bls   */  {SIZN|SIZB|SIZW|SIZS, C_LABEL, M_AM_NONE, 0x6300, 40, m_br},
+/*  40 -     */  {SIZL, C_LABEL, M_AM_NONE, 0x63ff, 0, m_br30},
+/*  41 blt   */  {SIZN|SIZB|SIZW|SIZS, C_LABEL, M_AM_NONE, 0x6d00, 42, m_br},
+/*  42 -     */  {SIZL, C_LABEL, M_AM_NONE, 0x6dff, 0, m_br30},
+/*  43 bmi   */  {SIZN|SIZB|SIZW|SIZS, C_LABEL, M_AM_NONE, 0x6b00, 44, m_br},
+/*  44 -     */  {SIZL, C_LABEL, M_AM_NONE, 0x6bff, 0, m_br30},
+/*  45 bne   */  {SIZN|SIZB|SIZW|SIZS, C_LABEL, M_AM_NONE, 0x6600, 46, m_br},
+/*  46 -     */  {SIZL, C_LABEL, M_AM_NONE, 0x6600, 0, m_br30},
+/*  47 bpl   */  {SIZN|SIZB|SIZW|SIZS, C_LABEL, M_AM_NONE, 0x6a00, 48, m_br},
+/*  48 -     */  {SIZL, C_LABEL, M_AM_NONE, 0x6aff, 0, m_br30},
+/*  49 bvc   */  {SIZN|SIZB|SIZW|SIZS, C_LABEL, M_AM_NONE, 0x6800, 50, m_br},
+/*  50 -     */  {SIZL, C_LABEL, M_AM_NONE, 0x68ff, 0, m_br30},
+/*  51 bvs   */  {SIZN|SIZB|SIZW|SIZS, C_LABEL, M_AM_NONE, 0x6900, 52, m_br},
+/*  52 -     */  {SIZL, C_LABEL, M_AM_NONE, 0x69ff, 0, m_br30},
+/*  53 bchg  */  {SIZN|SIZL, M_DREG, M_DREG, 0x0140, 54, m_bitop},
+/*  54 -     */  {SIZN|SIZB, M_DREG, C_ALTDATA, 0x0140, 55, m_bitop},
+/*  55 -     */  {SIZN|SIZL, M_IMMED, M_DREG, 0x0840, 56, m_bitop},
+/*  56 -     */  {SIZN|SIZB, M_IMMED, C_ALTDATA, 0x0840, 0, m_bitop},
+/*  57 bclr  */  {SIZN|SIZL, M_DREG, M_DREG, 0x0180, 58, m_bitop},
+/*  58 -     */  {SIZN|SIZB, M_DREG, C_ALTDATA, 0x0180, 59, m_bitop},
+/*  59 -     */  {SIZN|SIZL, M_IMMED, M_DREG, 0x0880, 60, m_bitop},
+/*  60 -     */  {SIZN|SIZB, M_IMMED, C_ALTDATA, 0x0880, 0, m_bitop},
+/*  61 bfchg */  {SIZN, C_BF1+M_BITFLD, M_AM_NONE, 0xeac0, 0, m_bfop},
+/*  62 bfclr */  {SIZN, C_BF1+M_BITFLD, M_AM_NONE, 0xecc0, 0, m_bfop},
+/*  63 bfexts*/  {SIZN, C_BF2+M_BITFLD, M_DREG, 0xebc0, 0, m_bfop},
+/*  64 bfextu*/  {SIZN, C_BF2+M_BITFLD, M_DREG, 0xe9c0, 0, m_bfop},
+/*  65 bfffo */  {SIZN, C_BF2+M_BITFLD, M_DREG, 0xedc0, 0, m_bfop},
+/*  66 bfins */  {SIZN, M_DREG, C_BF1+M_BITFLD, 0xefc0, 0, m_bfop},
+/*  67 bfset */  {SIZN, C_BF1+M_BITFLD, M_AM_NONE, 0xeec0, 0, m_bfop},
+/*  68 bftst */  {SIZN, C_BF2+M_BITFLD, M_AM_NONE, 0xe8c0, 0, m_bfop},
+/*  69 bkpt  */  {SIZN, M_IMMED, M_AM_NONE, 0x4848, 0, m_bkpt},
+/*  70 bra   */  {SIZN|SIZB|SIZW|SIZS, C_LABEL, M_AM_NONE, 0x6000, 71, m_br},
+/*  71 -     */  {SIZL, C_LABEL, M_AM_NONE, 0x60ff, 0, m_br30},
+/*  72 bset  */  {SIZN|SIZL, M_DREG, M_DREG, 0x01c0, 73, m_bitop},
+/*  73 -     */  {SIZN|SIZB, M_DREG, C_ALTDATA, 0x01c0, 74, m_bitop},
+/*  74 -     */  {SIZN|SIZL, M_IMMED, M_DREG, 0x08c0, 75, m_bitop},
+/*  75 -     */  {SIZN|SIZB, M_IMMED, C_ALTDATA, 0x08c0, 0, m_bitop},
+/*  76 bsr   */  {SIZN|SIZB|SIZW|SIZS, C_LABEL, M_AM_NONE, 0x6100, 77, m_br},
+/*  77 -     */  {SIZL, C_LABEL, M_AM_NONE, 0x61ff, 0, m_br30},
+/*  78 btst  */  {SIZN|SIZL, M_DREG, M_DREG, 0x0100, 79, m_bitop},
+/*  79 -     */  {SIZN|SIZB, M_DREG, C_DATA, 0x0100, 80, m_bitop},
+/*  80 -     */  {SIZN|SIZL, M_IMMED, M_DREG, 0x0800, 81, m_bitop},
+/*  81 -     */  {SIZN|SIZB, M_IMMED, C_DATA-M_IMMED, 0x0800, 0, m_bitop},
+/*  82 callm */  {SIZN, M_IMMED, C_ALT030, 0x06c0, 0, m_callm},
+/*  83 cas   */  {CGSPECIAL, M_AM_NONE, M_AM_NONE, 0x08c0, 0, m_cas},
+/*  84 cas2  */  {CGSPECIAL, M_AM_NONE, M_AM_NONE, 0x08fc, 0, m_cas2},
+/*  85 chk   */  {SIZN|SIZW, C_DATA, M_DREG, 0x4198, 86, m_ea},
+/*  86 -     */  {SIZL, C_DATA030, M_DREG, 0x4100, 0, m_ea030},
+/*  87 cinvl */  {SIZN, M_CACHE40, M_AIND, 0xf408, 0, m_cinv},
+/*  88 cinvp */  {SIZN, M_CACHE40, M_AIND, 0xf410, 0, m_cinv},
+/*  89 cinva */  {SIZN, M_CACHE40, M_AM_NONE, 0xf418, 0, m_cinv},
+/*  90 chk2  */  {SIZN|SIZB|SIZW|SIZL, C_DATA, M_DREG+M_AREG, 0x00c0, 0, m_chk2},
+/*  91 clr   */  {SIZL, M_DREG, M_AM_NONE, 0x4280, 92, m_clrd},
+/*  92 -     */  {SIZN|SIZB|SIZW|SIZL, C_ALTDATA, M_AM_NONE, 0x4204, 93, m_ea},
+/*  93 -     */  {SIZN|SIZW|SIZL, M_AREG, M_AM_NONE, 0x90c8, 0, m_clra},
+/*  94 cmp   */  {SIZN|SIZW|SIZL, M_AREG, M_DREG, 0xb01c, 95, m_ea},
+/*  95 -     */  {SIZN|SIZB|SIZW|SIZL, C_ALL, M_DREG, 0xb01c, 96, m_ea},
+/*  96 cmpa  */  {SIZN|SIZW|SIZL, C_ALL, M_AREG, 0xb0c0, 97, m_adda},
+/*  97 cmpi  */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, C_ALTDATA, 0x0c07, 98, m_ea},
+/*  98 -     */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, C_ALT030, 0x0c06, 99, m_ea030},
+/*  99 cmpm  */  {SIZN|SIZB|SIZW|SIZL, M_APOSTINC, M_APOSTINC, 0xb10b, 0, m_reg},
+/* 100 cmp2  */  {SIZN|SIZB|SIZW|SIZL, C_ALL030, M_DREG+M_AREG, 0x00c0, 0, m_cmp2},
+/* 101 cpbeq */  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf281, 0, m_cpbcc},
+/* 102 cpbge */  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf293, 0, m_cpbcc},
+/* 103 cpbgt */  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf292, 0, m_cpbcc},
+/* 104 cpbgl */  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf296, 0, m_cpbcc},
+/* 105 cpbgle*/  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf297, 0, m_cpbcc},
+/* 106 cpble */  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf295, 0, m_cpbcc},
+/* 107 cpblt */  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf294, 0, m_cpbcc},
+/* 108 cpbne */  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf28e, 0, m_cpbcc},
+/* 109 cpbngt*/  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf29d, 0, m_cpbcc},
+/* 110 cpbnge*/  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf29c, 0, m_cpbcc},
+/* 111 cpbngl*/  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf299, 0, m_cpbcc},
+/* 112 cpbnle*/  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf29a, 0, m_cpbcc},
+/* 113 cpbngle*/  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf298, 0, m_cpbcc},
+/* 114 cpbogt*/  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf282, 0, m_cpbcc},
+/* 115 cpbule*/  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf28d, 0, m_cpbcc},
+/* 116 cpboge*/  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf283, 0, m_cpbcc},
+/* 117 cpbult*/  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf28c, 0, m_cpbcc},
+/* 118 cpbolt*/  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf284, 0, m_cpbcc},
+/* 119 cpbuge*/  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf28b, 0, m_cpbcc},
+/* 120 cpbole*/  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf285, 0, m_cpbcc},
+/* 121 cpbugt*/  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf28a, 0, m_cpbcc},
+/* 122 cpbogl*/  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf286, 0, m_cpbcc},
+/* 123 cpbueq*/  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf289, 0, m_cpbcc},
+/* 124 cpbor */  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf287, 0, m_cpbcc},
+/* 125 cpbun */  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf288, 0, m_cpbcc},
+/* 126 cpbt  */  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf28f, 0, m_cpbcc},
+/* 127 cpbf  */  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf280, 0, m_cpbcc},
+/* 128 cpbsf */  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf290, 0, m_cpbcc},
+/* 129 cpbst */  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf29f, 0, m_cpbcc},
+/* 130 cpbseq*/  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf291, 0, m_cpbcc},
+/* 131 cpbsne*/  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf29e, 0, m_cpbcc},
+/* 132 cpdbeq*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf281, 0, m_cpdbr},
+/* 133 cpdbge*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf293, 0, m_cpdbr},
+/* 134 cpdbgt*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf292, 0, m_cpdbr},
+/* 135 cpdbgl*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf296, 0, m_cpdbr},
+/* 136 cpdbgle*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf297, 0, m_cpdbr},
+/* 137 cpdble*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf295, 0, m_cpdbr},
+/* 138 cpdblt*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf294, 0, m_cpdbr},
+/* 139 cpdbne*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf28e, 0, m_cpdbr},
+/* 140 cpdbngt*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf29d, 0, m_cpdbr},
+/* 141 cpdbnge*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf29c, 0, m_cpdbr},
+/* 142 cpdbngl*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf299, 0, m_cpdbr},
+/* 143 cpdbnle*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf29a, 0, m_cpdbr},
+/* 144 cpdbngle*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf298, 0, m_cpdbr},
+/* 145 cpdbogt*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf282, 0, m_cpdbr},
+/* 146 cpdbule*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf28d, 0, m_cpdbr},
+/* 147 cpdboge*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf283, 0, m_cpdbr},
+/* 148 cpdbult*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf28c, 0, m_cpdbr},
+/* 149 cpdbolt*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf284, 0, m_cpdbr},
+/* 150 cpdbuge*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf28b, 0, m_cpdbr},
+/* 151 cpdbole*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf285, 0, m_cpdbr},
+/* 152 cpdbugt*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf28a, 0, m_cpdbr},
+/* 153 cpdbogl*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf286, 0, m_cpdbr},
+/* 154 cpdbueq*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf289, 0, m_cpdbr},
+/* 155 cpdbor*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf287, 0, m_cpdbr},
+/* 156 cpdbun*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf288, 0, m_cpdbr},
+/* 157 cpdbt */  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf28f, 0, m_cpdbr},
+/* 158 cpdbf */  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf280, 0, m_cpdbr},
+/* 159 cpdbsf*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf290, 0, m_cpdbr},
+/* 160 cpdbst*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf29f, 0, m_cpdbr},
+/* 161 cpdbseq*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf291, 0, m_cpdbr},
+/* 162 cpdbsne*/  {SIZN|SIZB|SIZW, M_DREG, C_LABEL, 0xf29e, 0, m_cpdbr},
+/* 163 cprestore*/  {SIZN, C_ALL030, M_AM_NONE, 0xf340, 0, m_cprest},
+/* 164 cpsave*/  {SIZN, C_ALL030, M_AM_NONE, 0xf300, 0, m_cprest},
+/* 165 cpsbs */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf240, 0, m_fscc},
+/* 166 cpsbc */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf242, 0, m_fscc},
+/* 167 cpsls */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf244, 0, m_fscc},
+/* 168 cpslc */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf246, 0, m_fscc},
+/* 169 cpsss */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf248, 0, m_fscc},
+/* 170 cpssc */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf24a, 0, m_fscc},
+/* 171 cpsas */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf24c, 0, m_fscc},
+/* 172 cpsac */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf24e, 0, m_fscc},
+/* 173 cpsws */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf250, 0, m_fscc},
+/* 174 cpswc */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf252, 0, m_fscc},
+/* 175 cpsis */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf254, 0, m_fscc},
+/* 176 cpsic */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf256, 0, m_fscc},
+/* 177 cpsgc */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf258, 0, m_fscc},
+/* 178 cpsgs */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf25a, 0, m_fscc},
+/* 179 cpscs */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf25c, 0, m_fscc},
+/* 180 cpscc */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf25e, 0, m_fscc},
+/* 181 cpushl*/  {SIZN, CACHES, M_AIND, 0xf408, 0, m_cinv},
+/* 182 cpushp*/  {SIZN, CACHES, M_AIND, 0xf410, 0, m_cinv},
+/* 183 cpusha*/  {SIZN, CACHES, M_AM_NONE, 0xf418, 0, m_cinv},
+/* 184 dbcc  */  {SIZN|SIZW, M_DREG, C_LABEL, 0x54c8, 0, m_dbra},
+/* 185 dbcs  */  {SIZN|SIZW, M_DREG, C_LABEL, 0x55c8, 0, m_dbra},
+/* 186 dbeq  */  {SIZN|SIZW, M_DREG, C_LABEL, 0x57c8, 0, m_dbra},
+/* 187 dbf   */  {SIZN|SIZW, M_DREG, C_LABEL, 0x51c8, 0, m_dbra},
+/* 188 dbge  */  {SIZN|SIZW, M_DREG, C_LABEL, 0x5cc8, 0, m_dbra},
+/* 189 dbgt  */  {SIZN|SIZW, M_DREG, C_LABEL, 0x5ec8, 0, m_dbra},
+/* 190 dbhi  */  {SIZN|SIZW, M_DREG, C_LABEL, 0x52c8, 0, m_dbra},
+/* 191 dble  */  {SIZN|SIZW, M_DREG, C_LABEL, 0x5fc8, 0, m_dbra},
+/* 192 dbls  */  {SIZN|SIZW, M_DREG, C_LABEL, 0x53c8, 0, m_dbra},
+/* 193 dblt  */  {SIZN|SIZW, M_DREG, C_LABEL, 0x5dc8, 0, m_dbra},
+/* 194 dbmi  */  {SIZN|SIZW, M_DREG, C_LABEL, 0x5bc8, 0, m_dbra},
+/* 195 dbne  */  {SIZN|SIZW, M_DREG, C_LABEL, 0x56c8, 0, m_dbra},
+/* 196 dbpl  */  {SIZN|SIZW, M_DREG, C_LABEL, 0x5ac8, 0, m_dbra},
+/* 197 dbt   */  {SIZN|SIZW, M_DREG, C_LABEL, 0x50c8, 0, m_dbra},
+/* 198 dbvc  */  {SIZN|SIZW, M_DREG, C_LABEL, 0x58c8, 0, m_dbra},
+/* 199 dbvs  */  {SIZN|SIZW, M_DREG, C_LABEL, 0x59c8, 0, m_dbra},
+/* 200 divs  */  {SIZN|SIZW, C_DATA, M_DREG, 0x81d8, 201, m_ea},
+/* 201 -     */  {SIZL, C_DATA030, M_DREG, 0x4f40, 0, m_muls},
+/* 202 divsl */  {SIZN|SIZL, C_DATA030, M_DREG, 0x4e40, 0, m_muls},
+/* 203 divu  */  {SIZN|SIZW, C_DATA, M_DREG, 0x80d8, 204, m_ea},
+/* 204 -     */  {SIZL, C_DATA030, M_DREG, 0x4d40, 0, m_muls},
+/* 205 divul */  {SIZL|SIZN, C_DATA030, M_DREG, 0x4c40, 0, m_muls},
+/* 206 eor   */  {SIZN|SIZB|SIZW|SIZL, M_DREG, C_ALTDATA, 0xb115, 207, m_ea},
+/* 207 eori  */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, C_ALTDATA, 0x0a07, 208, m_ea},
+/* 208 -     */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, C_ALT030, 0x0a06, 209, m_ea030},
+/* 209 -     */  {SIZN|SIZB, M_IMMED, M_AM_CCR, 0x0a3c, 210, m_imm8},
+/* 210 -     */  {SIZN|SIZW, M_IMMED, M_AM_SR, 0x0a7c, 0, m_imm},
+/* 211 exg   */  {SIZN|SIZL, M_DREG|M_AREG, M_DREG|M_AREG, 0xc100, 0, m_exg},
+/* 212 ext   */  {SIZN|SIZW, M_DREG, M_AM_NONE, 0x4880, 213, m_reg},
+/* 213 -     */  {SIZL, M_DREG, M_AM_NONE, 0x48c0, 0, m_reg},
+/* 214 extb  */  {SIZN|SIZL, M_DREG, M_AM_NONE, 0x49c0, 0, m_reg},
+/* 215 fabs  */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 216, m_fabs},
+/* 216 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 217, m_fabs},
+/* 217 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fabs},
+/* 218 fsabs */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 219, m_fsabs},
+/* 219 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 220, m_fsabs},
+/* 220 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fsabs},
+/* 221 fdabs */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 222, m_fdabs},
+/* 222 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 223, m_fdabs},
+/* 223 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fdabs},
+/* 224 facos */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 225, m_facos},
+/* 225 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 226, m_facos},
+/* 226 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_facos},
+/* 227 fadd  */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 228, m_fadd},
+/* 228 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 0, m_fadd},
+/* 229 fsadd */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 230, m_fsadd},
+/* 230 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 0, m_fsadd},
+/* 231 fdadd */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 232, m_fdadd},
+/* 232 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 0, m_fdadd},
+/* 233 fasin */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 234, m_fasin},
+/* 234 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 235, m_fasin},
+/* 235 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fasin},
+/* 236 fatan */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 237, m_fatan},
+/* 237 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 238, m_fatan},
+/* 238 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fatan},
+/* 239 fatanh*/  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 240, m_fatanh},
+/* 240 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 241, m_fatanh},
+/* 241 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fatanh},
+/* 242 fbeq  */  {SIZN|SIZB|SIZW, C_LABEL, M_AM_NONE, 0xf281, 0, m_fbcc},
+/* 243 fbge  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf293, 0, m_fbcc},
+/* 244 fbgt  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf292, 0, m_fbcc},
+/* 245 fbgl  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf296, 0, m_fbcc},
+/* 246 fbgle */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf297, 0, m_fbcc},
+/* 247 fble  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf295, 0, m_fbcc},
+/* 248 fblt  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf294, 0, m_fbcc},
+/* 249 fbne  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf28e, 0, m_fbcc},
+/* 250 fbngt */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf29d, 0, m_fbcc},
+/* 251 fbnge */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf29c, 0, m_fbcc},
+/* 252 fbngl */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf299, 0, m_fbcc},
+/* 253 fbnle */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf29a, 0, m_fbcc},
+/* 254 fbnlt */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf29b, 0, m_fbcc},
+/* 255 fbngle*/  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf298, 0, m_fbcc},
+/* 256 fbogt */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf282, 0, m_fbcc},
+/* 257 fbule */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf28d, 0, m_fbcc},
+/* 258 fboge */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf283, 0, m_fbcc},
+/* 259 fbult */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf28c, 0, m_fbcc},
+/* 260 fbolt */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf284, 0, m_fbcc},
+/* 261 fbuge */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf28b, 0, m_fbcc},
+/* 262 fbole */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf285, 0, m_fbcc},
+/* 263 fbugt */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf28a, 0, m_fbcc},
+/* 264 fbogl */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf286, 0, m_fbcc},
+/* 265 fbueq */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf289, 0, m_fbcc},
+/* 266 fbor  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf287, 0, m_fbcc},
+/* 267 fbun  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf288, 0, m_fbcc},
+/* 268 fbt   */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf28f, 0, m_fbcc},
+/* 269 fbf   */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf280, 0, m_fbcc},
+/* 270 fbsf  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf290, 0, m_fbcc},
+/* 271 fbst  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf29f, 0, m_fbcc},
+/* 272 fbseq */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf291, 0, m_fbcc},
+/* 273 fbsne */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf29e, 0, m_fbcc},
+/* 274 fcmp  */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 275, m_fcmp},
+/* 275 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 0, m_fcmp},
+/* 276 fcos  */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 277, m_fcos},
+/* 277 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 278, m_fcos},
+/* 278 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fcos},
+/* 279 fcosh */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 280, m_fcosh},
+/* 280 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 281, m_fcosh},
+/* 281 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fcosh},
+/* 282 fdbeq */  {SIZN, M_DREG, C_LABEL, 0xf241, 0, m_fdbcc},
+/* 283 fdbge */  {SIZN, M_DREG, C_LABEL, 0xf253, 0, m_fdbcc},
+/* 284 fdbgt */  {SIZN, M_DREG, C_LABEL, 0xf252, 0, m_fdbcc},
+/* 285 fdbgl */  {SIZN, M_DREG, C_LABEL, 0xf256, 0, m_fdbcc},
+/* 286 fdbgle*/  {SIZN, M_DREG, C_LABEL, 0xf257, 0, m_fdbcc},
+/* 287 fdble */  {SIZN, M_DREG, C_LABEL, 0xf255, 0, m_fdbcc},
+/* 288 fdblt */  {SIZN, M_DREG, C_LABEL, 0xf254, 0, m_fdbcc},
+/* 289 fdbne */  {SIZN, M_DREG, C_LABEL, 0xf24e, 0, m_fdbcc},
+/* 290 fdbngt*/  {SIZN, M_DREG, C_LABEL, 0xf25d, 0, m_fdbcc},
+/* 291 fdbnge*/  {SIZN, M_DREG, C_LABEL, 0xf25c, 0, m_fdbcc},
+/* 292 fdbngl*/  {SIZN, M_DREG, C_LABEL, 0xf259, 0, m_fdbcc},
+/* 293 fdbnle*/  {SIZN, M_DREG, C_LABEL, 0xf25a, 0, m_fdbcc},
+/* 294 fdbnlt*/  {SIZN, M_DREG, C_LABEL, 0xf25b, 0, m_fdbcc},
+/* 295 fdbngle*/  {SIZN, M_DREG, C_LABEL, 0xf258, 0, m_fdbcc},
+/* 296 fdbogt*/  {SIZN, M_DREG, C_LABEL, 0xf242, 0, m_fdbcc},
+/* 297 fdbule*/  {SIZN, M_DREG, C_LABEL, 0xf24d, 0, m_fdbcc},
+/* 298 fdboge*/  {SIZN, M_DREG, C_LABEL, 0xf243, 0, m_fdbcc},
+/* 299 fdbult*/  {SIZN, M_DREG, C_LABEL, 0xf24c, 0, m_fdbcc},
+/* 300 fdbolt*/  {SIZN, M_DREG, C_LABEL, 0xf244, 0, m_fdbcc},
+/* 301 fdbuge*/  {SIZN, M_DREG, C_LABEL, 0xf24b, 0, m_fdbcc},
+/* 302 fdbole*/  {SIZN, M_DREG, C_LABEL, 0xf245, 0, m_fdbcc},
+/* 303 fdbugt*/  {SIZN, M_DREG, C_LABEL, 0xf24a, 0, m_fdbcc},
+/* 304 fdbogl*/  {SIZN, M_DREG, C_LABEL, 0xf246, 0, m_fdbcc},
+/* 305 fdbueq*/  {SIZN, M_DREG, C_LABEL, 0xf249, 0, m_fdbcc},
+/* 306 fdbor */  {SIZN, M_DREG, C_LABEL, 0xf247, 0, m_fdbcc},
+/* 307 fdbun */  {SIZN, M_DREG, C_LABEL, 0xf248, 0, m_fdbcc},
+/* 308 fdbt  */  {SIZN, M_DREG, C_LABEL, 0xf24f, 0, m_fdbcc},
+/* 309 fdbra */  {SIZN, M_DREG, C_LABEL, 0xf240, 0, m_fdbcc},
+/* 310 fdbf  */  {SIZN, M_DREG, C_LABEL, 0xf240, 0, m_fdbcc},
+/* 311 fdbsf */  {SIZN, M_DREG, C_LABEL, 0xf250, 0, m_fdbcc},
+/* 312 fdbst */  {SIZN, M_DREG, C_LABEL, 0xf25f, 0, m_fdbcc},
+/* 313 fdbseq*/  {SIZN, M_DREG, C_LABEL, 0xf251, 0, m_fdbcc},
+/* 314 fdbsne*/  {SIZN, M_DREG, C_LABEL, 0xf25e, 0, m_fdbcc},
+/* 315 fdiv  */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 316, m_fdiv},
+/* 316 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 317, m_fdiv},
+/* 317 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fdiv},
+/* 318 fsdiv */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 319, m_fsdiv},
+/* 319 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 320, m_fsdiv},
+/* 320 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fsdiv},
+/* 321 fddiv */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 322, m_fddiv},
+/* 322 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 323, m_fddiv},
+/* 323 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fddiv},
+/* 324 fetox */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 325, m_fetox},
+/* 325 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 326, m_fetox},
+/* 326 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fetox},
+/* 327 fetoxm1*/  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 328, m_fetoxm1},
+/* 328 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 329, m_fetoxm1},
+/* 329 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fetoxm1},
+/* 330 fgetexp*/  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 331, m_fgetexp},
+/* 331 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 332, m_fgetexp},
+/* 332 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fgetexp},
+/* 333 fgetman*/  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 334, m_fgetman},
+/* 334 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 335, m_fgetman},
+/* 335 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fgetman},
+/* 336 fint  */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 337, m_fint},
+/* 337 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 338, m_fint},
+/* 338 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fint},
+/* 339 fintrz*/  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 340, m_fintrz},
+/* 340 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 341, m_fintrz},
+/* 341 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fintrz},
+/* 342 flog10*/  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 343, m_flog10},
+/* 343 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 344, m_flog10},
+/* 344 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_flog10},
+/* 345 flog2 */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 346, m_flog2},
+/* 346 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 347, m_flog2},
+/* 347 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_flog2},
+/* 348 flogn */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 349, m_flogn},
+/* 349 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 350, m_flogn},
+/* 350 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_flogn},
+/* 351 flognp1*/  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 352, m_flognp1},
+/* 352 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 353, m_flognp1},
+/* 353 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_flognp1},
+/* 354 fmod  */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 355, m_fmod},
+/* 355 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 356, m_fmod},
+/* 356 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fmod},
+/* 357 fmove */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 358, m_fmove},
+/* 358 -     */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, M_FREG, C_ALT030, 0xf200, 359, m_fmove},
+/* 359 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 360, m_fmove},
+/* 360 -     */  {SIZN|SIZL, M_FPSCR, C_ALT030, 0xf200, 361, m_fmovescr},
+/* 361 -     */  {SIZN|SIZL, C_ALL030, M_FPSCR, 0xf200, 362, m_fmovescr},
+/* 362 fsmove*/  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 0, m_fsmove},
+/* 363 fdmove*/  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 0, m_fdmove},
+/* 364 fmovecr*/  {SIZN|SIZX, M_IMMED, M_FREG, 0xf200, 0, m_fmovecr},
+/* 365 fmovem*/  {CGSPECIAL, M_AM_NONE, M_AM_NONE, 0xf200, 0, m_fmovem},
+/* 366 fmul  */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 367, m_fmul},
+/* 367 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 0, m_fmul},
+/* 368 fsmul */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 369, m_fsmul},
+/* 369 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 0, m_fsmul},
+/* 370 fdmul */  {SIZN|SIZX, C_ALL030, M_FREG, 0xf200, 371, m_fdmul},
+/* 371 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 0, m_fdmul},
+/* 372 fneg  */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 373, m_fneg},
+/* 373 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 374, m_fneg},
+/* 374 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fneg},
+/* 375 fsneg */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 376, m_fsneg},
+/* 376 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 377, m_fsneg},
+/* 377 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fsneg},
+/* 378 fdneg */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 379, m_fdneg},
+/* 379 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 380, m_fdneg},
+/* 380 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fdneg},
+/* 381 fnop  */  {SIZN, M_AM_NONE, M_AM_NONE, 0xf280, 0, m_fnop},
+/* 382 frem  */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 383, m_frem},
+/* 383 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 0, m_frem},
+/* 384 fscale*/  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 385, m_fscale},
+/* 385 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 0, m_fscale},
+/* 386 fseq  */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf241, 0, m_fscc},
+/* 387 fsne  */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf24e, 0, m_fscc},
+/* 388 fsgt  */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf252, 0, m_fscc},
+/* 389 fsngt */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf25d, 0, m_fscc},
+/* 390 fsge  */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf253, 0, m_fscc},
+/* 391 fsnge */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf25c, 0, m_fscc},
+/* 392 fslt  */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf254, 0, m_fscc},
+/* 393 fsnlt */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf25b, 0, m_fscc},
+/* 394 fsle  */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf255, 0, m_fscc},
+/* 395 fsnle */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf25a, 0, m_fscc},
+/* 396 fsgl  */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf256, 0, m_fscc},
+/* 397 fsngl */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf259, 0, m_fscc},
+/* 398 fsgle */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf257, 0, m_fscc},
+/* 399 fsngle*/  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf258, 0, m_fscc},
+/* 400 fsogt */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf242, 0, m_fscc},
+/* 401 fsule */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf24d, 0, m_fscc},
+/* 402 fsoge */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf243, 0, m_fscc},
+/* 403 fsult */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf24c, 0, m_fscc},
+/* 404 fsolt */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf244, 0, m_fscc},
+/* 405 fsuge */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf24b, 0, m_fscc},
+/* 406 fsole */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf245, 0, m_fscc},
+/* 407 fsugt */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf24a, 0, m_fscc},
+/* 408 fsogl */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf246, 0, m_fscc},
+/* 409 fsueq */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf249, 0, m_fscc},
+/* 410 fsor  */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf247, 0, m_fscc},
+/* 411 fsun  */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf248, 0, m_fscc},
+/* 412 fsf   */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf240, 0, m_fscc},
+/* 413 fst   */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf24f, 0, m_fscc},
+/* 414 fssf  */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf250, 0, m_fscc},
+/* 415 fsst  */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf25f, 0, m_fscc},
+/* 416 fsseq */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf251, 0, m_fscc},
+/* 417 fssne */  {SIZN|SIZB, C_ALL030, M_AM_NONE, 0xf25e, 0, m_fscc},
+/* 418 fsgldiv*/  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 419, m_fsgldiv},
+/* 419 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 0, m_fsgldiv},
+/* 420 fsglmul*/  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 421, m_fsglmul},
+/* 421 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 0, m_fsglmul},
+/* 422 fsin  */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 423, m_fsin},
+/* 423 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 424, m_fsin},
+/* 424 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fsin},
+/* 425 fsincos*/  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 426, m_fsincos},
+/* 426 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 0, m_fsincos},
+/* 427 fsinh */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 428, m_fsinh},
+/* 428 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 429, m_fsinh},
+/* 429 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fsinh},
+/* 430 fsqrt */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 431, m_fsqrt},
+/* 431 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 432, m_fsqrt},
+/* 432 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fsqrt},
+/* 433 fssqrt*/  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 434, m_fsfsqrt},
+/* 434 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 435, m_fsfsqrt},
+/* 435 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fsfsqrt},
+/* 436 fdsqrt*/  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 437, m_fdfsqrt},
+/* 437 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 438, m_fdfsqrt},
+/* 438 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_fdfsqrt},
+/* 439 fsub  */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 440, m_fsub},
+/* 440 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 0, m_fsub},
+/* 441 fssub */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 442, m_fsub},
+/* 442 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 0, m_fsub},
+/* 443 fdsub */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 444, m_fdsub},
+/* 444 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 0, m_fdsub},
+/* 445 ftan  */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 446, m_ftan},
+/* 446 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 447, m_ftan},
+/* 447 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_ftan},
+/* 448 ftanh */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 449, m_ftanh},
+/* 449 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 450, m_ftanh},
+/* 450 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_ftanh},
+/* 451 ftentox*/  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 452, m_ftentox},
+/* 452 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 453, m_ftentox},
+/* 453 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_ftentox},
+/* 454 ftst  */  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_AM_NONE, 0xf200, 455, m_ftst},
+/* 455 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_ftst},
+/* 456 ftwotox*/  {SIZN|SIZB|SIZW|SIZL|SIZS|SIZD|SIZX|SIZP, C_ALL030, M_FREG, 0xf200, 457, m_ftwotox},
+/* 457 -     */  {SIZN|SIZX, M_FREG, M_FREG, 0xf200, 458, m_ftwotox},
+/* 458 -     */  {SIZN|SIZX, M_FREG, M_AM_NONE, 0xf200, 0, m_ftwotox},
+/* 459 ftrapeq*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf208, 0, m_ftrapcc},
+/* 460 ftrapze*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf208, 0, m_ftrapcc},
+/* 461 ftrapz*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf208, 0, m_ftrapcc},
+/* 462 ftrapge*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf270, 0, m_ftrapcc},
+/* 463 ftrapgt*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf290, 0, m_ftrapcc},
+/* 464 ftrapgl*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf2e8, 0, m_ftrapcc},
+/* 465 ftrapgle*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf298, 0, m_ftrapcc},
+/* 466 ftraple*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf2e0, 0, m_ftrapcc},
+/* 467 ftraplt*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf2a0, 0, m_ftrapcc},
+/* 468 ftrapne*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf2d8, 0, m_ftrapcc},
+/* 469 ftrapngt*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf2a8, 0, m_ftrapcc},
+/* 470 ftrapnge*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf2d0, 0, m_ftrapcc},
+/* 471 ftrapngl*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf2b0, 0, m_ftrapcc},
+/* 472 ftrapnle*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf2c8, 0, m_ftrapcc},
+/* 473 ftrapnlt*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf2b8, 0, m_ftrapcc},
+/* 474 ftrapngle*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf2c0, 0, m_ftrapcc},
+/* 475 ftrapogt*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf210, 0, m_ftrapcc},
+/* 476 ftrapule*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf268, 0, m_ftrapcc},
+/* 477 ftrapoge*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf218, 0, m_ftrapcc},
+/* 478 ftrapult*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf260, 0, m_ftrapcc},
+/* 479 ftrapolt*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf220, 0, m_ftrapcc},
+/* 480 ftrapuge*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf258, 0, m_ftrapcc},
+/* 481 ftrapole*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf228, 0, m_ftrapcc},
+/* 482 ftrapugt*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf250, 0, m_ftrapcc},
+/* 483 ftrapogl*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf230, 0, m_ftrapcc},
+/* 484 ftrapueq*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf248, 0, m_ftrapcc},
+/* 485 ftrapor*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf238, 0, m_ftrapcc},
+/* 486 ftrapun*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf240, 0, m_ftrapcc},
+/* 487 ftrapt*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf200, 0, m_ftrapcc},
+/* 488 ftrapf*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf278, 0, m_ftrapcc},
+/* 489 ftrapsf*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf280, 0, m_ftrapcc},
+/* 490 ftrapst*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf2f8, 0, m_ftrapcc},
+/* 491 ftrapseq*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf288, 0, m_ftrapcc},
+/* 492 ftrapsne*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf2f0, 0, m_ftrapcc},
+/* 493 frestore*/  {SIZN, C_DATA030, M_AM_NONE, 0xf340, 0, m_frestore},
+/* 494 fsave */  {SIZN, C_DATA030, M_AM_NONE, 0xf300, 0, m_frestore},
+/* 495 illegal*/  {SIZN, M_AM_NONE, M_AM_NONE, 0x4afc, 0, m_self},
+/* 496 jmp   */  {SIZN, C_CTRL, M_AM_NONE, 0x4ec0, 497, m_ea},
+/* 497 -     */  {SIZN, C_CTRL030, M_AM_NONE, 0x4ec0, 0, m_ea030},
+/* 498 jsr   */  {SIZN, C_CTRL, M_AM_NONE, 0x4e80, 499, m_ea},
+/* 499 -     */  {SIZN, C_CTRL030, M_AM_NONE, 0x4e80, 0, m_ea030},
+/* 500 lea   */  {SIZN|SIZL, C_CTRL, M_AREG, 0x41d8, 0, m_lea},
+/* 501 link  */  {SIZN|SIZW|SIZL, M_AREG, M_IMMED, 0x4e50, 0, m_link},
+/* 502 lpstop*/  {SIZN|SIZW, M_IMMED, M_AM_NONE, 0xf800, 0, m_lpstop},
+/* 503 lsl   */  {SIZN|SIZB|SIZW|SIZL, M_DREG, M_DREG, 0xe128, 504, m_shr},
+/* 504 -     */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, M_DREG, 0xe108, 505, m_shi},
+/* 505 -     */  {SIZN|SIZB|SIZW|SIZL, C_ALTMEM, M_AM_NONE, 0xe3c0, 506, m_ea},
+/* 506 -     */  {SIZN|SIZB|SIZW|SIZL, M_DREG, M_AM_NONE, 0xe309, 0, m_reg},
+/* 507 lsr   */  {SIZN|SIZB|SIZW|SIZL, M_DREG, M_DREG, 0xe028, 508, m_shr},
+/* 508 -     */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, M_DREG, 0xe008, 509, m_shi},
+/* 509 -     */  {SIZN|SIZB|SIZW|SIZL, C_ALTMEM, M_AM_NONE, 0xe2c0, 510, m_ea},
+/* 510 -     */  {SIZN|SIZB|SIZW|SIZL, M_DREG, M_AM_NONE, 0xe209, 0, m_reg},
+/* 511 move  */  {SIZN|SIZB|SIZW|SIZL, C_ALL, C_ALTDATA, 0x0000, 512, m_move},
+/* 512 -     */  {SIZN|SIZW|SIZL, C_ALL, M_AREG, 0x0040, 513, m_move},
+/* 513 -     */  {SIZN|SIZW, C_DATA, M_AM_SR, 0x46c0, 514, m_ea},
+/* 514 -     */  {SIZN|SIZW, M_AM_SR, C_ALTDATA, 0x40c1, 515, m_ea},
+/* 515 -     */  {SIZN|SIZW, C_DATA, M_AM_CCR, 0x44c0, 516, m_ea},
+/* 516 -     */  {SIZN|SIZL, M_AM_USP, M_AREG, 0x4e68, 517, m_usp},
+/* 517 -     */  {SIZN|SIZL, M_AREG, M_AM_USP, 0x4e60, 518, m_usp},
+/* 518 -     */  {SIZN|SIZB|SIZW|SIZL, C_ALL030, C_ALTDATA, 0x0000, 519, m_move30},
+/* 519 -     */  {SIZN|SIZB|SIZW|SIZL, C_ALL030, C_ALT030, 0x0000, 520, m_move30},
+/* 520 -     */  {SIZN|SIZW, M_AM_CCR, C_DATA030, 0x42c0, 0, m_ea030},
+/* 521 movea */  {SIZN|SIZW|SIZL, C_ALL, M_AREG, 0x0040, 0, m_move},
+/* 522 movec */  {SIZN|SIZL, M_DREG+M_AREG, C_CREG, 0x4e7b, 523, m_movec},
+/* 523 -     */  {SIZN|SIZL, C_CREG, M_DREG+M_AREG, 0x4e7a, 0, m_movec},
+/* 524 moves */  {SIZN|SIZB|SIZW|SIZL, M_DREG+M_AREG, C_MOVES, 0x0e00, 525, m_moves},
+/* 525 -     */  {SIZN|SIZB|SIZW|SIZL, C_MOVES, M_DREG+M_AREG, 0x0e00, 0, m_moves},
+/* 526 move16*/  {SIZN, APOSTINC, APOSTINC, 0xf620, 527, m_move16a},
+/* 527 -     */  {SIZN, AIND+APOSTINC+ABSL, AIND+APOSTINC+ABSL, 0xf600, 0, m_move16b},
+/* 528 movem */  {CGSPECIAL, M_AM_NONE, M_AM_NONE, 0x4880, 0, m_movem},
+/* 529 movep */  {SIZN|SIZW|SIZL, M_DREG, M_AIND|M_ADISP, 0x0188, 530, m_movep},
+/* 530 -     */  {SIZN|SIZW|SIZL, M_AIND|M_ADISP, M_DREG, 0x0108, 0, m_movep},
+/* 531 moveq */  {SIZN|SIZL, M_IMMED, M_DREG, 0x7000, 0, m_moveq},
+/* 532 muls  */  {SIZN|SIZW, C_DATA, M_DREG, 0xc1d8, 533, m_ea},
+/* 533 -     */  {SIZL, C_DATA030, M_DREG, 0x4f00, 0, m_muls},
+/* 534 mulu  */  {SIZN|SIZW, C_DATA, M_DREG, 0xc0d8, 535, m_ea},
+/* 535 -     */  {SIZL, C_DATA030, M_DREG, 0x4d00, 0, m_muls},
+/* 536 nbcd  */  {SIZN|SIZB, C_ALTDATA, M_AM_NONE, 0x4800, 0, m_ea},
+/* 537 neg   */  {SIZN|SIZB|SIZW|SIZL, C_ALTDATA, M_AM_NONE, 0x4404, 0, m_ea},
+/* 538 negx  */  {SIZN|SIZB|SIZW|SIZL, C_ALTDATA, M_AM_NONE, 0x4004, 0, m_ea},
+/* 539 nop   */  {SIZN, M_AM_NONE, M_AM_NONE, 0x4e71, 0, m_self},
+/* 540 not   */  {SIZN|SIZB|SIZW|SIZL, C_ALTDATA, M_AM_NONE, 0x4604, 0, m_ea},
+/* 541 or    */  {SIZN|SIZB|SIZW|SIZL, C_DATA, M_DREG, 0x801c, 542, m_ea},
+/* 542 -     */  {SIZN|SIZB|SIZW|SIZL, M_DREG, C_MEM, 0x8115, 543, m_ea},
+/* 543 ori   */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, C_ALTDATA, 0x0007, 544, m_ea},
+/* 544 -     */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, C_ALT030, 0x0006, 545, m_ea030},
+/* 545 -     */  {SIZN|SIZB, M_IMMED, M_AM_CCR, 0x003c, 546, m_imm8},
+/* 546 -     */  {SIZN|SIZW, M_IMMED, M_AM_SR, 0x007c, 0, m_imm},
+/* 547 pack  */  {CGSPECIAL, M_AM_NONE, M_AM_NONE, 0x8140, 0, m_pack},
+/* 548 pbbs  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf080, 0, m_pbcc},
+/* 549 pbbc  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf081, 0, m_pbcc},
+/* 550 pbls  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf082, 0, m_pbcc},
+/* 551 pblc  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf083, 0, m_pbcc},
+/* 552 pbss  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf084, 0, m_pbcc},
+/* 553 pbsc  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf085, 0, m_pbcc},
+/* 554 pbas  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf086, 0, m_pbcc},
+/* 555 pbac  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf087, 0, m_pbcc},
+/* 556 pbws  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf088, 0, m_pbcc},
+/* 557 pbwc  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf089, 0, m_pbcc},
+/* 558 pbis  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf08a, 0, m_pbcc},
+/* 559 pbic  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf08b, 0, m_pbcc},
+/* 560 pbgs  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf08c, 0, m_pbcc},
+/* 561 pbgc  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf08d, 0, m_pbcc},
+/* 562 pbcs  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf08e, 0, m_pbcc},
+/* 563 pbcc  */  {SIZN|SIZW|SIZL, C_LABEL, M_AM_NONE, 0xf08f, 0, m_pbcc},
+/* 564 pdbbs */  {SIZN|SIZW|SIZL, M_DREG, C_LABEL, 0xf048, 0, m_cpdbr},
+/* 565 pdbls */  {SIZN|SIZW|SIZL, M_DREG, C_LABEL, 0xf048, 0, m_cpdbr},
+/* 566 pdbss */  {SIZN|SIZW|SIZL, M_DREG, C_LABEL, 0xf048, 0, m_cpdbr},
+/* 567 pdbas */  {SIZN|SIZW|SIZL, M_DREG, C_LABEL, 0xf048, 0, m_cpdbr},
+/* 568 pdbws */  {SIZN|SIZW|SIZL, M_DREG, C_LABEL, 0xf048, 0, m_cpdbr},
+/* 569 pdbis */  {SIZN|SIZW|SIZL, M_DREG, C_LABEL, 0xf048, 0, m_cpdbr},
+/* 570 pdbgs */  {SIZN|SIZW|SIZL, M_DREG, C_LABEL, 0xf048, 0, m_cpdbr},
+/* 571 pdbcs */  {SIZN|SIZW|SIZL, M_DREG, C_LABEL, 0xf048, 0, m_cpdbr},
+/* 572 pdbbc */  {SIZN|SIZW|SIZL, M_DREG, C_LABEL, 0xf048, 0, m_cpdbr},
+/* 573 pdblc */  {SIZN|SIZW|SIZL, M_DREG, C_LABEL, 0xf048, 0, m_cpdbr},
+/* 574 pdbsc */  {SIZN|SIZW|SIZL, M_DREG, C_LABEL, 0xf048, 0, m_cpdbr},
+/* 575 pdbac */  {SIZN|SIZW|SIZL, M_DREG, C_LABEL, 0xf048, 0, m_cpdbr},
+/* 576 pdbwc */  {SIZN|SIZW|SIZL, M_DREG, C_LABEL, 0xf048, 0, m_cpdbr},
+/* 577 pdbic */  {SIZN|SIZW|SIZL, M_DREG, C_LABEL, 0xf048, 0, m_cpdbr},
+/* 578 pdbgc */  {SIZN|SIZW|SIZL, M_DREG, C_LABEL, 0xf048, 0, m_cpdbr},
+/* 579 pdbcc */  {SIZN|SIZW|SIZL, M_DREG, C_LABEL, 0xf048, 0, m_cpdbr},
+/* 580 pflush*/  {CGSPECIAL, M_AM_NONE, M_AM_NONE, 0xf000, 0, m_pflush},
+/* 581 pflushn*/  {CGSPECIAL, M_AM_NONE, M_AM_NONE, 0xf507, 0, m_pflush},
+/* 582 pflushan*/  {SIZN, M_AM_NONE, M_AM_NONE, 0xf510, 0, m_pflushan},
+/* 583 pflusha*/  {SIZN, M_AM_NONE, M_AM_NONE, 0xf000, 0, m_pflusha},
+/* 584 pflushr*/  {SIZN, C_ALL030, M_AM_NONE, 0xf000, 0, m_pflushr},
+/* 585 ploadr*/  {SIZN, M_FC, C_PMOVE, 0xf000, 0, m_ploadr},
+/* 586 ploadw*/  {SIZN, M_FC, C_PMOVE, 0xf000, 0, m_ploadw},
+/* 587 plpa  */  {SIZN, M_AIND, M_AM_NONE, 0xf588, 0, m_plpa},
+/* 588 pmove */  {SIZN|SIZW|SIZL|SIZD, M_MRN, C_PMOVE, 0xf000, 589, m_pmove},
+/* 589 -     */  {SIZN|SIZW|SIZL|SIZD, C_PMOVE, M_MRN, 0xf000, 0, m_pmove},
+/* 590 pmovefd*/  {SIZN|SIZW|SIZL|SIZD, C_PMOVE, M_MRN, 0xf000, 0, m_pmovefd},
+/* 591 prestore*/  {SIZN, C_ALL030, M_AM_NONE, 0xf140, 0, m_ea},
+/* 592 psave */  {SIZN, C_ALL030, M_AM_NONE, 0xf100, 0, m_ea},
+/* 593 psbs  */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf040, 0, m_fscc},
+/* 594 psbc  */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf042, 0, m_fscc},
+/* 595 psls  */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf044, 0, m_fscc},
+/* 596 pslc  */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf046, 0, m_fscc},
+/* 597 psss  */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf048, 0, m_fscc},
+/* 598 pssc  */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf04a, 0, m_fscc},
+/* 599 psas  */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf04c, 0, m_fscc},
+/* 600 psac  */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf04e, 0, m_fscc},
+/* 601 psws  */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf050, 0, m_fscc},
+/* 602 pswc  */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf052, 0, m_fscc},
+/* 603 psis  */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf054, 0, m_fscc},
+/* 604 psic  */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf056, 0, m_fscc},
+/* 605 psgc  */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf058, 0, m_fscc},
+/* 606 psgs  */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf05a, 0, m_fscc},
+/* 607 pscs  */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf05c, 0, m_fscc},
+/* 608 pscc  */  {SIZB|SIZN, C_MOVES, M_AM_NONE, 0xf05e, 0, m_fscc},
+/* 609 ptestr*/  {SIZN, M_FC, C_PMOVE, 0xf000, 0, m_ptestr},
+/* 610 ptestw*/  {SIZN, M_FC, C_PMOVE, 0xf000, 0, m_ptestw},
+/* 611 ptrapbs*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf060, 0, m_ptrapcc},
+/* 612 ptrapbc*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf061, 0, m_ptrapcc},
+/* 613 ptrapls*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf062, 0, m_ptrapcc},
+/* 614 ptraplc*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf063, 0, m_ptrapcc},
+/* 615 ptrapss*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf064, 0, m_ptrapcc},
+/* 616 ptrapsc*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf065, 0, m_ptrapcc},
+/* 617 ptrapas*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf066, 0, m_ptrapcc},
+/* 618 ptrapac*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf067, 0, m_ptrapcc},
+/* 619 ptrapws*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf068, 0, m_ptrapcc},
+/* 620 ptrapwc*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf069, 0, m_ptrapcc},
+/* 621 ptrapis*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf06a, 0, m_ptrapcc},
+/* 622 ptrapic*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf06b, 0, m_ptrapcc},
+/* 623 ptrapgc*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf06c, 0, m_ptrapcc},
+/* 624 ptrapgs*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf06d, 0, m_ptrapcc},
+/* 625 ptrapcs*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf06e, 0, m_ptrapcc},
+/* 626 ptrapcc*/  {SIZW|SIZL|SIZN, M_IMMED|M_AM_NONE, M_AM_NONE, 0xf06f, 0, m_ptrapcc},
+/* 627 pea   */  {SIZN|SIZL, C_CTRL, M_AM_NONE, 0x4840, 0, m_ea},
+/* 628 reset */  {SIZN, M_AM_NONE, M_AM_NONE, 0x4e70, 0, m_self},
+/* 629 rol   */  {SIZN|SIZB|SIZW|SIZL, M_DREG, M_DREG, 0xe138, 630, m_shr},
+/* 630 -     */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, M_DREG, 0xe118, 631, m_shi},
+/* 631 -     */  {SIZN|SIZB|SIZW|SIZL, C_ALTMEM, M_AM_NONE, 0xe7c0, 632, m_ea},
+/* 632 -     */  {SIZN|SIZB|SIZW|SIZL, M_DREG, M_AM_NONE, 0xe319, 0, m_reg},
+/* 633 ror   */  {SIZN|SIZB|SIZW|SIZL, M_DREG, M_DREG, 0xe038, 634, m_shr},
+/* 634 -     */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, M_DREG, 0xe018, 635, m_shi},
+/* 635 -     */  {SIZN|SIZB|SIZW|SIZL, C_ALTMEM, M_AM_NONE, 0xe6c0, 636, m_ea},
+/* 636 -     */  {SIZN|SIZB|SIZW|SIZL, M_DREG, M_AM_NONE, 0xe219, 0, m_reg},
+/* 637 roxl  */  {SIZN|SIZB|SIZW|SIZL, M_DREG, M_DREG, 0xe130, 638, m_shr},
+/* 638 -     */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, M_DREG, 0xe110, 639, m_shi},
+/* 639 -     */  {SIZN|SIZB|SIZW|SIZL, C_ALTMEM, M_AM_NONE, 0xe5c0, 640, m_ea},
+/* 640 -     */  {SIZN|SIZB|SIZW|SIZL, M_DREG, M_AM_NONE, 0xe311, 0, m_reg},
+/* 641 roxr  */  {SIZN|SIZB|SIZW|SIZL, M_DREG, M_DREG, 0xe030, 642, m_shr},
+/* 642 -     */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, M_DREG, 0xe010, 643, m_shi},
+/* 643 -     */  {SIZN|SIZB|SIZW|SIZL, C_ALTMEM, M_AM_NONE, 0xe4c0, 644, m_ea},
+/* 644 -     */  {SIZN|SIZB|SIZW|SIZL, M_DREG, M_AM_NONE, 0xe211, 0, m_reg},
+/* 645 rtd   */  {SIZN, M_IMMED, M_AM_NONE, 0x4e74, 0, m_rtd},
+/* 646 rte   */  {SIZN, M_AM_NONE, M_AM_NONE, 0x4e73, 0, m_self},
+/* 647 rtm   */  {SIZN, M_DREG+M_AREG, M_AM_NONE, 0x06c0, 0, m_rtm},
+/* 648 rtr   */  {SIZN, M_AM_NONE, M_AM_NONE, 0x4e77, 0, m_self},
+/* 649 rts   */  {SIZN, M_AM_NONE, M_AM_NONE, 0x4e75, 0, m_self},
+/* 650 sbcd  */  {SIZN|SIZB, M_DREG, M_DREG, 0x8100, 651, m_abcd},
+/* 651 -     */  {SIZN|SIZB, M_APREDEC, M_APREDEC, 0x8108, 0, m_abcd},
+/* 652 scc   */  {SIZN|SIZB, C_ALTDATA, M_AM_NONE, 0x54c0, 0, m_ea},
+/* 653 scs   */  {SIZN|SIZB, C_ALTDATA, M_AM_NONE, 0x55c0, 0, m_ea},
+/* 654 seq   */  {SIZN|SIZB, C_ALTDATA, M_AM_NONE, 0x57c0, 0, m_ea},
+/* 655 sf    */  {SIZN|SIZB, C_ALTDATA, M_AM_NONE, 0x51c0, 0, m_ea},
+/* 656 sge   */  {SIZN|SIZB, C_ALTDATA, M_AM_NONE, 0x5cc0, 0, m_ea},
+/* 657 sgt   */  {SIZN|SIZB, C_ALTDATA, M_AM_NONE, 0x5ec0, 0, m_ea},
+/* 658 shi   */  {SIZN|SIZB, C_ALTDATA, M_AM_NONE, 0x52c0, 0, m_ea},
+/* 659 sle   */  {SIZN|SIZB, C_ALTDATA, M_AM_NONE, 0x5fc0, 0, m_ea},
+/* 660 sls   */  {SIZN|SIZB, C_ALTDATA, M_AM_NONE, 0x53c0, 0, m_ea},
+/* 661 slt   */  {SIZN|SIZB, C_ALTDATA, M_AM_NONE, 0x5dc0, 0, m_ea},
+/* 662 smi   */  {SIZN|SIZB, C_ALTDATA, M_AM_NONE, 0x5bc0, 0, m_ea},
+/* 663 sne   */  {SIZN|SIZB, C_ALTDATA, M_AM_NONE, 0x56c0, 0, m_ea},
+/* 664 spl   */  {SIZN|SIZB, C_ALTDATA, M_AM_NONE, 0x5ac0, 0, m_ea},
+/* 665 st    */  {SIZN|SIZB, C_ALTDATA, M_AM_NONE, 0x50c0, 0, m_ea},
+/* 666 svc   */  {SIZN|SIZB, C_ALTDATA, M_AM_NONE, 0x58c0, 0, m_ea},
+/* 667 svs   */  {SIZN|SIZB, C_ALTDATA, M_AM_NONE, 0x59c0, 0, m_ea},
+/* 668 stop  */  {SIZN, M_IMMED, M_AM_NONE, 0x4e72, 0, m_imm},
+/* 669 sub   */  {SIZN|SIZB|SIZW|SIZL, C_ALL, M_DREG, 0x901c, 670, m_ea},
+/* 670 -     */  {SIZN|SIZB|SIZW|SIZL, M_DREG, C_ALTMEM, 0x9115, 671, m_ea},
+/* 671 suba  */  {SIZN|SIZW|SIZL, C_ALL, M_AREG, 0x90c0, 672, m_adda},
+/* 672 subi  */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, C_ALTDATA, 0x0407, 673, m_ea},
+/* 673 -     */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, C_ALT030, 0x0407, 0, m_ea030},
+/* 674 subq  */  {SIZN|SIZB|SIZW|SIZL, M_IMMED, C_ALT, 0x5100, 0, m_addq},
+/* 675 subx  */  {SIZN|SIZB|SIZW|SIZL, M_DREG, M_DREG, 0x9101, 676, m_abcd},
+/* 676 -     */  {SIZN|SIZB|SIZW|SIZL, M_APREDEC, M_APREDEC, 0x9109, 0, m_abcd},
+/* 677 swap  */  {SIZN|SIZW, M_DREG, M_AM_NONE, 0x4840, 0, m_reg},
+/* 678 tas   */  {SIZN|SIZB, C_ALTDATA, M_AM_NONE, 0x4ac0, 0, m_ea},
+/* 679 trap  */  {SIZN, M_IMMED, M_AM_NONE, 0x4e40, 0, m_trap},
+/* 680 trapcc*/  {SIZN|SIZW|SIZL, M_IMMED, M_AM_NONE, 0x54f8, 681, m_trapcc},
+/* 681 -     */  {SIZN|SIZW|SIZL, M_AM_NONE, M_AM_NONE, 0x54fc, 0, m_self},
+/* 682 trapcs*/  {SIZN|SIZW|SIZL, M_IMMED, M_AM_NONE, 0x55f8, 683, m_trapcc},
+/* 683 -     */  {SIZN|SIZW|SIZL, M_AM_NONE, M_AM_NONE, 0x55fc, 0, m_self},
+/* 684 trapeq*/  {SIZN|SIZW|SIZL, M_IMMED, M_AM_NONE, 0x57f8, 685, m_trapcc},
+/* 685 -     */  {SIZN|SIZW|SIZL, M_AM_NONE, M_AM_NONE, 0x57fc, 0, m_self},
+/* 686 trapf */  {SIZN|SIZW|SIZL, M_IMMED, M_AM_NONE, 0x51f8, 687, m_trapcc},
+/* 687 -     */  {SIZN|SIZW|SIZL, M_AM_NONE, M_AM_NONE, 0x51fc, 0, m_self},
+/* 688 trapge*/  {SIZN|SIZW|SIZL, M_IMMED, M_AM_NONE, 0x5cf8, 689, m_trapcc},
+/* 689 -     */  {SIZN|SIZW|SIZL, M_AM_NONE, M_AM_NONE, 0x5cfc, 0, m_self},
+/* 690 trapgt*/  {SIZN|SIZW|SIZL, M_IMMED, M_AM_NONE, 0x5ef8, 691, m_trapcc},
+/* 691 -     */  {SIZN|SIZW|SIZL, M_AM_NONE, M_AM_NONE, 0x5efc, 0, m_self},
+/* 692 traphi*/  {SIZN|SIZW|SIZL, M_IMMED, M_AM_NONE, 0x52f8, 693, m_trapcc},
+/* 693 -     */  {SIZN|SIZW|SIZL, M_AM_NONE, M_AM_NONE, 0x52fc, 0, m_self},
+/* 694 traple*/  {SIZN|SIZW|SIZL, M_IMMED, M_AM_NONE, 0x5ff8, 695, m_trapcc},
+/* 695 -     */  {SIZN|SIZW|SIZL, M_AM_NONE, M_AM_NONE, 0x5ffc, 0, m_self},
+/* 696 trapls*/  {SIZN|SIZW|SIZL, M_IMMED, M_AM_NONE, 0x53f8, 697, m_trapcc},
+/* 697 -     */  {SIZN|SIZW|SIZL, M_AM_NONE, M_AM_NONE, 0x53fc, 0, m_self},
+/* 698 traplt*/  {SIZN|SIZW|SIZL, M_IMMED, M_AM_NONE, 0x5df8, 699, m_trapcc},
+/* 699 -     */  {SIZN|SIZW|SIZL, M_AM_NONE, M_AM_NONE, 0x5dfc, 0, m_self},
+/* 700 trapmi*/  {SIZN|SIZW|SIZL, M_IMMED, M_AM_NONE, 0x5bf8, 701, m_trapcc},
+/* 701 -     */  {SIZN|SIZW|SIZL, M_AM_NONE, M_AM_NONE, 0x5bfc, 0, m_self},
+/* 702 trapne*/  {SIZN|SIZW|SIZL, M_IMMED, M_AM_NONE, 0x56f8, 703, m_trapcc},
+/* 703 -     */  {SIZN|SIZW|SIZL, M_AM_NONE, M_AM_NONE, 0x56fc, 0, m_self},
+/* 704 trappl*/  {SIZN|SIZW|SIZL, M_IMMED, M_AM_NONE, 0x5af8, 705, m_trapcc},
+/* 705 -     */  {SIZN|SIZW|SIZL, M_AM_NONE, M_AM_NONE, 0x5afc, 0, m_self},
+/* 706 trapt */  {SIZN|SIZW|SIZL, M_IMMED, M_AM_NONE, 0x50f8, 707, m_trapcc},
+/* 707 -     */  {SIZN|SIZW|SIZL, M_AM_NONE, M_AM_NONE, 0x50fc, 0, m_self},
+/* 708 trapvc*/  {SIZN|SIZW|SIZL, M_IMMED, M_AM_NONE, 0x58f8, 709, m_trapcc},
+/* 709 -     */  {SIZN|SIZW|SIZL, M_AM_NONE, M_AM_NONE, 0x58fc, 0, m_self},
+/* 710 trapvs*/  {SIZN|SIZW|SIZL, M_IMMED, M_AM_NONE, 0x59f8, 711, m_trapcc},
+/* 711 -     */  {SIZN|SIZW|SIZL, M_AM_NONE, M_AM_NONE, 0x59fc, 0, m_self},
+/* 712 trapv */  {SIZN, M_AM_NONE, M_AM_NONE, 0x4e76, 0, m_self},
+/* 713 tst   */  {SIZN|SIZB|SIZW|SIZL, C_ALTDATA, M_AM_NONE, 0x4a04, 714, m_ea},
+/* 714 -     */  {SIZN|SIZB|SIZW|SIZL, C_ALL030, M_AM_NONE, 0x4a04, 0, m_ea030},
+/* 715 unlk  */  {SIZN, M_AREG, M_AM_NONE, 0x4e58, 0, m_reg},
+/* 716 unpk  */  {CGSPECIAL, M_AM_NONE, M_AM_NONE, 0x8180, 0, m_pack},
@@ -11,6 +11,7 @@
 #include "expr.h"
 #include "mach.h"
 #include "procln.h"
+#include "relax.h"
 #include "rmac.h"
 #include "sect.h"
 #include "token.h"
@@ -23,50 +24,58 @@
 extern char unsupport[];
 
 // Address-mode information
-int nmodes;					// Number of addr'ing modes found
-int am0;					// Addressing mode
-int a0reg;					// Register
-TOKEN a0expr[EXPRSIZE];		// Expression
-uint64_t a0exval;			// Expression's value
-WORD a0exattr;				// Expression's attribute
-int a0ixreg;				// Index register
-int a0ixsiz;				// Index register size (and scale)
-SYM * a0esym;				// External symbol involved in expr
-TOKEN a0bexpr[EXPRSIZE];	// Base displacement expression
-uint64_t a0bexval;			// Base displacement value
-WORD a0bexattr;				// Base displacement attribute
-WORD a0bsize;				// Base displacement size
-WORD a0extension;			// 020+ extension address word
-WORD am0_030;				// ea bits for 020+ addressing modes
-
-int am1;					// Addressing mode
-int a1reg;					// Register
-TOKEN a1expr[EXPRSIZE];		// Expression
-uint64_t a1exval;			// Expression's value
-WORD a1exattr;				// Expression's attribute
-int a1ixreg;				// Index register
-int a1ixsiz;				// Index register size (and scale)
-SYM * a1esym;				// External symbol involved in expr
-TOKEN a1bexpr[EXPRSIZE];	// Base displacement expression
-uint64_t a1bexval;			// Base displacement value
-WORD a1bexattr;				// Base displacement attribute
-WORD a1bsize;				// Base displacement size
-WORD a1extension;			// 020+ extension address word
-WORD am1_030;				// ea bits for 020+ addressing modes
-
-int a2reg;					// Register for div.l (68020+)
-
-int bfparam1;				// bfxxx / fmove instruction parameter 1
-int bfparam2;				// bfxxx / fmove instruction parameter 2
-int bfval1;					// bfxxx / fmove value 1
-int bfval2;					// bfxxx / fmove value 2
-TOKEN bf0expr[EXPRSIZE];	// Expression
-uint64_t bf0exval;			// Expression's value
-WORD bf0exattr;				// Expression's attribute
-SYM * bf0esym;				// External symbol involved in expr
+ASMCTX int nmodes;					// Number of addr'ing modes found
+ASMCTX int am0;					// Addressing mode
+ASMCTX int a0reg;					// Register
+ASMCTX TOKEN a0expr[EXPRSIZE];		// Expression
+ASMCTX uint64_t a0exval;			// Expression's value
+ASMCTX WORD a0exattr;				// Expression's attribute
+ASMCTX int a0ixreg;				// Index register
+ASMCTX int a0ixsiz;				// Index register size (and scale)
+ASMCTX SYM * a0esym;				// External symbol involved in expr
+ASMCTX TOKEN a0bexpr[EXPRSIZE];	// Base displacement expression
+ASMCTX uint64_t a0bexval;			// Base displacement value
+ASMCTX WORD a0bexattr;				// Base displacement attribute
+ASMCTX WORD a0bsize;				// Base displacement size
+ASMCTX WORD a0extension;			// 020+ extension address word
+ASMCTX WORD am0_030;				// ea bits for 020+ addressing modes
+ASMCTX int a0sdi;					// Relaxation site (-1 if none)
+ASMCTX int a0pcsdi;				// PC relative relaxation site (-1 if none)
+ASMCTX int a0forcel;				// 1, xxx.L was given explicitly
+
+ASMCTX int am1;					// Addressing mode
+ASMCTX int a1reg;					// Register
+ASMCTX TOKEN a1expr[EXPRSIZE];		// Expression
+ASMCTX uint64_t a1exval;			// Expression's value
+ASMCTX WORD a1exattr;				// Expression's attribute
+ASMCTX int a1ixreg;				// Index register
+ASMCTX int a1ixsiz;				// Index register size (and scale)
+ASMCTX SYM * a1esym;				// External symbol involved in expr
+ASMCTX TOKEN a1bexpr[EXPRSIZE];	// Base displacement expression
+ASMCTX uint64_t a1bexval;			// Base displacement value
+ASMCTX WORD a1bexattr;				// Base displacement attribute
+ASMCTX WORD a1bsize;				// Base displacement size
+ASMCTX WORD a1extension;			// 020+ extension address word
+ASMCTX WORD am1_030;				// ea bits for 020+ addressing modes
+ASMCTX int a1sdi;					// Relaxation site (-1 if none)
+ASMCTX int a1pcsdi;				// PC relative relaxation site (-1 if none)
+ASMCTX int a1forcel;				// 1, xxx.L was given explicitly
+
+ASMCTX int a2reg;					// Register for div.l (68020+)
+
+ASMCTX int bfparam1;				// bfxxx / fmove instruction parameter 1
+ASMCTX int bfparam2;				// bfxxx / fmove instruction parameter 2
+ASMCTX int bfval1;					// bfxxx / fmove value 1
+ASMCTX int bfval2;					// bfxxx / fmove value 2
+ASMCTX TOKEN bf0expr[EXPRSIZE];	// Expression
+ASMCTX uint64_t bf0exval;			// Expression's value
+ASMCTX WORD bf0exattr;				// Expression's attribute
+ASMCTX SYM * bf0esym;				// External symbol involved in expr
 
 // Function prototypes
 int Check030Bitfield(void);
+static int QuickModes(int);
+static int QuickMode(int *, TOKEN *, uint64_t *, WORD *, SYM **);
 
 
 //
@@ -80,6 +89,17 @@ int amode(int acount)
 	a0expr[0] = a1expr[0] = ENDEXPR;
 	a0exattr = a1exattr = 0;
 	a0esym = a1esym = NULL;
+	a0sdi = a1sdi = a0pcsdi = a1pcsdi = -1;
+	a0forcel = a1forcel = 0;
+
+	// If at EOL, then no addr modes at all
+	if (*tok == EOL)
+		return 0;
+
+	// Most lines only use the simple modes, which don't need the rest
+	if (QuickModes(acount))
+		return nmodes;
+
 	a0bexpr[0] = a1bexpr[0] = ENDEXPR;
 	a0bexval = a1bexval = 0;
 	a0bsize = a0extension = a1bsize = a1extension = 0;
@@ -89,10 +109,6 @@ int amode(int acount)
 	bf0exattr = 0;
 	bf0esym = NULL;
 
-	// If at EOL, then no addr modes at all
-	if (*tok == EOL)
-		return 0;
-
 	// Parse first addressing mode
 	#define AnOK      a0ok
 	#define AMn       am0
@@ -112,6 +128,8 @@ int amode(int acount)
 	#define AnBZISE   a0bsize
 	#define AnEXTEN   a0extension
 	#define AMn_030   am0_030
+	#define AnSDI     a0sdi
+	#define AnFORCEL  a0forcel
 	#define IS_SUPPRESSEDn IS_SUPPRESSED0
 	#define CHECKODn CHECKOD0
 	#include "parmode.h"
@@ -151,6 +169,8 @@ int amode(int acount)
 	#define AnBZISE   a1bsize
 	#define AnEXTEN   a1extension
 	#define AMn_030   am1_030
+	#define AnSDI     a1sdi
+	#define AnFORCEL  a1forcel
 	#define IS_SUPPRESSEDn IS_SUPPRESSED1
 	#define CHECKODn CHECKOD1
 	#include "parmode.h"
@@ -194,6 +214,95 @@ badmode:
 }
 
 
+//
+// Try to parse the addressing modes on the line as one of the simple forms
+// Dn, An, (An), (An)+, -(An), #const and const(An), each followed by a comma
+// or EOL. Returns 1 if that worked, or 0 (with tok and the modes as they
+// were) if the line needs the full parser.
+//
+static int QuickModes(int acount)
+{
+	TOKEN * start = tok;
+
+	if ((am0 = QuickMode(&a0reg, a0expr, &a0exval, &a0exattr, &a0esym)) < 0)
+		goto slow;
+
+	nmodes = 1;
+
+	if (acount == 0 || *tok != ',')
+		return 1;
+
+	tok++;
+
+	if ((am1 = QuickMode(&a1reg, a1expr, &a1exval, &a1exattr, &a1esym)) < 0
+		|| *tok != EOL)
+		goto slow;
+
+	a2reg = a1reg;
+	nmodes = 2;
+	return 1;
+
+slow:
+	tok = start;
+	nmodes = a0reg = a1reg = 0;
+	am0 = am1 = AM_NONE;
+	a0expr[0] = a1expr[0] = ENDEXPR;
+	a0exattr = a1exattr = 0;
+	a0esym = a1esym = NULL;
+	return 0;
+}
+
+
+//
+// Parse one simple addressing mode (see QuickModes()). Returns the mode, or
+// -1 if it isn't one of them.
+//
+static int QuickMode(int * reg, TOKEN * aexpr, uint64_t * aexval, WORD * aexattr, SYM ** aesym)
+{
+	int mode;
+	int len;
+
+	if (*tok >= REG68_D0 && *tok <= REG68_D7)
+		mode = DREG, *reg = *tok & 7, len = 1;
+	else if (*tok >= REG68_A0 && *tok <= REG68_A7)
+		mode = AREG, *reg = *tok & 7, len = 1;
+	else if (*tok == '(' && tok[1] >= REG68_A0 && tok[1] <= REG68_A7 && tok[2] == ')')
+	{
+		*reg = tok[1] & 7;
+
+		if (tok[3] == '+')
+			mode = APOSTINC, len = 4;
+		else
+			mode = AIND, len = 3;
+	}
+	else if (*tok == '-' && tok[1] == '(' && tok[2] >= REG68_A0 && tok[2] <= REG68_A7 && tok[3] == ')')
+		mode = APREDEC, *reg = tok[2] & 7, len = 4;
+	else if (*tok == '#' && tok[1] == CONST && (tok[4] == ',' || tok[4] == EOL))
+	{
+		tok++;
+		expr(aexpr, aexval, aexattr, aesym);
+		return IMMED;
+	}
+	else if (*tok == CONST && tok[3] == '(' && tok[4] >= REG68_A0 && tok[4] <= REG68_A7
+		&& tok[5] == ')' && (tok[6] == ',' || tok[6] == EOL))
+	{
+		// expr() doesn't go past the '('
+		expr(aexpr, aexval, aexattr, aesym);
+		*reg = tok[1] & 7;
+		tok += 3;
+		return ADISP;
+	}
+	else
+		return -1;
+
+	if (tok[len] != ',' && tok[len] != EOL)
+		return -1;
+
+	tok += len;
+	return mode;
+}
+
+
 //
 // Parse register list
 //
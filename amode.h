@@ -135,29 +135,32 @@
 #define EXPRSIZE     128	// Maximum #tokens in an expression
 
 // Addressing mode variables, output of amode()
-extern int nmodes;
-extern int am0, am1;
-extern int a0reg, a1reg, a2reg;
-extern TOKEN a0expr[], a1expr[];
-extern uint64_t a0exval, a1exval;
-extern WORD a0exattr, a1exattr;
-extern int a0ixreg, a1ixreg;
-extern int a0ixsiz, a1ixsiz;
+extern ASMCTX int nmodes;
+extern ASMCTX int am0, am1;
+extern ASMCTX int a0reg, a1reg, a2reg;
+extern ASMCTX TOKEN a0expr[], a1expr[];
+extern ASMCTX uint64_t a0exval, a1exval;
+extern ASMCTX WORD a0exattr, a1exattr;
+extern ASMCTX int a0ixreg, a1ixreg;
+extern ASMCTX int a0ixsiz, a1ixsiz;
 extern TOKEN a0oexpr[], a1oexpr[];
 extern uint64_t a0oexval, a1oexval;
 extern WORD a0oexattr, a1oexattr;
-extern SYM * a0esym, * a1esym;
-extern uint64_t a0bexval, a1bexval;
-extern WORD a0bexattr, a1bexattr;
-extern WORD a0bsize, a1bsize;
-extern TOKEN a0bexpr[], a1bexpr[];
-extern WORD a0extension, a1extension;
+extern ASMCTX SYM * a0esym, * a1esym;
+extern ASMCTX uint64_t a0bexval, a1bexval;
+extern ASMCTX WORD a0bexattr, a1bexattr;
+extern ASMCTX WORD a0bsize, a1bsize;
+extern ASMCTX TOKEN a0bexpr[], a1bexpr[];
+extern ASMCTX WORD a0extension, a1extension;
+extern ASMCTX int a0sdi, a1sdi;
+extern ASMCTX int a0pcsdi, a1pcsdi;
+extern ASMCTX int a0forcel, a1forcel;
 extern WORD mulmode;
-extern int bfparam1;
-extern int bfparam2;
-extern int bfval1;
-extern int bfval2;
-extern uint64_t bf0exval;
+extern ASMCTX int bfparam1;
+extern ASMCTX int bfparam2;
+extern ASMCTX int bfval1;
+extern ASMCTX int bfval2;
+extern ASMCTX uint64_t bf0exval;
 
 // mnattr:
 #define CGSPECIAL    0x8000			// Special (don't parse addr modes)
@@ -0,0 +1,866 @@
+//
+// RMAC - Renamed Macro Assembler for all Atari computers
+// CACHE.C - Output Cache
+// Copyright (C) 199x Landon Dyer, 2011-2022 Reboot and Friends
+// RMAC derived from MADMAC v1.07 Written by Landon Dyer, 1986
+// Source utilised with the kind permission of Landon Dyer
+//
+// With --cache=dir, the outputs of an assembly (the files it wrote plus what
+// it printed and its error count) are kept in 'dir', and handed out again
+// when the same assembly is asked for with the same inputs.
+//
+// An assembly is first known by a hash of rmac's version, the current
+// directory, RMACPATH and the command line (key 1). Which files it reads
+// isn't known until it's done, so the file "<key 1>.m" (the manifest) lists
+// them, with a hash of each one's contents, as of the last time it was
+// assembled (and the files it looked for but didn't find). If they all still
+// have those contents (or still aren't there), the outputs are found in
+// the file named by the hash of key 1 and the manifest (key 2). Otherwise the
+// assembly is done, with stdout & stderr captured, and stored away under the
+// new manifest.
+//
+// The hash of each file in the manifest is of the bytes the assembly read, as
+// it read them, so a file changing during the assembly can't get its new
+// contents stored with outputs made from the old ones.
+//
+// Assemblies that read stdin or in-memory sources, or that use ^^date or
+// ^^time, aren't stored. The file "stats" counts the hits & misses, for
+// --cache-stats. The file "index" lists the entries, oldest first, with their
+// sizes: when they add up to more than the limit (--cache-size), the oldest
+// ones are deleted. Both are updated under a lock on the file "lock", as
+// several rmacs can share a cache.
+//
+
+#include "cache.h"
+#include "object.h"
+#include "token.h"
+#include "version.h"
+
+#include <errno.h>
+
+#if defined(WIN32) || defined(WIN64)
+#include <process.h>
+#define getpid _getpid
+#else
+#include <pthread.h>
+
+// fcntl() locks belong to the process, as do stdout & stderr, so threads of
+// one process (librmac) also take turns with these
+static pthread_mutex_t filelock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t capturelock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+#define CACHEMAX	256		// Default size limit of a cache, in megabytes
+
+static const uint32_t k256[64] = {
+	0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+	0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+	0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+	0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+	0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+	0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+	0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+	0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+static ASMCTX char * cachedir;			// Where the cache lives
+static ASMCTX int active;				// 1, an assembly is being captured
+static ASMCTX int dontstore;			// 1, the assembly can't be stored
+static ASMCTX char key1[HASHSIZE];		// Hash of the command line & co.
+static ASMCTX uint64_t cachemax;		// Size limit of the cache, in bytes
+static ASMCTX int savedfd[2];			// Real stdout & stderr, while capturing
+static ASMCTX FILE * capture[2];		// Where they go meanwhile
+static ASMCTX char ** outputs;			// Files written by it
+static ASMCTX int noutputs;
+
+#define ROR(x, n)	(((x) >> (n)) | ((x) << (32 - (n))))
+
+static void SHA256Block(SHA256 * s, const uint8_t * p)
+{
+	uint32_t w[64], t1, t2;
+	uint32_t a = s->h[0], b = s->h[1], c = s->h[2], d = s->h[3];
+	uint32_t e = s->h[4], f = s->h[5], g = s->h[6], h = s->h[7];
+	int i;
+
+	for(i=0; i<16; i++, p+=4)
+		w[i] = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16)
+			| ((uint32_t)p[2] << 8) | p[3];
+
+	for(; i<64; i++)
+		w[i] = w[i - 16] + w[i - 7]
+			+ (ROR(w[i - 15], 7) ^ ROR(w[i - 15], 18) ^ (w[i - 15] >> 3))
+			+ (ROR(w[i - 2], 17) ^ ROR(w[i - 2], 19) ^ (w[i - 2] >> 10));
+
+	for(i=0; i<64; i++)
+	{
+		t1 = h + (ROR(e, 6) ^ ROR(e, 11) ^ ROR(e, 25)) + ((e & f) ^ (~e & g))
+			+ k256[i] + w[i];
+		t2 = (ROR(a, 2) ^ ROR(a, 13) ^ ROR(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+		h = g; g = f; f = e; e = d + t1;
+		d = c; c = b; b = a; a = t1 + t2;
+	}
+
+	s->h[0] += a; s->h[1] += b; s->h[2] += c; s->h[3] += d;
+	s->h[4] += e; s->h[5] += f; s->h[6] += g; s->h[7] += h;
+}
+
+void SHA256Init(SHA256 * s)
+{
+	static const uint32_t h0[8] = {
+		0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+		0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+	};
+
+	memcpy(s->h, h0, sizeof(h0));
+	s->len = 0;
+}
+
+void SHA256Update(SHA256 * s, const void * data, size_t size)
+{
+	const uint8_t * p = data;
+
+	// Whole blocks go straight from the data
+	while ((s->len & 63) == 0 && size >= 64)
+	{
+		SHA256Block(s, p);
+		s->len += 64;
+		p += 64;
+		size -= 64;
+	}
+
+	while (size > 0)
+	{
+		size_t used = s->len & 63;
+		size_t n = (size < 64 - used ? size : 64 - used);
+
+		memcpy(s->buf + used, p, n);
+		s->len += n;
+		p += n;
+		size -= n;
+
+		if ((s->len & 63) == 0)
+			SHA256Block(s, s->buf);
+	}
+}
+
+void SHA256Final(SHA256 * s, char * hex)
+{
+	uint64_t bits = s->len * 8;
+	uint8_t pad = 0x80, zero = 0, lenbuf[8];
+
+	SHA256Update(s, &pad, 1);
+
+	while ((s->len & 63) != 56)
+		SHA256Update(s, &zero, 1);
+
+	for(int i=0; i<8; i++)
+		lenbuf[i] = (uint8_t)(bits >> (56 - (i * 8)));
+
+	SHA256Update(s, lenbuf, 8);
+
+	for(int i=0; i<8; i++)
+		sprintf(hex + (i * 8), "%08x", s->h[i]);
+}
+
+//
+// Read a whole file into (NUL terminated) memory; NULL if it can't be read
+//
+static char * ReadWholeFile(const char * name, size_t * size)
+{
+	int fd = open(name, _OPEN_INC);
+
+	if (fd < 0)
+		return NULL;
+
+	char * buf = NULL;
+	size_t used = 0, bufsize = 0;
+	long n;
+
+	for(;;)
+	{
+		if (used + 1 >= bufsize)
+		{
+			bufsize = (bufsize ? bufsize * 2 : 4096);
+			buf = realloc(buf, bufsize);
+		}
+
+		if ((n = read(fd, buf + used, bufsize - used - 1)) <= 0)
+			break;
+
+		used += n;
+	}
+
+	close(fd);
+
+	if (n < 0)
+	{
+		free(buf);
+		return NULL;
+	}
+
+	buf[used] = EOS;
+	*size = used;
+
+	return buf;
+}
+
+//
+// Hash the contents of file 'name' into 'hex' (HASHSIZE chars)
+//
+int HashFile(const char * name, char * hex)
+{
+	size_t size;
+	char * buf = ReadWholeFile(name, &size);
+	SHA256 s;
+
+	if (buf == NULL)
+		return ERROR;
+
+	SHA256Init(&s);
+	SHA256Update(&s, buf, size);
+	SHA256Final(&s, hex);
+	free(buf);
+
+	return OK;
+}
+
+//
+// Write a file in the cache. It's written under another name and renamed, so
+// no one ever sees half of it.
+//
+static void WriteCacheFile(const char * name, const char * buf, size_t size)
+{
+	char path[FNSIZ * 4], temp[FNSIZ * 4 + 16];
+
+	sprintf(path, "%s/%s", cachedir, name);
+	sprintf(temp, "%s.%d", path, (int)getpid());
+
+	int fd = open(temp, _OPEN_FLAGS, _PERM_MODE);
+
+	if (fd < 0)
+		return;
+
+	long written = write(fd, buf, size);
+	close(fd);
+
+#if defined(WIN32) || defined(WIN64)
+	unlink(path);
+#endif
+
+	if (written != (long)size || rename(temp, path) != 0)
+		unlink(temp);
+}
+
+static char * ReadCacheFile(const char * name, size_t * size)
+{
+	char path[FNSIZ * 4];
+
+	sprintf(path, "%s/%s", cachedir, name);
+
+	return ReadWholeFile(path, size);
+}
+
+static void Append(char ** buf, size_t * size, const void * data, size_t n)
+{
+	*buf = realloc(*buf, *size + n + 1);
+	memcpy(*buf + *size, data, n);
+	*size += n;
+	(*buf)[*size] = EOS;
+}
+
+static void AddName(char *** list, int * count, const char * name)
+{
+	for(int i=0; i<*count; i++)
+	{
+		if (strcmp((*list)[i], name) == 0)
+			return;
+	}
+
+	*list = realloc(*list, (*count + 1) * sizeof(char *));
+	(*list)[(*count)++] = strdup(name);
+}
+
+static void FreeNames(char *** list, int * count)
+{
+	while (*count > 0)
+		free((*list)[--(*count)]);
+
+	free(*list);
+	*list = NULL;
+}
+
+//
+// Key 2: the hash of key 1 and the manifest
+//
+static void EntryKey(const char * manifest, size_t size, char * hex)
+{
+	SHA256 s;
+
+	SHA256Init(&s);
+	SHA256Update(&s, key1, HASHSIZE);
+	SHA256Update(&s, manifest, size);
+	SHA256Final(&s, hex);
+}
+
+//
+// Do the files listed in a manifest still have the same contents?
+//
+static int CheckManifest(char * manifest)
+{
+	char hash[HASHSIZE];
+
+	while (*manifest != EOS)
+	{
+		char * name = manifest + HASHSIZE;
+		char * end = strchr(manifest, '\n');
+
+		if (end == NULL || end < name || manifest[HASHSIZE - 1] != ' ')
+			return ERROR;
+
+		*end = EOS;
+		int ok;
+
+		if (*manifest == '-')			// Not to be found
+		{
+			int fd = open(name, _OPEN_INC);
+
+			if ((ok = (fd < 0)) == 0)
+				close(fd);
+		}
+		else
+			ok = (HashFile(name, hash) == OK
+				&& memcmp(hash, manifest, HASHSIZE - 1) == 0);
+
+		*end = '\n';
+
+		if (!ok)
+			return ERROR;
+
+		manifest = end + 1;
+	}
+
+	return OK;
+}
+
+//
+// Put back the outputs stored in a cache entry; returns the error count, or
+// -1 if the entry is no good. It's made up of records, each one a line
+// giving its type and size (and, for files, the name) then that many bytes.
+//
+static int RestoreEntry(char * entry, size_t size)
+{
+	char * end = entry + size;
+	int errors = -1;
+
+	// Check it over before anything gets written
+	for(int pass=0; pass<2; pass++)
+	{
+		char * p = entry;
+
+		if (strncmp(p, "RMAC CACHE 1\n", 13) != 0)
+			return -1;
+
+		for(p+=13; p<end; )
+		{
+			char type[8], * data = strchr(p, '\n');
+			unsigned long n;
+			int skip = 0;
+
+			if (data == NULL)
+				return -1;
+
+			*data++ = EOS;
+
+			if (sscanf(p, "%7s %lu %n", type, &n, &skip) < 2
+				|| n > (unsigned long)(end - data))
+			{
+				data[-1] = '\n';
+				return -1;
+			}
+
+			if (strcmp(type, "rc") == 0)
+				errors = (int)n, n = 0;
+			else if (pass == 1 && strcmp(type, "out") == 0)
+				fwrite(data, 1, n, stdout);
+			else if (pass == 1 && strcmp(type, "err") == 0)
+			{
+				fflush(stdout);
+				fwrite(data, 1, n, stderr);
+			}
+			else if (pass == 1 && strcmp(type, "file") == 0)
+			{
+				int fd = open(p + skip, _OPEN_FLAGS, _PERM_MODE);
+
+				if (fd < 0 || write(fd, data, n) != (long)n)
+					printf("Cannot create file: '%s'\n", p + skip);
+
+				if (fd >= 0)
+					close(fd);
+			}
+
+			data[-1] = '\n';
+			p = data + n;
+		}
+
+		if (errors < 0)
+			return -1;
+	}
+
+	fflush(stdout);
+
+	return errors;
+}
+
+//
+// Take the lock on the cache's bookkeeping files; returns what to pass to
+// UnlockCache()
+//
+static int LockCache(void)
+{
+	char path[FNSIZ * 4];
+
+#if !defined(WIN32) && !defined(WIN64)
+	pthread_mutex_lock(&filelock);
+#endif
+
+	sprintf(path, "%s/lock", cachedir);
+	int fd = open(path, O_RDWR | O_CREAT, _PERM_MODE);
+
+#if !defined(WIN32) && !defined(WIN64)
+	if (fd >= 0)
+	{
+		struct flock fl;
+
+		memset(&fl, 0, sizeof(fl));
+		fl.l_type = F_WRLCK;
+		fl.l_whence = SEEK_SET;
+
+		while (fcntl(fd, F_SETLKW, &fl) < 0 && errno == EINTR)
+			;
+	}
+#endif
+
+	return fd;
+}
+
+static void UnlockCache(int fd)
+{
+	if (fd >= 0)
+		close(fd);
+
+#if !defined(WIN32) && !defined(WIN64)
+	pthread_mutex_unlock(&filelock);
+#endif
+}
+
+//
+// Read the hit & miss counts of the cache in 'dir'
+//
+static void ReadStats(const char * dir, long * hits, long * misses)
+{
+	char path[FNSIZ * 4];
+	size_t size = 0;
+
+	*hits = *misses = 0;
+	sprintf(path, "%s/stats", dir);
+	char * stats = ReadWholeFile(path, &size);
+
+	if (stats == NULL)
+		return;
+
+	if (sscanf(stats, "%ld hits %ld misses", hits, misses) != 2)
+	{
+		// Caches used to get an 'h' or 'm' added for every lookup
+		*hits = *misses = 0;
+
+		for(size_t i=0; i<size; i++)
+		{
+			if (stats[i] == 'h')
+				(*hits)++;
+			else if (stats[i] == 'm')
+				(*misses)++;
+		}
+	}
+
+	free(stats);
+}
+
+static void CountStat(int hit)
+{
+	char buf[64];
+	long hits, misses;
+	int lock = LockCache();
+
+	ReadStats(cachedir, &hits, &misses);
+
+	if (hit)
+		hits++;
+	else
+		misses++;
+
+	sprintf(buf, "%ld hits %ld misses\n", hits, misses);
+	WriteCacheFile("stats", buf, strlen(buf));
+	UnlockCache(lock);
+}
+
+//
+// Add the entry just stored (with its manifest, 'size' bytes in all) to the
+// index. If that takes the cache past its size limit, the oldest entries are
+// deleted until it's down to 3/4 of the limit. A manifest goes with its entry
+// unless a later entry for the same command line has replaced it.
+//
+static void IndexEntry(const char * key2, size_t size)
+{
+	char k1[HASHSIZE], k2[HASHSIZE], path[FNSIZ * 4];
+	char * index, * p, * next, * newindex = NULL;
+	size_t isize = 0, nsize = 0;
+	unsigned long n;
+	uint64_t total = size;
+	int lock = LockCache();
+
+	if ((index = ReadCacheFile("index", &isize)) == NULL)
+		isize = 0;
+
+	for(int pass=0; pass<2; pass++)
+	{
+		int evict = (pass == 1 && total > cachemax);
+
+		for(p=index; p!=NULL && *p!=EOS; p=next)
+		{
+			if ((next = strchr(p, '\n')) == NULL)
+				break;
+
+			next++;
+
+			// (Lines for the same entry, stored over again, are dropped)
+			if (sscanf(p, "%64s %64s %lu", k2, k1, &n) != 3
+				|| strcmp(k2, key2) == 0)
+				continue;
+
+			if (pass == 0)
+				total += n;
+			else if (evict && total > cachemax / 4 * 3)
+			{
+				sprintf(path, "%s/%s", cachedir, k2);
+				unlink(path);
+
+				if (strcmp(k1, key1) != 0 && strstr(next, k1) == NULL)
+				{
+					sprintf(path, "%s/%s.m", cachedir, k1);
+					unlink(path);
+				}
+
+				total -= n;
+			}
+			else
+				Append(&newindex, &nsize, p, next - p);
+		}
+	}
+
+	sprintf(path, "%s %s %lu\n", key2, key1, (unsigned long)size);
+	Append(&newindex, &nsize, path, strlen(path));
+	WriteCacheFile("index", newindex, nsize);
+	free(newindex);
+	free(index);
+	UnlockCache(lock);
+}
+
+static void StartCapture(void)
+{
+#if !defined(WIN32) && !defined(WIN64)
+	pthread_mutex_lock(&capturelock);
+#endif
+
+	fflush(stdout);
+	fflush(stderr);
+
+	for(int n=0; n<2; n++)
+	{
+		if ((capture[n] = tmpfile()) == NULL)
+		{
+			if (n == 1)
+				fclose(capture[0]);
+
+			dontstore = 1;
+#if !defined(WIN32) && !defined(WIN64)
+			pthread_mutex_unlock(&capturelock);
+#endif
+			return;
+		}
+	}
+
+	for(int n=0; n<2; n++)
+	{
+		savedfd[n] = dup(n + 1);
+		dup2(fileno(capture[n]), n + 1);
+	}
+}
+
+//
+// Stop capturing, pass on what was captured and hand it back
+//
+static void EndCapture(char * text[2], size_t size[2])
+{
+	text[0] = text[1] = NULL;
+	size[0] = size[1] = 0;
+
+	if (capture[0] == NULL)
+		return;
+
+	fflush(stdout);
+	fflush(stderr);
+
+	for(int n=0; n<2; n++)
+	{
+		int fd = fileno(capture[n]);
+		long length = lseek(fd, 0, SEEK_END);
+
+		dup2(savedfd[n], n + 1);
+		close(savedfd[n]);
+		text[n] = malloc(length + 1);
+		lseek(fd, 0, SEEK_SET);
+
+		if (length < 0 || read(fd, text[n], length) != length)
+		{
+			dontstore = 1;
+			length = 0;
+		}
+
+		size[n] = length;
+		fclose(capture[n]);
+		capture[n] = NULL;
+		fwrite(text[n], 1, size[n], (n == 0 ? stdout : stderr));
+		fflush(n == 0 ? stdout : stderr);
+	}
+
+#if !defined(WIN32) && !defined(WIN64)
+	pthread_mutex_unlock(&capturelock);
+#endif
+}
+
+//
+// Look for the assembly asked for on the command line in the cache (if
+// there's a --cache). If it's there, its outputs are put back and its error
+// count returned. Otherwise -1 is returned and, if it's to be stored, what
+// it prints is captured from now on until CacheStore().
+//
+int CacheLookup(int argc, char ** argv)
+{
+	SHA256 s;
+	char buf[FNSIZ * 4], * p;
+	size_t size;
+	int i;
+
+	active = dontstore = 0;
+	cachedir = NULL;
+	cachemax = (uint64_t)CACHEMAX << 20;
+	FreeNames(&outputs, &noutputs);
+
+	for(i=0; i<argc; i++)
+	{
+		if (strncmp(argv[i], "--cache=", 8) == 0 && argv[i][8] != EOS)
+			cachedir = argv[i] + 8;
+		else if (strncmp(argv[i], "--cache-size=", 13) == 0)
+			cachemax = (uint64_t)strtoul(argv[i] + 13, NULL, 10) << 20;
+		else if (strcmp(argv[i], "-") == 0)
+			return -1;
+	}
+
+	if (cachedir == NULL || objmem_flag || strlen(cachedir) > FNSIZ * 2)
+		return -1;
+
+#if !defined(WIN32) && !defined(WIN64)
+	mkdir(cachedir, 0777);
+#endif
+
+	SHA256Init(&s);
+	sprintf(buf, "RMAC CACHE 1 %d.%d.%d %s %s", MAJOR, MINOR, PATCH, __DATE__, __TIME__);
+	SHA256Update(&s, buf, strlen(buf) + 1);
+
+#if defined(WIN32) || defined(WIN64)
+	p = _fullpath(buf, ".", sizeof(buf));
+#else
+	p = getcwd(buf, sizeof(buf));
+#endif
+
+	if (p == NULL)
+		return -1;
+
+	SHA256Update(&s, buf, strlen(buf) + 1);
+	p = getenv("RMACPATH");
+	SHA256Update(&s, (p ? p : ""), (p ? strlen(p) : 0) + 1);
+
+	for(i=0; i<argc; i++)
+	{
+		if (strncmp(argv[i], "--cache=", 8) != 0
+			&& strncmp(argv[i], "--cache-size=", 13) != 0
+			&& strncmp(argv[i], "--fixup-threads=", 16) != 0)
+			SHA256Update(&s, argv[i], strlen(argv[i]) + 1);
+	}
+
+	SHA256Final(&s, key1);
+
+	// Is there an entry for the files as they are now?
+	sprintf(buf, "%s.m", key1);
+	char * manifest = ReadCacheFile(buf, &size);
+
+	if (manifest != NULL && CheckManifest(manifest) == OK)
+	{
+		EntryKey(manifest, size, buf);
+		char * entry = ReadCacheFile(buf, &size);
+		int errors = (entry ? RestoreEntry(entry, size) : -1);
+
+		free(entry);
+
+		if (errors >= 0)
+		{
+			free(manifest);
+			CountStat(1);
+			return errors;
+		}
+	}
+
+	free(manifest);
+	CountStat(0);
+	active = 1;
+	StartCapture();
+
+	return -1;
+}
+
+//
+// Note a file written by the assembly being captured
+//
+void CacheNoteOutput(const char * fname)
+{
+	if (active)
+		AddName(&outputs, &noutputs, fname);
+}
+
+//
+// The assembly being captured depends on something besides its input files
+//
+void CacheDontStore(void)
+{
+	dontstore = 1;
+}
+
+//
+// Is what the assembly reads to be hashed (see INFILE)?
+//
+int CacheHashing(void)
+{
+	return (active && !dontstore);
+}
+
+//
+// The assembly being captured is done: pass on what it printed and store its
+// outputs in the cache
+//
+void CacheStore(int errors)
+{
+	char * text[2], * manifest = NULL, * entry = NULL, * data;
+	char hash[HASHSIZE], buf[FNSIZ * 4 + 64];
+	size_t size[2], msize = 0, esize = 0, dsize;
+	int i;
+
+	if (!active)
+		return;
+
+	active = 0;
+	EndCapture(text, size);
+
+	// Files that were read, then those that weren't found
+	for(int found=1; found>=0; found--)
+	{
+		for(INFILE * inf=infiles; inf!=NULL && !dontstore; inf=inf->next)
+		{
+			if (inf->found != found)
+				continue;
+
+			// (A file that was found, but not hashed as it was read, can't
+			// be vouched for)
+			if (!found)
+				memset(hash, '-', HASHSIZE - 1);
+			else if (inf->hash[0] != EOS)
+				memcpy(hash, inf->hash, HASHSIZE);
+			else
+				dontstore = 1;
+
+			Append(&manifest, &msize, hash, HASHSIZE - 1);
+			Append(&manifest, &msize, " ", 1);
+			Append(&manifest, &msize, inf->name, strlen(inf->name));
+			Append(&manifest, &msize, "\n", 1);
+		}
+	}
+
+	if (!dontstore)
+	{
+		sprintf(buf, "RMAC CACHE 1\nrc %d\nout %lu\n", errors, (unsigned long)size[0]);
+		Append(&entry, &esize, buf, strlen(buf));
+		Append(&entry, &esize, text[0], size[0]);
+		sprintf(buf, "err %lu\n", (unsigned long)size[1]);
+		Append(&entry, &esize, buf, strlen(buf));
+		Append(&entry, &esize, text[1], size[1]);
+
+		for(i=0; i<noutputs; i++)
+		{
+			// (Outputs of assemblies with errors get deleted)
+			if ((data = ReadWholeFile(outputs[i], &dsize)) == NULL)
+				continue;
+
+			sprintf(buf, "file %lu ", (unsigned long)dsize);
+			Append(&entry, &esize, buf, strlen(buf));
+			Append(&entry, &esize, outputs[i], strlen(outputs[i]));
+			Append(&entry, &esize, "\n", 1);
+			Append(&entry, &esize, data, dsize);
+			free(data);
+		}
+
+		EntryKey((manifest ? manifest : ""), msize, hash);
+		WriteCacheFile(hash, entry, esize);
+		sprintf(buf, "%s.m", key1);
+		WriteCacheFile(buf, (manifest ? manifest : ""), msize);
+		IndexEntry(hash, esize + msize);
+	}
+
+	free(entry);
+	free(manifest);
+	free(text[0]);
+	free(text[1]);
+	FreeNames(&outputs, &noutputs);
+}
+
+//
+// The assembly being captured was given up on; pass on what it printed, but
+// don't store anything
+//
+void CacheAbandon(void)
+{
+	char * text[2];
+	size_t size[2];
+
+	if (!active)
+		return;
+
+	active = 0;
+	EndCapture(text, size);
+	free(text[0]);
+	free(text[1]);
+}
+
+//
+// --cache-stats: report hits & misses of the cache in 'dir'
+//
+int CacheStats(char * dir)
+{
+	long hits, misses;
+
+	if (strlen(dir) > FNSIZ * 2)
+		return 1;
+
+	ReadStats(dir, &hits, &misses);
+	printf("%s: %ld hits, %ld misses\n", dir, hits, misses);
+
+	return 0;
+}
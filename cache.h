@@ -0,0 +1,39 @@
+//
+// RMAC - Renamed Macro Assembler for all Atari computers
+// CACHE.H - Output Cache
+// Copyright (C) 199x Landon Dyer, 2011-2022 Reboot and Friends
+// RMAC derived from MADMAC v1.07 Written by Landon Dyer, 1986
+// Source utilised with the kind permission of Landon Dyer
+//
+
+#ifndef __CACHE_H__
+#define __CACHE_H__
+
+#include "rmac.h"
+
+#define HASHSIZE	65		// SHA-256 as hex, plus a NUL
+
+// SHA-256 state
+#define SHA256 struct _sha256
+SHA256
+{
+	uint32_t h[8];			// Hash so far
+	uint8_t buf[64];		// Block being filled
+	uint64_t len;			// # bytes hashed
+};
+
+// Exported functions
+void SHA256Init(SHA256 *);
+void SHA256Update(SHA256 *, const void *, size_t);
+void SHA256Final(SHA256 *, char *);
+int CacheLookup(int, char **);
+void CacheNoteOutput(const char *);
+void CacheDontStore(void);
+int CacheHashing(void);
+void CacheStore(int);
+void CacheAbandon(void);
+int CacheStats(char *);
+int HashFile(const char *, char *);
+
+#endif // __CACHE_H__
+
@@ -17,7 +17,7 @@
 
 
 static int siztab[4] = { 3, 5, 9, 9 };
-static PTR tp;
+static ASMCTX PTR tp;
 
 
 //
@@ -105,12 +105,17 @@ int fudump(FIXUP * fup)
 			printf("(%d long) ", (int)esiz);
 			printexpr(fup->expr);
 		}
+		else if (fup->addend != 0)
+			printf("`%s'+$%" PRIX64 " ;", fup->symbol->sname, fup->addend);
 		else
 			printf("`%s' ;", fup->symbol->sname);
 
 		if ((attr & FUMASKRISC) == FU_JR)
 			printf(" *=$%X", fup->orgaddr);
 
+		if (fup->count > 1)
+			printf(" x%u", fup->count);
+
 		printf("\n");
 
 		fup = fup->next;
@@ -0,0 +1,769 @@
+//
+// RMAC - Renamed Macro Assembler for all Atari computers
+// DEPEND.C - Dependency Graph of Equates & Fixups
+// Copyright (C) 199x Landon Dyer, 2011-2022 Reboot and Friends
+// RMAC derived from MADMAC v1.07 Written by Landon Dyer, 1986
+// Source utilised with the kind permission of Landon Dyer
+//
+// Once the last line has been read, the values still to be worked out form a
+// graph: equates that referred to symbols not defined yet ("late" equates)
+// and the expressions of fixups depend on symbols, and a late equate is what
+// gives its symbol a value. ResolveDependencies() builds the graph and works
+// through it in topological order:
+//
+//   o  Late equates are evaluated as soon as the last late equate they
+//      depend on has been (Kahn's algorithm): each exactly once, with only
+//      its own dependents looked at again when it gets its value. What's
+//      left when nothing more can go is on, or behind, a cycle; cycles are
+//      reported with the full path, e.g. "equate cycle: x1 -> x2 -> x1".
+//   o  Fixups come last, as nothing depends on them. Fixups with the same
+//      expression share a node, so the expression is evaluated only once
+//      (by EvalFixup(), when the first of them is resolved) however many
+//      times it is used, by dcb & co., --relax, and ResolveFixups().
+//      With --fixup-threads=n, EvalFixupsInParallel() has the expressions
+//      evaluated by a pool of threads first (see below).
+//
+
+#include "depend.h"
+#include "direct.h"
+#include "error.h"
+#include "expr.h"
+#include "token.h"
+
+#if !defined(WIN32) && !defined(WIN64)
+#include <pthread.h>
+#endif
+
+#define FIXUPCHUNK  256			// # of fixups a worker thread takes at a time
+
+// Late equate (a node of the graph)
+#define LATEEQU struct _lateequ
+LATEEQU
+{
+	LATEEQU * next;				// * -> Next late equate (in order of definition)
+	SYM * sym;					// * -> Symbol being equated
+	TOKEN * expr;				// * -> Copy of the expression (follows struct)
+	WORD fileno;				// File & line of the equate, for error messages
+	uint32_t lineno;
+	int state;					// LE_PENDING, LE_ACTIVE, LE_DONE or LE_FAILED
+	uint32_t pending;			// # of references to unresolved late equates
+};
+
+#define LE_PENDING  0			// Waiting for the late equates it refers to
+#define LE_ACTIVE   1			// On the cycle search path
+#define LE_DONE     2			// Symbol is defined
+#define LE_FAILED   3			// Error reported; symbol stays undefined
+
+// Expression shared by one or more fixups (a node of the graph)
+#define EXPRNODE struct _exprnode
+EXPRNODE
+{
+	TOKEN * expr;				// * -> Expression (the first fixup's)
+	uint16_t length;			// # of TOKENs in it (ENDEXPR included)
+	uint8_t done;				// 1, evaluated (value, attr & esym are set)
+	WORD attr;
+	uint64_t value;
+	SYM * esym;
+	uint8_t failed;				// 1, a worker thread's evaluation failed
+	char * msgs;				// Messages from the worker thread (NULL: none)
+	uint32_t owner;				// Fixup (in fixuplist[]) it's evaluated for
+	uint32_t hash;
+	uint32_t next;				// Next node on the hash chain (NONODE: none)
+};
+
+static ASMCTX LATEEQU * lateequ;		// Late equates, in order of definition
+static ASMCTX LATEEQU * lateequtail;	// Last one on the list
+static ASMCTX EXPRNODE * exprnode;		// Fixup expressions
+static ASMCTX uint32_t nexprnode;		// # of them
+
+
+//
+// Initialize the dependency graph
+//
+void InitDepend(void)
+{
+	while (lateequ != NULL)
+	{
+		LATEEQU * le = lateequ;
+		lateequ = le->next;
+		free(le);
+	}
+
+	lateequtail = NULL;
+
+	for(uint32_t i=0; i<nexprnode; i++)
+		free(exprnode[i].msgs);
+
+	free(exprnode);
+	exprnode = NULL;
+	nexprnode = 0;
+}
+
+
+//
+// Remember an equate whose expression isn't defined yet
+//
+void AddLateEquate(SYM * sy, TOKEN * expr)
+{
+	uint16_t len = ExpressionLength(expr);
+	LATEEQU * le = malloc(sizeof(LATEEQU) + len * sizeof(TOKEN));
+
+	le->next = NULL;
+	le->sym = sy;
+	le->expr = (TOKEN *)(le + 1);
+	le->fileno = cfileno;
+	le->lineno = curlineno;
+	le->state = LE_PENDING;
+	le->pending = 0;
+	memcpy(le->expr, expr, len * sizeof(TOKEN));
+	sy->sattre |= EQUATEDLATE;
+
+	if (lateequ == NULL)
+		lateequ = le;
+	else
+		lateequtail->next = le;
+
+	lateequtail = le;
+}
+
+
+//
+// Return the symbol of the next SYMBOL token at or after *tk, leaving *tk just
+// past it; NULL at the end of the expression
+//
+static SYM * NextSymbol(TOKEN ** tk)
+{
+	TOKEN * p = *tk;
+
+	while (*p != ENDEXPR)
+	{
+		if (*p == CONST || *p == FCONST || *p == ACONST)
+			p += 3;
+		else if (*p == SYMBOL)
+		{
+			*tk = p + 2;
+			return symbolPtr[p[1]];
+		}
+		else
+			p++;
+	}
+
+	*tk = p;
+	return NULL;
+}
+
+
+//
+// Give a late equate its value; all the late equates it depends on have been
+// dealt with already
+//
+static void DefineLateEquate(LATEEQU * le)
+{
+	uint64_t eval;
+	WORD eattr;
+	SYM * esym;
+	SYM * sy = le->sym;
+
+	cfileno = le->fileno;
+	curlineno = le->lineno;
+	SetFilenameForErrorReporting();
+	le->state = LE_FAILED;
+
+	if (evexpr(le->expr, &eval, &eattr, &esym) != OK)
+		return;
+
+	if (!(eattr & DEFINED))
+	{
+		// Name the culprit, unless it's a late equate that failed already
+		TOKEN * p = le->expr;
+
+		for(SYM * sy2; (sy2=NextSymbol(&p))!=NULL; )
+		{
+			if (!(sy2->sattr & DEFINED) && !(sy2->sattre & EQUATEDLATE))
+			{
+				error("undefined symbol '%s' in equate to '%s'", sy2->sname, sy->sname);
+				return;
+			}
+		}
+
+		return;
+	}
+
+	if (sy->sattr & DEFINED)
+	{
+		error("multiple equate to '%s'", sy->sname);
+		return;
+	}
+
+	sy->sattr |= eattr | EQUATED;
+	sy->svalue = eval;
+	le->state = LE_DONE;
+}
+
+
+//
+// Report the late equates on the search path from 'first' up as a cycle
+//
+static void ReportEquateCycle(LATEEQU ** path, int first, int depth)
+{
+	char buf[256];
+	int n = 0;
+
+	for(int i=first; i<depth && n<200; i++)
+		n += sprintf(buf + n, "%s -> ", path[i]->sym->sname);
+
+	if (n >= 200)
+		n += sprintf(buf + n, "... -> ");
+
+	sprintf(buf + n, "%s", path[first]->sym->sname);
+
+	cfileno = path[first]->fileno;
+	curlineno = path[first]->lineno;
+	SetFilenameForErrorReporting();
+	error("equate cycle: %s", buf);
+}
+
+
+//
+// Resolve the late equates in dependency order. 'producer' maps a symbol's
+// uid to its late equate; 'first' & 'dependent' list the late equates that
+// refer to the symbol with a given uid (dependent[first[uid]] up to
+// dependent[first[uid + 1]], once for each reference).
+//
+static void ResolveLateEquates(LATEEQU ** producer, uint32_t * first, LATEEQU ** dependent, int count)
+{
+	LATEEQU ** queue = malloc(count * sizeof(LATEEQU *));
+	LATEEQU ** path = malloc(count * sizeof(LATEEQU *));
+	int head = 0, tail = 0;
+	LATEEQU * le;
+
+	for(le=lateequ; le!=NULL; le=le->next)
+	{
+		if (le->pending == 0)
+			queue[tail++] = le;
+	}
+
+	for(LATEEQU * start=lateequ; ; )
+	{
+		// Evaluate whatever's ready; each one evaluated makes the late
+		// equates that refer to it one step closer to being ready
+		while (head < tail)
+		{
+			le = queue[head++];
+
+			if (le->state == LE_PENDING)
+				DefineLateEquate(le);
+
+			uint32_t uid = le->sym->uid;
+
+			for(uint32_t i=first[uid]; i<first[uid + 1]; i++)
+			{
+				LATEEQU * dep = dependent[i];
+
+				if (--dep->pending == 0 && dep->state == LE_PENDING)
+					queue[tail++] = dep;
+			}
+		}
+
+		// Anything still pending is on a cycle or depends on one. Follow the
+		// references to pending late equates from there until one comes
+		// round again, report the cycle, then go on as if it had been
+		// resolved (its symbols stay undefined).
+		while (start != NULL && start->state != LE_PENDING)
+			start = start->next;
+
+		if (start == NULL)
+			break;
+
+		int depth = 0;
+		LATEEQU * dep = start;
+
+		while (dep->state == LE_PENDING)
+		{
+			dep->state = LE_ACTIVE;
+			path[depth++] = dep;
+			TOKEN * p = dep->expr;
+			SYM * sy;
+
+			while ((sy = NextSymbol(&p)) != NULL)
+			{
+				if ((sy->sattre & EQUATEDLATE) && producer[sy->uid] != NULL
+					&& (producer[sy->uid]->state == LE_PENDING
+					|| producer[sy->uid]->state == LE_ACTIVE))
+					break;
+			}
+
+			dep = producer[sy->uid];
+		}
+
+		int i;
+
+		for(i=0; path[i]!=dep; i++)
+			path[i]->state = LE_PENDING;
+
+		ReportEquateCycle(path, i, depth);
+
+		for(; i<depth; i++)
+		{
+			path[i]->state = LE_FAILED;
+			queue[tail++] = path[i];
+		}
+	}
+
+	free(path);
+	free(queue);
+}
+
+
+//
+// Hash an expression's TOKENs (FNV-1a)
+//
+static uint32_t HashExpression(TOKEN * expr, uint16_t length)
+{
+	uint32_t hash = 2166136261u;
+
+	for(uint16_t i=0; i<length; i++)
+		hash = (hash ^ expr[i]) * 16777619u;
+
+	return hash;
+}
+
+
+//
+// Give every fixup with an expression its node, fixups with the same
+// expression getting the same one
+//
+static void MakeExpressionNodes(void)
+{
+	uint32_t count = 0, size, * bucket;
+	FIXUP * fup;
+
+	for(int i=0; i<NSECTS; i++)
+	{
+		for(fup=sect[i].sffix; fup!=NULL; fup=fup->next)
+		{
+			if (fup->attr & FU_EXPR)
+				count++;
+		}
+	}
+
+	if (count == 0)
+		return;
+
+	for(size=16; size<count*2; size*=2)
+		;
+
+	exprnode = malloc(count * sizeof(EXPRNODE));
+	bucket = malloc(size * sizeof(uint32_t));
+	memset(bucket, 0xFF, size * sizeof(uint32_t));
+
+	for(int i=0; i<NSECTS; i++)
+	{
+		for(fup=sect[i].sffix; fup!=NULL; fup=fup->next)
+		{
+			if (!(fup->attr & FU_EXPR))
+				continue;
+
+			uint16_t length = ExpressionLength(fup->expr);
+			uint32_t hash = HashExpression(fup->expr, length);
+			uint32_t n;
+
+			for(n=bucket[hash & (size - 1)]; n!=NONODE; n=exprnode[n].next)
+			{
+				EXPRNODE * xn = &exprnode[n];
+
+				if (xn->hash == hash && xn->length == length
+					&& memcmp(xn->expr, fup->expr, length * sizeof(TOKEN)) == 0)
+					break;
+			}
+
+			if (n == NONODE)
+			{
+				n = nexprnode++;
+				EXPRNODE * xn = &exprnode[n];
+				xn->expr = fup->expr;
+				xn->length = length;
+				xn->done = 0;
+				xn->failed = 0;
+				xn->msgs = NULL;
+				xn->hash = hash;
+				xn->next = bucket[hash & (size - 1)];
+				bucket[hash & (size - 1)] = n;
+			}
+
+			fup->node = n;
+		}
+	}
+
+	free(bucket);
+}
+
+
+//
+// Build the dependency graph and resolve it, once the last line has been read
+//
+void ResolveDependencies(void)
+{
+	int count = 0;
+	uint32_t nsyms = 0, nrefs = 0;
+	LATEEQU * le;
+	SYM * sy;
+	TOKEN * p;
+
+	for(le=lateequ; le!=NULL; le=le->next)
+	{
+		count++;
+
+		if (le->sym->uid >= nsyms)
+			nsyms = le->sym->uid + 1;
+	}
+
+	if (count > 0)
+	{
+		// Count each late equate's references to other late equates, and
+		// how many references there are to each symbol that has one
+		uint32_t * first = calloc(nsyms + 1, sizeof(uint32_t));
+		LATEEQU ** producer = calloc(nsyms, sizeof(LATEEQU *));
+
+		for(le=lateequ; le!=NULL; le=le->next)
+			producer[le->sym->uid] = le;
+
+		for(le=lateequ; le!=NULL; le=le->next)
+		{
+			for(p=le->expr; (sy=NextSymbol(&p))!=NULL; )
+			{
+				if ((sy->sattre & EQUATEDLATE) && sy->uid < nsyms
+					&& producer[sy->uid] != NULL)
+				{
+					le->pending++;
+					first[sy->uid]++;
+					nrefs++;
+				}
+			}
+		}
+
+		// Turn the counts into where each symbol's dependents start, then
+		// fill them in
+		LATEEQU ** dependent = malloc((nrefs + 1) * sizeof(LATEEQU *));
+
+		for(uint32_t i=0, sum=0; i<=nsyms; i++)
+		{
+			uint32_t n = (i < nsyms ? first[i] : 0);
+			first[i] = sum;
+			sum += n;
+		}
+
+		uint32_t * fill = malloc((nsyms + 1) * sizeof(uint32_t));
+		memcpy(fill, first, (nsyms + 1) * sizeof(uint32_t));
+
+		for(le=lateequ; le!=NULL; le=le->next)
+		{
+			for(p=le->expr; (sy=NextSymbol(&p))!=NULL; )
+			{
+				if ((sy->sattre & EQUATEDLATE) && sy->uid < nsyms
+					&& producer[sy->uid] != NULL)
+					dependent[fill[sy->uid]++] = le;
+			}
+		}
+
+		ResolveLateEquates(producer, first, dependent, count);
+
+		for(le=lateequ; le!=NULL; le=le->next)
+			le->sym->sattre &= ~EQUATEDLATE;
+
+		free(fill);
+		free(dependent);
+		free(producer);
+		free(first);
+	}
+
+	MakeExpressionNodes();
+}
+
+
+//
+// Work out the value & attributes of a fixup's expression or symbol, and any
+// external symbol involved. An expression shared with other fixups is only
+// evaluated once; errors aren't kept, so every fixup with a bad expression
+// gets its own error message.
+//
+int EvalFixup(FIXUP * fup, uint64_t * eval, WORD * eattr, SYM ** esym)
+{
+	if (fup->attr & FU_EXPR)
+	{
+		if (fup->node >= nexprnode)
+			return evexpr(fup->expr, eval, eattr, esym);
+
+		EXPRNODE * xn = &exprnode[fup->node];
+
+		if (!xn->done)
+		{
+			// A worker thread couldn't evaluate it: report its messages, as
+			// evaluating it again would
+			if (xn->failed)
+			{
+				if (xn->msgs != NULL)
+					ReplayMessages(xn->msgs);
+
+				return ERROR;
+			}
+
+			*esym = NULL;
+
+			if (evexpr(xn->expr, &xn->value, &xn->attr, esym) != OK)
+				return ERROR;
+
+			xn->esym = *esym;
+			xn->done = 1;
+		}
+		else if (xn->msgs != NULL)
+		{
+			// First fixup with an expression a worker thread evaluated
+			ReplayMessages(xn->msgs);
+			free(xn->msgs);
+			xn->msgs = NULL;
+		}
+
+		*eval = xn->value;
+		*eattr = xn->attr;
+		*esym = xn->esym;
+
+		return OK;
+	}
+
+	// "symbol + addend" is ABS if the symbol is
+	SYM * sy = fup->symbol;
+	*eattr = sy->sattr;
+	*eval = (sy->sattr & DEFINED ? sy->svalue : 0) + fup->addend;
+	*esym = ((sy->sattr & (GLOBAL | DEFINED)) == GLOBAL ? sy : NULL);
+
+	if ((fup->attr & FU_ADDEND) && (sy->sattr & DEFINED) && !(sy->sattr & TDB))
+		*eattr = ABS | DEFINED;
+
+	return OK;
+}
+
+
+
+#if !defined(WIN32) && !defined(WIN64)
+// What the worker threads share; the assembler context belongs to the thread
+// that started them, so what they need of it is handed over here
+#define FIXUPPOOL struct _fixuppool
+FIXUPPOOL
+{
+	FIXUP ** fixup;				// Fixups whose expressions are to be evaluated
+	uint32_t count;				// # of them
+	uint32_t next;				// First one no worker thread has taken yet
+	pthread_mutex_t lock;		// Guards 'next'
+	EXPRNODE * node;			// The starting thread's exprnode[]
+	SYM ** symbols;				// Its symbolPtr[]
+};
+
+// A worker thread
+#define WORKER struct _worker
+WORKER
+{
+	FIXUPPOOL * pool;
+	pthread_t thread;
+	ERRSINK es;					// Its messages
+};
+
+
+//
+// Evaluate an expression on a worker thread, keeping its messages with it
+//
+static void EvalNode(EXPRNODE * xn, ERRSINK * es)
+{
+	uint64_t value;
+	WORD attr;
+	SYM * esym = NULL;
+	volatile int status = ERROR;
+	char * msgs = NULL;
+
+	es->used = 0;
+
+	// fatal() & interror() come back here
+	if (setjmp(es->bail) == 0)
+		status = evexpr(xn->expr, &value, &attr, &esym);
+
+	// Out of memory, leave it to EvalFixup() on the starting thread
+	if (es->used > 0)
+	{
+		if ((msgs = malloc(es->used + 1)) == NULL)
+			return;
+
+		memcpy(msgs, es->buf, es->used);
+		msgs[es->used] = EOS;
+	}
+
+	xn->msgs = msgs;
+
+	if (status != OK)
+	{
+		xn->failed = 1;
+		return;
+	}
+
+	xn->value = value;
+	xn->attr = attr;
+	xn->esym = esym;
+	xn->done = 1;
+}
+
+
+//
+// Worker thread: take the next FIXUPCHUNK fixups and evaluate the expressions
+// used first by them, until there are none left
+//
+static void * FixupWorker(void * arg)
+{
+	WORKER * w = arg;
+	FIXUPPOOL * pool = w->pool;
+	SYM ** saved = symbolPtr;
+
+	// evexpr() looks symbols up in symbolPtr[]
+	symbolPtr = pool->symbols;
+	SetErrorSink(&w->es);
+
+	for(;;)
+	{
+		pthread_mutex_lock(&pool->lock);
+		uint32_t first = pool->next;
+
+		if (first < pool->count)
+			pool->next += FIXUPCHUNK;
+
+		pthread_mutex_unlock(&pool->lock);
+
+		if (first >= pool->count)
+			break;
+
+		uint32_t last = (pool->count - first > FIXUPCHUNK ? first + FIXUPCHUNK : pool->count);
+
+		for(uint32_t i=first; i<last; i++)
+		{
+			EXPRNODE * xn = &pool->node[pool->fixup[i]->node];
+
+			if (xn->owner == i)
+				EvalNode(xn, &w->es);
+		}
+	}
+
+	SetErrorSink(NULL);
+	symbolPtr = saved;
+
+	return NULL;
+}
+#endif
+
+
+//
+// Evaluate the fixups' expressions on 'threads' threads (the calling one
+// included), ahead of ResolveFixups(). Each thread takes FIXUPCHUNK fixups at
+// a time and evaluates the expressions first used by them. Messages go to a
+// buffer for each thread and are kept with the expression; EvalFixup()
+// reports them when ResolveFixups() gets to the fixup, so they come out in
+// the same (file, line) order as without threads. Patching the code stays on
+// the calling thread, as fixups can share bytes.
+//
+void EvalFixupsInParallel(int threads)
+{
+#if !defined(WIN32) && !defined(WIN64)
+	FIXUPPOOL pool;
+	FIXUP * fup;
+	SYM * sy;
+	TOKEN * p;
+	int i;
+
+	if (threads < 2 || nexprnode == 0)
+		return;
+
+	for(uint32_t n=0; n<nexprnode; n++)
+		exprnode[n].owner = NONODE;
+
+	pool.count = 0;
+
+	for(i=0; i<NSECTS; i++)
+	{
+		for(fup=sect[i].sffix; fup!=NULL; fup=fup->next)
+		{
+			if ((fup->attr & FU_EXPR) && fup->node < nexprnode
+				&& !exprnode[fup->node].done)
+				pool.count++;
+		}
+	}
+
+	if (pool.count == 0)
+		return;
+
+	uint32_t chunks = (pool.count + FIXUPCHUNK - 1) / FIXUPCHUNK;
+
+	if ((uint32_t)threads > chunks)
+		threads = chunks;
+
+	pool.fixup = malloc(pool.count * sizeof(FIXUP *));
+	WORKER * worker = calloc(threads, sizeof(WORKER));
+
+	if (pool.fixup == NULL || worker == NULL)
+	{
+		free(worker);
+		free(pool.fixup);
+		return;
+	}
+
+	pool.count = 0;
+
+	// Each expression is evaluated for the first fixup using it. The symbols
+	// in it are marked REFERENCED here, so evexpr() leaves them alone.
+	for(i=0; i<NSECTS; i++)
+	{
+		for(fup=sect[i].sffix; fup!=NULL; fup=fup->next)
+		{
+			if (!(fup->attr & FU_EXPR) || fup->node >= nexprnode)
+				continue;
+
+			EXPRNODE * xn = &exprnode[fup->node];
+
+			if (xn->done)
+				continue;
+
+			if (xn->owner == NONODE)
+			{
+				xn->owner = pool.count;
+
+				for(p=xn->expr; (sy=NextSymbol(&p))!=NULL; )
+					sy->sattr |= REFERENCED;
+			}
+
+			pool.fixup[pool.count++] = fup;
+		}
+	}
+
+	pool.next = 0;
+	pool.node = exprnode;
+	pool.symbols = symbolPtr;
+	pthread_mutex_init(&pool.lock, NULL);
+
+	for(i=0; i<threads; i++)
+		worker[i].pool = &pool;
+
+	// If a thread can't be started, the others do its share
+	for(i=1; i<threads; i++)
+	{
+		if (pthread_create(&worker[i].thread, NULL, FixupWorker, &worker[i]) != 0)
+			break;
+	}
+
+	FixupWorker(&worker[0]);
+
+	while (--i > 0)
+		pthread_join(worker[i].thread, NULL);
+
+	for(i=0; i<threads; i++)
+		free(worker[i].es.buf);
+
+	pthread_mutex_destroy(&pool.lock);
+	free(worker);
+	free(pool.fixup);
+#endif
+}
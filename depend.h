@@ -0,0 +1,25 @@
+//
+// RMAC - Renamed Macro Assembler for all Atari computers
+// DEPEND.H - Dependency Graph of Equates & Fixups
+// Copyright (C) 199x Landon Dyer, 2011-2022 Reboot and Friends
+// RMAC derived from MADMAC v1.07 Written by Landon Dyer, 1986
+// Source utilised with the kind permission of Landon Dyer
+//
+
+#ifndef __DEPEND_H__
+#define __DEPEND_H__
+
+#include "rmac.h"
+#include "sect.h"
+
+#define NONODE  0xFFFFFFFF		// FIXUP has no expression node (yet)
+
+// Exported functions
+void InitDepend(void);
+void AddLateEquate(SYM *, TOKEN *);
+void ResolveDependencies(void);
+int EvalFixup(FIXUP *, uint64_t *, WORD *, SYM **);
+void EvalFixupsInParallel(int);
+
+#endif // __DEPEND_H__
+
@@ -13,13 +13,16 @@
 #include "error.h"
 #include "expr.h"
 #include "fltpoint.h"
+#include <math.h>
 #include "listing.h"
 #include "mach.h"
 #include "macro.h"
 #include "mark.h"
 #include "procln.h"
+#include "relax.h"
 #include "riscasm.h"
 #include "sect.h"
+#include "snapshot.h"
 #include "symbol.h"
 #include "token.h"
 
@@ -35,11 +38,10 @@
 #define DECL_REGRISC
 #include "riscregs.h"
 
-TOKEN exprbuf[128];			// Expression buffer
-SYM * symbolPtr[1000000];	// Symbol pointers table
-static long unused;			// For supressing 'write' warnings
-char buffer[256];			// Scratch buffer for messages
-int largestAlign[3] = { 2, 2, 2 };	// Largest alignment value seen per section
+ASMCTX TOKEN exprbuf[128];			// Expression buffer
+ASMCTX SYM ** symbolPtr;		// Symbol pointers table (grown by expr.c)
+ASMCTX char buffer[256];			// Scratch buffer for messages
+ASMCTX int largestAlign[3] = { 2, 2, 2 };	// Largest alignment value seen per section
 
 // Function prototypes
 int d_unimpl(void);
@@ -91,6 +93,7 @@ int d_opt(void);
 int d_dsp(void);
 int d_objproc(void);
 int d_align(void);
+int d_table(WORD);
 void SetLargestAlignment(int);
 
 // Directive handler table
@@ -164,7 +167,8 @@ int (*dirtab[])() = {
 	d_opt,				// 66 .opt
 	d_objproc,			// 67 .objproc
 	(void *)d_dsm,			// 68 .dsm
-	d_align				// 69 .align
+	d_align,			// 69 .align
+	(void *)d_table		// 70 .table
 };
 
 
@@ -389,6 +393,10 @@ int d_print(void)
 	SYM * esym;					// External symbol involved in expr.
 	TOKEN r_expr[EXPRSIZE];
 
+	// Nothing gets printed by sizing passes
+	if (relax_pass)
+		return 0;
+
 	while (*tok != EOL)
 	{
 		switch (*tok)
@@ -397,8 +405,8 @@ int d_print(void)
 			sprintf(prntstr, "%s", string[tok[1]]);
 			printf("%s", prntstr);
 
-			if (list_fd)
-				unused = write(list_fd, prntstr, (LONG)strlen(prntstr));
+			if (list_fd && !list_json)
+				ListingWrite(prntstr, strlen(prntstr));
 
 			tok += 2;
 			break;
@@ -462,8 +470,8 @@ int d_print(void)
 
 				printf("%s", prntstr);
 
-				if (list_fd)
-					unused = write(list_fd, prntstr, (LONG)strlen(prntstr));
+				if (list_fd && !list_json)
+					ListingWrite(prntstr, strlen(prntstr));
 
 				formatting = 0;
 				wordlong = 0;
@@ -569,16 +577,192 @@ int d_noclear(void)
 }
 
 
+//
+// .incbin transforms. Each turns the 'n' bytes at 'src' into no more than 'n'
+// bytes at 'dst' (which may be 'src'), and returns how many it made.
+//
+#define XF_SWAPW	1			// Swap the bytes of each word
+#define XF_SWAPL	2			// Reverse the bytes of each long
+#define XF_STRIDEW	3			// Every arg'th word
+#define XF_STRIDEL	4			// Every arg'th long
+#define XF_PACK4	5			// 8bpp pixels to 4bpp, 2 per byte
+#define XF_PACK2	6			// 8bpp pixels to 2bpp, 4 per byte
+#define XF_RGB16	7			// 24 bit R,G,B to Jaguar RGB16 (RRRRRBBBBBGGGGGG)
+
+#define INCBIN_MAXXFORM	4		// Most transforms on one .incbin
+
+static uint64_t SwapWords(uint8_t * dst, const uint8_t * src, uint64_t n)
+{
+	for(uint64_t i=0; i<n; i+=2)
+	{
+		uint8_t b0 = src[i], b1 = src[i + 1];
+		dst[i + 0] = b1;
+		dst[i + 1] = b0;
+	}
+
+	return n;
+}
+
+static uint64_t SwapLongs(uint8_t * dst, const uint8_t * src, uint64_t n)
+{
+	for(uint64_t i=0; i<n; i+=4)
+	{
+		uint8_t b0 = src[i], b1 = src[i + 1], b2 = src[i + 2], b3 = src[i + 3];
+		dst[i + 0] = b3;
+		dst[i + 1] = b2;
+		dst[i + 2] = b1;
+		dst[i + 3] = b0;
+	}
+
+	return n;
+}
+
+static uint64_t Stride(uint8_t * dst, const uint8_t * src, uint64_t n, int width, uint64_t every)
+{
+	uint64_t out = 0;
+
+	for(uint64_t i=0; i<n; i+=width*every, out+=width)
+	{
+		for(int j=0; j<width; j++)
+			dst[out + j] = src[i + j];
+	}
+
+	return out;
+}
+
+static uint64_t Pack4(uint8_t * dst, const uint8_t * src, uint64_t n)
+{
+	uint64_t i;
+
+	for(i=0; i+1<n; i+=2)
+		dst[i / 2] = (src[i] << 4) | (src[i + 1] & 0x0F);
+
+	// Odd pixel out: the low half is left clear
+	if (i < n)
+		dst[i / 2] = src[i] << 4;
+
+	return (n + 1) / 2;
+}
+
+static uint64_t Pack2(uint8_t * dst, const uint8_t * src, uint64_t n)
+{
+	for(uint64_t i=0; i<n; i+=4)
+	{
+		uint8_t b = 0;
+
+		for(int j=0; j<4; j++)
+			b = (b << 2) | (i + j < n ? src[i + j] & 0x03 : 0);
+
+		dst[i / 4] = b;
+	}
+
+	return (n + 3) / 4;
+}
+
+static uint64_t RGB16(uint8_t * dst, const uint8_t * src, uint64_t n)
+{
+	uint64_t out = 0;
+
+	for(uint64_t i=0; i<n; i+=3, out+=2)
+	{
+		uint16_t w = ((src[i] >> 3) << 11) | ((src[i + 2] >> 3) << 6)
+			| (src[i + 1] >> 2);
+		dst[out + 0] = w >> 8;
+		dst[out + 1] = w & 0xFF;
+	}
+
+	return out;
+}
+
+//
+// Parse the transforms at the end of an .incbin into 'xf' & 'xfarg'; returns
+// how many there are, or -1 if there's something wrong
+//
+static int IncbinTransforms(int * xf, uint64_t * xfarg)
+{
+	char name[16];
+	int n = 0;
+
+	while (*tok == ',')
+	{
+		tok++;
+
+		if (*tok != SYMBOL || strlen(string[tok[1]]) >= sizeof(name))
+		{
+			error("incbin transform expected");
+			return -1;
+		}
+
+		if (n == INCBIN_MAXXFORM)
+		{
+			error("too many incbin transforms");
+			return -1;
+		}
+
+		char * xfname = string[tok[1]];
+		int j;
+
+		for(j=0; xfname[j]!=EOS; j++)
+			name[j] = tolowertab[xfname[j] & 0x7F];
+
+		name[j] = EOS;
+		tok += 2;
+		TOKEN size = (*tok == DOTW || *tok == DOTL ? *tok++ : 0);
+		xfarg[n] = 0;
+
+		if (strcmp(name, "swap") == 0 && size != 0)
+			xf[n] = (size == DOTW ? XF_SWAPW : XF_SWAPL);
+		else if (strcmp(name, "stride") == 0 && size != 0)
+		{
+			xf[n] = (size == DOTW ? XF_STRIDEW : XF_STRIDEL);
+
+			if (abs_expr(&xfarg[n]) != OK)
+				return -1;
+
+			if ((int64_t)xfarg[n] <= 0)
+			{
+				error("invalid incbin stride");
+				return -1;
+			}
+		}
+		else if (strcmp(name, "pack4") == 0 && size == 0)
+			xf[n] = XF_PACK4;
+		else if (strcmp(name, "pack2") == 0 && size == 0)
+			xf[n] = XF_PACK2;
+		else if (strcmp(name, "rgb16") == 0 && size == 0)
+			xf[n] = XF_RGB16;
+		else
+		{
+			error("unknown incbin transform '%s'", xfname);
+			return -1;
+		}
+
+		n++;
+	}
+
+	if (*tok != EOL)
+	{
+		error("extra (unexpected) text found after incbin");
+		return -1;
+	}
+
+	return n;
+}
+
 //
 // Include binary file (can add addition size & position params, comma separated)
 //
 int d_incbin(void)
 {
-	int fd;
-	int bytes = 0;
+	const uint8_t * data;
+	size_t filesize;
 	uint64_t pos, size, bytesRead;
 	char buf1[256];
 	int i;
+	int sizeGiven = 0;
+	int xf[INCBIN_MAXXFORM];
+	uint64_t xfarg[INCBIN_MAXXFORM];
+	int nxf;
 
 	// Check to see if we're in BSS, and, if so, throw an error
 	if (scattr & SBSS)
@@ -598,19 +782,19 @@ int d_incbin(void)
 	// the "-i" option.
 	TOKEN filename = tok[1];
 
-	if ((fd = open(string[filename], _OPEN_INC)) < 0)
+	if ((data = MapInput(string[filename], &filesize)) == NULL)
 	{
 		for(i=0; nthpath("RMACPATH", i, buf1)!=0; i++)
 		{
-			fd = strlen(buf1);
+			int j = strlen(buf1);
 
 			// Append path char if necessary
-			if (fd > 0 && buf1[fd - 1] != SLASHCHAR)
+			if (j > 0 && buf1[j - 1] != SLASHCHAR)
 				strcat(buf1, SLASHSTRING);
 
 			strcat(buf1, string[filename]);
 
-			if ((fd = open(buf1, _OPEN_INC)) >= 0)
+			if ((data = MapInput(buf1, &filesize)) != NULL)
 				goto allright;
 		}
 
@@ -629,17 +813,17 @@ allright:
 			if (*tok != ',')
 			{
 				if (abs_expr(&size) != OK)
-				{
-					close(fd);
 					return ERROR;
-				}
+
 				if ((int64_t)size <= 0)
 				{
 					return error("invalid incbin size requested");
 				}
+
+				sizeGiven = 1;
 			}
 			else
-				size = lseek(fd, 0L, SEEK_END);
+				size = filesize;
 		}
 
 		// Check offset parameter (can be omitted)
@@ -647,45 +831,51 @@ allright:
 		{
 			if (*tok++ == ',')
 			{
-				if (*tok != EOL)
+				if (*tok != EOL && *tok != ',')
 				{
 					if (abs_expr(&pos) != OK)
-					{
-						close(fd);
 						return ERROR;
-					}
 
-					lseek(fd, pos, SEEK_SET);
 					if ((int64_t)(size - pos) < 0)
 					{
 						return error("requested incbin size out of range");
 					}
+
+					// No size given: the rest of the file
+					if (!sizeGiven)
+						size -= pos;
 				}
 				else
 				{
 					// offset parameter omitted, so it's 0
-					pos = lseek(fd, 0L, SEEK_SET);
+					pos = 0;
 				}
 			}
 			else
 				return error(comma_error);
 		}
 		else
-			pos = lseek(fd, 0L, SEEK_SET);
+			pos = 0;
 	}
 	else
 	{
 		// size & pos not given, so assume offset of 0 and all of the binary
-		size = lseek(fd, 0L, SEEK_END);
-		pos = lseek(fd, 0L, SEEK_SET);
+		size = filesize;
+		pos = 0;
 	}
 
+	if ((nxf = IncbinTransforms(xf, xfarg)) < 0)
+		return ERROR;
+
 	chcheck(size);
 
 	DEBUG { printf("INCBIN: File '%s' is %lli bytes.\n", string[filename], size); }
 
-	char * fileBuffer = (char *)malloc(size);
-	bytesRead = read(fd, fileBuffer, size);
+	// Straight from the file's contents into the section
+	bytesRead = (pos < filesize ? filesize - pos : 0);
+
+	if (bytesRead > size)
+		bytesRead = size;
 
 	if (bytesRead != size)
 	{
@@ -693,7 +883,33 @@ allright:
 		return ERROR;
 	}
 
-	memcpy(chptr, fileBuffer, size);
+	const uint8_t * src = data + pos;
+
+	if (nxf == 0)
+		memcpy(chptr, src, size);
+
+	// The first transform reads the file, the rest work on the section
+	for(i=0; i<nxf; i++, src=chptr)
+	{
+		int width = (xf[i] == XF_SWAPW || xf[i] == XF_STRIDEW ? 2
+			: xf[i] == XF_SWAPL || xf[i] == XF_STRIDEL ? 4
+			: xf[i] == XF_RGB16 ? 3 : 1);
+
+		if (size % width)
+			return error("incbin transform needs a multiple of %d bytes, not %lli", width, size);
+
+		switch (xf[i])
+		{
+		case XF_SWAPW:   size = SwapWords(chptr, src, size); break;
+		case XF_SWAPL:   size = SwapLongs(chptr, src, size); break;
+		case XF_STRIDEW: size = Stride(chptr, src, size, 2, xfarg[i]); break;
+		case XF_STRIDEL: size = Stride(chptr, src, size, 4, xfarg[i]); break;
+		case XF_PACK4:   size = Pack4(chptr, src, size); break;
+		case XF_PACK2:   size = Pack2(chptr, src, size); break;
+		case XF_RGB16:   size = RGB16(chptr, src, size); break;
+		}
+	}
+
 	chptr += size;
 	sloc += size;
 	ch_size += size;
@@ -701,8 +917,6 @@ allright:
 	if (orgactive)
 		orgaddr += size;
 
-	free(fileBuffer);
-	close(fd);
 	return 0;
 }
 
@@ -997,10 +1211,15 @@ int d_include(void)
 	if (*++tok != EOL)
 		return error("extra stuff after filename--enclose it in quotes");
 
+	// An assembly can be picked up again from here (see snapshot.c), if it's
+	// the top level source file doing the .include
+	if (cur_inobj->in_type == SRC_IFILE && cur_inobj->in_link == NULL)
+		Snapshot();
+
 	// Attempt to open the include file in the current directory, then (if that
 	// failed) try list of include files passed in the enviroment string or by
 	// the "-i" option.
-	if ((j = open(fn, 0)) < 0)
+	if ((j = OpenSource(fn)) == -1)
 	{
 		for(i=0; nthpath("RMACPATH", i, buf1)!=0; i++)
 		{
@@ -1012,7 +1231,7 @@ int d_include(void)
 
 			strcat(buf1, fn);
 
-			if ((j = open(buf1, 0)) >= 0)
+			if ((j = OpenSource(buf1)) != -1)
 				goto allright;
 		}
 
@@ -1300,6 +1519,113 @@ int d_dsm(WORD siz)
 }
 
 
+#define DEP_BLOCK_MAX	0x1000000	// Most bytes dc & dep_block() reserve at once
+
+//
+// If the dc element at 't' is a literal constant ("n" or "-n") followed by a
+// comma or EOL, set 'v' to its value and return the token after it; otherwise
+// return NULL
+//
+static TOKEN * LiteralValue(TOKEN * t, uint64_t * v)
+{
+	int neg = (*t == '-');
+	PTR ptk;
+
+	t += neg;
+
+	if (*t != CONST || (t[3] != ',' && t[3] != EOL))
+		return NULL;
+
+	ptk.u32 = t + 1;
+	*v = (neg ? (uint64_t)-(int64_t)*ptk.u64 : *ptk.u64);
+
+	return t + 3;
+}
+
+//
+// Fast path for dc.b/.w/.l: the run of literal constants (and, for dc.b,
+// strings) starting at 'tok' is range checked and then deposited with a single
+// chcheck(). Symbols, expressions and values out of range end the run and are
+// left to the general path. Returns the # of bytes deposited.
+//
+static uint32_t DepositLiterals(WORD siz)
+{
+	int width = (siz == SIZB ? 1 : siz == SIZL ? 4 : 2);
+	uint32_t size = 0;
+	uint64_t v;
+	TOKEN * t = tok, * end = tok, * next;
+
+	for(;;)
+	{
+		if (siz == SIZB && (*t == STRING || *t == STRINGA8) && (t[2] == ',' || t[2] == EOL))
+		{
+			size += strlen(string[t[1]]);
+			t += 2;
+		}
+		else if ((next = LiteralValue(t, &v)) != NULL
+			&& !(width == 1 && v + 0x100 >= 0x200)
+			&& !(width == 2 && v + 0x10000 >= 0x20000))
+			size += width, t = next;
+		else
+			break;
+
+		end = t;
+
+		if (*t++ != ',' || size >= DEP_BLOCK_MAX)
+			break;
+	}
+
+	if (size == 0)
+		return 0;
+
+	chcheck(size);
+	uint8_t * p = chptr;
+
+	for(t=tok; t<end; t++)
+	{
+		if (*t == STRING)
+		{
+			uint32_t n = strlen(string[t[1]]);
+			memcpy(p, string[t[1]], n);
+			p += n;
+			t += 2;
+			continue;
+		}
+		else if (*t == STRINGA8)
+		{
+			for(uint8_t * s=string[t[1]]; *s!=EOS; s++)
+				*p++ = strtoa8[*s];
+
+			t += 2;
+			continue;
+		}
+
+		t = LiteralValue(t, &v);
+
+		if (width == 1)
+			*p = (uint8_t)v;
+		else if (width == 4)
+			SETBE32(p, 0, v)
+		else if (cursect != M6502)
+			SETBE16(p, 0, v)
+		else
+			SETLE16(p, 0, v)
+
+		p += width;
+	}
+
+	chptr += size;
+	ch_size += size;
+	sloc += size;
+
+	if (orgactive)
+		orgaddr += size;
+
+	tok = end;
+	return size;
+}
+
+
 //
 // dc.b, dc.w / dc, dc.l, dc.i, dc.q, dc.d, dc.s, dc.x
 //
@@ -1327,6 +1653,11 @@ int d_dc(WORD siz)
 
 	for(;; tok++)
 	{
+		// Runs of literal values go in all at once
+		if (!dsp56001 && (siz == SIZB || siz == SIZW || siz == SIZN
+			|| (siz == SIZL && cursect != M6502)) && DepositLiterals(siz) > 0)
+			goto comma;
+
 		// dc.b 'string' [,] ...
 		if (siz == SIZB && (*tok == STRING || *tok == STRINGA8) && (tok[2] == ',' || tok[2] == EOL))
 		{
@@ -1736,15 +2067,35 @@ int d_init(WORD def_siz)
 	}
 }
 
-
 //
-// Deposit 'count' values of size 'siz' in the current (non-BSS) segment
+// Fill 'size' bytes at 'dst' with copies of the 'width' byte 'pattern',
+// doubling the part filled with each copy
 //
-int dep_block(uint32_t count, WORD siz, uint32_t eval, WORD eattr, TOKEN * exprbuf)
+static void FillPattern(uint8_t * dst, const uint8_t * pattern, int width, uint32_t size)
 {
-	WORD tdb = eattr & TDB;
-	WORD defined = eattr & DEFINED;
+	uint32_t done = width;
 
+	if (pattern[0] == 0 && (width == 1 || memcmp(pattern, pattern + 1, width - 1) == 0))
+	{
+		memset(dst, 0, size);
+		return;
+	}
+
+	memcpy(dst, pattern, width);
+
+	while (done < size)
+	{
+		uint32_t n = (done < size - done ? done : size - done);
+		memcpy(dst + done, dst, n);
+		done += n;
+	}
+}
+
+//
+// Deposit 'count' relocatable values of size 'siz', marking each one
+//
+static int dep_relocatable(uint32_t count, WORD siz, uint32_t eval, WORD tdb)
+{
 	while (count--)
 	{
 		if ((challoc - ch_size) < 4)
@@ -1753,68 +2104,321 @@ int dep_block(uint32_t count, WORD siz, uint32_t eval, WORD eattr, TOKEN * exprb
 		switch(siz)
 		{
 		case SIZB:
-			if (!defined)
-			{
-				AddFixup(FU_BYTE | FU_SEXT, sloc, exprbuf);
-				D_byte(0);
-			}
+			return error("non-absolute byte value");
+		case SIZW:
+		case SIZN:
+			MarkRelocatable(cursect, sloc, tdb, MWORD, NULL);
+
+			if (eval + 0x10000 >= 0x20000)
+				return error(range_error);
+
+			// Deposit 68000 or 6502 (byte-reversed) word
+			if (cursect != M6502)
+				D_word(eval)
 			else
-			{
-				if (tdb)
-					return error("non-absolute byte value");
+				D_rword(eval)
 
-				if (eval + 0x100 >= 0x200)
-					return error(range_error);
+			break;
+		case SIZL:
+			if (m6502)
+				return error(in_6502mode);
 
-				D_byte(eval);
-			}
+			MarkRelocatable(cursect, sloc, tdb, MLONG, NULL);
+			D_long(eval);
+			break;
+		}
+	}
+
+	return 0;
+}
+
+
+//
+// Deposit 'count' values of size 'siz' in the current (non-BSS) segment
+//
+int dep_block(uint32_t count, WORD siz, uint32_t eval, WORD eattr, TOKEN * exprbuf)
+{
+	WORD tdb = eattr & TDB;
+	WORD defined = eattr & DEFINED;
+	uint8_t pattern[4];
+	int width;
+	uint32_t attr;
+
+	if (count == 0)
+		return 0;
+
+	// Relocatable values are marked one at a time
+	if (defined && tdb)
+		return dep_relocatable(count, siz, eval, tdb);
+
+	switch (siz)
+	{
+	case SIZB:
+		if (defined && (eval + 0x100 >= 0x200))
+			return error(range_error);
+
+		pattern[0] = (uint8_t)eval;
+		width = 1;
+		attr = FU_BYTE | FU_SEXT;
+		break;
+	case SIZW:
+	case SIZN:
+		if (defined && (eval + 0x10000 >= 0x20000))
+			return error(range_error);
+
+		// 68000 or 6502 (byte-reversed) word
+		if (cursect != M6502)
+			SETBE16(pattern, 0, eval)
+		else
+			SETLE16(pattern, 0, eval)
+
+		width = 2;
+		attr = FU_WORD | FU_SEXT;
+		break;
+	case SIZL:
+		if (m6502)
+			return error(in_6502mode);
+
+		SETBE32(pattern, 0, eval);
+		width = 4;
+		attr = FU_LONG;
+		break;
+	default:
+		return 0;
+	}
+
+	// Undefined: zeroes, and a single fixup covering the lot
+	if (!defined)
+	{
+		memset(pattern, 0, sizeof(pattern));
+		AddFixup(attr, sloc, exprbuf);
+		sect[cursect].sfix->count = count;
+	}
+
+	// In pieces small enough for chcheck()
+	while (count > 0)
+	{
+		uint32_t n = (count < DEP_BLOCK_MAX / width ? count : DEP_BLOCK_MAX / width);
+		uint32_t size = n * width;
+
+		chcheck(size);
+		FillPattern(chptr, pattern, width, size);
+		chptr += size;
+		sloc += size;
+		ch_size += size;
+
+		if (orgactive)
+			orgaddr += size;
+
+		count -= n;
+	}
+
+	return 0;
+}
+
+//
+// .table functions: each element is func(start + i * step), the angles of
+// sin, cos & tan being in 1/count'ths of a full turn
+//
+#define TF_SIN		0
+#define TF_COS		1
+#define TF_TAN		2
+#define TF_RECIP	3
+#define TF_SQRT		4
+#define TF_LIN		5
+
+static const char * tablefunc[] = { "sin", "cos", "tan", "recip", "sqrt", "lin", NULL };
+
+//
+// Evaluate a .table parameter (integer or floating point)
+//
+static int TableParam(double * d)
+{
+	uint64_t eval;
+	WORD eattr;
+
+	if (expr(exprbuf, &eval, &eattr, NULL) != OK)
+		return ERROR;
+
+	if ((eattr & DEFINED) == 0 || (eattr & TDB))
+		return error("absolute value required for .table");
+
+	*d = (eattr & FLOAT ? *(double *)&eval : (double)(int64_t)eval);
+
+	return OK;
+}
+
+//
+// .table[.siz] count, function [, scale [, fracbits [, start [, step]]]]
+// Deposit 'count' values of 'function', times 'scale', as integers (with
+// 'fracbits' bits of fraction) or, if .s or .d, as floating point.
+//
+int d_table(WORD siz)
+{
+	uint64_t count, fracbits = 0;
+	double scale = 1.0, start = 0.0, step = 1.0;
+	int func;
+
+	if ((scattr & SBSS) != 0)
+		return error("illegal initialization of section");
 
+	if (abs_expr(&count) != OK)
+		return 0;
+
+	if (*tok++ != ',')
+		return error(comma_error);
+
+	if (*tok != SYMBOL)
+		return error(".table function missing");
+
+	char * fname = string[tok[1]];
+	char name[8];
+	int j;
+
+	for(j=0; fname[j]!=EOS && j<7; j++)
+		name[j] = tolowertab[fname[j] & 0x7F];
+
+	name[j] = EOS;
+
+	for(func=0; tablefunc[func]!=NULL; func++)
+	{
+		if (strcmp(name, tablefunc[func]) == 0)
 			break;
-		case SIZW:
-		case SIZN:
-			if (!defined)
+	}
+
+	if (tablefunc[func] == NULL)
+		return error("unknown .table function '%s'", string[tok[1]]);
+
+	tok += 2;
+
+	if (*tok == ',' && (tok++, TableParam(&scale) != OK))
+		return 0;
+
+	if (*tok == ',' && (tok++, abs_expr(&fracbits) != OK))
+		return 0;
+
+	if (*tok == ',' && (tok++, TableParam(&start) != OK))
+		return 0;
+
+	if (*tok == ',' && (tok++, TableParam(&step) != OK))
+		return 0;
+
+	if (ErrorIfNotAtEOL() == ERROR)
+		return 0;
+
+	// Size of each element; DSP56001 words are always 24 bits
+	int width = (siz == SIZB ? 1 : siz == SIZL || siz == SIZS ? 4 : siz == SIZD ? 8 : 2);
+	int bits = width * 8;
+
+	if (cursect & M56KPXYL)
+	{
+		if (cursect == M56001L)
+			return error(".table not allowed in L: memory");
+
+		if (siz != SIZN)
+			return error("DSP56001 .table takes no size");
+
+		width = 3;
+		bits = 24;
+	}
+	else if (siz != SIZB && siz != SIZW && siz != SIZN && siz != SIZL && siz != SIZS && siz != SIZD)
+		return error("bad .table size");
+	else if (cursect == M6502 && width > 2)
+		return error(in_6502mode);
+
+	if (fracbits >= (uint64_t)bits || ((siz == SIZS || siz == SIZD) && fracbits != 0))
+		return error("bad .table fraction bits");
+
+	if ((cursect & (M6502 | M56KPXYL)) == 0 && siz != SIZB && (sloc & 1))
+		auto_even();
+
+	// Fixed point values stop at the ends of the signed range; integers can be
+	// anything 'dc' would take
+	double mul = ldexp(scale, (int)fracbits);
+	double lo = -ldexp(1.0, bits - 1);
+	double hi = (fracbits ? ldexp(1.0, bits - 1) - 1 : ldexp(1.0, bits) - 1);
+	double turn = 2.0 * 3.14159265358979323846 / (double)(count ? count : 1);
+	uint64_t i = 0;
+
+	while (i < count)
+	{
+		uint64_t n = count - i;
+
+		if (n > DEP_BLOCK_MAX / width)
+			n = DEP_BLOCK_MAX / width;
+
+		chcheck((uint32_t)(n * width));
+		uint8_t * p = chptr;
+
+		for(uint64_t j=0; j<n; j++, i++, p+=width)
+		{
+			double x = start + (double)i * step, v;
+
+			switch (func)
 			{
-				AddFixup(FU_WORD | FU_SEXT, sloc, exprbuf);
-				D_word(0);
+			case TF_SIN:   v = sin(x * turn); break;
+			case TF_COS:   v = cos(x * turn); break;
+			case TF_TAN:   v = tan(x * turn); break;
+			case TF_RECIP: v = 1.0 / x; break;
+			case TF_SQRT:  v = sqrt(x); break;
+			default:       v = x; break;
 			}
-			else
+
+			if (siz == SIZS)
 			{
-				if (tdb)
-					MarkRelocatable(cursect, sloc, tdb, MWORD, NULL);
+				uint32_t f = FloatToIEEE754((float)(v * scale));
+				SETBE32(p, 0, f);
+				continue;
+			}
+			else if (siz == SIZD)
+			{
+				uint64_t d = DoubleToIEEE754(v * scale);
+				SETBE64(p, 0, d);
+				continue;
+			}
 
-				if (eval + 0x10000 >= 0x20000)
-					return error(range_error);
+			v = round(v * mul);
 
-				// Deposit 68000 or 6502 (byte-reversed) word
-				if (cursect != M6502)
-					D_word(eval)
-				else
-					D_rword(eval)
+			if (fracbits && v > hi)
+				v = hi;
+			else if (fracbits && v < lo)
+				v = lo;
 
-			}
+			// NaNs fail this too
+			if (!(v >= lo && v <= hi))
+				return error(".table value out of range (element %" PRIu64 ")", i);
 
-			break;
-		case SIZL:
-			if (m6502)
-				return error(in_6502mode);
+			uint32_t w = (uint32_t)(int64_t)v;
 
-			if (!defined)
+			switch (width)
 			{
-				AddFixup(FU_LONG, sloc, exprbuf);
-				D_long(0);
-			}
-			else
-			{
-				if (tdb)
-					MarkRelocatable(cursect, sloc, tdb, MLONG, NULL);
+			case 1: *p = (uint8_t)w; break;
+			case 2:
+				if (cursect != M6502)
+					SETBE16(p, 0, w)
+				else
+					SETLE16(p, 0, w)
 
-				D_long(eval);
+				break;
+			case 3: p[0] = (uint8_t)(w >> 16); p[1] = (uint8_t)(w >> 8); p[2] = (uint8_t)w; break;
+			case 4: SETBE32(p, 0, w); break;
 			}
-
-			break;
 		}
+
+		chptr += n * width;
+		ch_size += n * width;
+
+		// DSP56001 addresses go up by one for each word
+		uint32_t size = (uint32_t)(width == 3 ? n : n * width);
+		sloc += size;
+
+		if (orgactive)
+			orgaddr += size;
 	}
 
+	if (width == 3 && count > 0)
+		dsp_written_data_in_current_org = 1;
+
 	return 0;
 }
 
@@ -14,13 +14,13 @@
 
 // Imported variables
 
-extern char * label_defined;
+extern ASMCTX char * label_defined;
 
 // Exported variables
-extern TOKEN exprbuf[];
-extern SYM * symbolPtr[];
+extern ASMCTX TOKEN exprbuf[];
+extern ASMCTX SYM ** symbolPtr;
 extern int (* dirtab[])();
-extern int largestAlign[];
+extern ASMCTX int largestAlign[];
 
 // Exported functions
 void auto_even(void);
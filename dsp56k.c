@@ -9,7 +9,7 @@
 #include "rmac.h"
 #include "dsp56k.h"
 
-DSP_ORG dsp_orgmap[1024];		// Mark all 56001 org changes
-DSP_ORG * dsp_currentorg = &dsp_orgmap[0];
-int dsp_written_data_in_current_org = 0;
+ASMCTX DSP_ORG dsp_orgmap[1024];		// Mark all 56001 org changes
+ASMCTX DSP_ORG * dsp_currentorg;
+ASMCTX int dsp_written_data_in_current_org = 0;
 
@@ -33,9 +33,9 @@ DSP_ORG
 	CHUNK * chunk;
 };
 
-extern DSP_ORG dsp_orgmap[1024];		// Mark all 56001 org changes
-extern DSP_ORG * dsp_currentorg;
-extern int dsp_written_data_in_current_org;
+extern ASMCTX DSP_ORG dsp_orgmap[1024];		// Mark all 56001 org changes
+extern ASMCTX DSP_ORG * dsp_currentorg;
+extern ASMCTX int dsp_written_data_in_current_org;
 
 #define D_printf(...) chptr += sprintf(chptr, __VA_ARGS__)
 
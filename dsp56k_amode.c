@@ -21,50 +21,50 @@
 #include "56kregs.h"
 
 // Address-mode information
-int dsp_am0;					// Addressing mode
-int dsp_a0reg;					// Register
-TOKEN dsp_a0expr[EXPRSIZE];		// Expression
-uint64_t dsp_a0exval;			// Expression's value
-WORD dsp_a0exattr;				// Expression's attribute
-LONG dsp_a0memspace;			// Addressing mode's memory space (P, X, Y)
-SYM * dsp_a0esym;				// External symbol involved in expr
-
-int dsp_am1;					// Addressing mode
-int dsp_a1reg;					// Register
-TOKEN dsp_a1expr[EXPRSIZE];		// Expression
-uint64_t dsp_a1exval;			// Expression's value
-WORD dsp_a1exattr;				// Expression's attribute
-LONG dsp_a1memspace;			// Addressing mode's memory space (P, X, Y)
-SYM * dsp_a1esym;				// External symbol involved in expr
-
-int dsp_am2;					// Addressing mode
-int dsp_a2reg;					// Register
-TOKEN dsp_a2expr[EXPRSIZE];		// Expression
-uint64_t dsp_a2exval;			// Expression's value
-WORD dsp_a2exattr;				// Expression's attribute
-SYM * dsp_a2esym;				// External symbol involved in expr
-
-int dsp_am3;					// Addressing mode
-int dsp_a3reg;					// Register
-TOKEN dsp_a3expr[EXPRSIZE];		// Expression
-uint64_t dsp_a3exval;			// Expression's value
-WORD dsp_a3exattr;				// Expression's attribute
-SYM * dsp_a3esym;				// External symbol involved in expr
-
-TOKEN dspImmedEXPR[EXPRSIZE];	// Expression
-uint64_t dspImmedEXVAL;			// Expression's value
-WORD  dspImmedEXATTR;			// Expression's attribute
-SYM * dspImmedESYM;				// External symbol involved in expr
-int  deposit_extra_ea;			// Optional effective address extension
-TOKEN dspaaEXPR[EXPRSIZE];		// Expression
-uint64_t dspaaEXVAL;			// Expression's value
-WORD  dspaaEXATTR;				// Expression's attribute
-SYM * dspaaESYM;				// External symbol involved in expr
-
-LONG dsp_a0perspace;			// Peripheral space (X, Y - used in movep)
-LONG dsp_a1perspace;			// Peripheral space (X, Y - used in movep)
-
-int dsp_k;						// Multiplications sign
+ASMCTX int dsp_am0;					// Addressing mode
+ASMCTX int dsp_a0reg;					// Register
+ASMCTX TOKEN dsp_a0expr[EXPRSIZE];		// Expression
+ASMCTX uint64_t dsp_a0exval;			// Expression's value
+ASMCTX WORD dsp_a0exattr;				// Expression's attribute
+ASMCTX LONG dsp_a0memspace;			// Addressing mode's memory space (P, X, Y)
+ASMCTX SYM * dsp_a0esym;				// External symbol involved in expr
+
+ASMCTX int dsp_am1;					// Addressing mode
+ASMCTX int dsp_a1reg;					// Register
+ASMCTX TOKEN dsp_a1expr[EXPRSIZE];		// Expression
+ASMCTX uint64_t dsp_a1exval;			// Expression's value
+ASMCTX WORD dsp_a1exattr;				// Expression's attribute
+ASMCTX LONG dsp_a1memspace;			// Addressing mode's memory space (P, X, Y)
+ASMCTX SYM * dsp_a1esym;				// External symbol involved in expr
+
+ASMCTX int dsp_am2;					// Addressing mode
+ASMCTX int dsp_a2reg;					// Register
+ASMCTX TOKEN dsp_a2expr[EXPRSIZE];		// Expression
+ASMCTX uint64_t dsp_a2exval;			// Expression's value
+ASMCTX WORD dsp_a2exattr;				// Expression's attribute
+ASMCTX SYM * dsp_a2esym;				// External symbol involved in expr
+
+ASMCTX int dsp_am3;					// Addressing mode
+ASMCTX int dsp_a3reg;					// Register
+ASMCTX TOKEN dsp_a3expr[EXPRSIZE];		// Expression
+ASMCTX uint64_t dsp_a3exval;			// Expression's value
+ASMCTX WORD dsp_a3exattr;				// Expression's attribute
+ASMCTX SYM * dsp_a3esym;				// External symbol involved in expr
+
+ASMCTX TOKEN dspImmedEXPR[EXPRSIZE];	// Expression
+ASMCTX uint64_t dspImmedEXVAL;			// Expression's value
+ASMCTX WORD  dspImmedEXATTR;			// Expression's attribute
+ASMCTX SYM * dspImmedESYM;				// External symbol involved in expr
+ASMCTX int  deposit_extra_ea;			// Optional effective address extension
+ASMCTX TOKEN dspaaEXPR[EXPRSIZE];		// Expression
+ASMCTX uint64_t dspaaEXVAL;			// Expression's value
+ASMCTX WORD  dspaaEXATTR;				// Expression's attribute
+ASMCTX SYM * dspaaESYM;				// External symbol involved in expr
+
+ASMCTX LONG dsp_a0perspace;			// Peripheral space (X, Y - used in movep)
+ASMCTX LONG dsp_a1perspace;			// Peripheral space (X, Y - used in movep)
+
+ASMCTX int dsp_k;						// Multiplications sign
 
 static inline LONG checkea(const uint32_t termchar, const int strings);
 
@@ -78,7 +78,7 @@ static inline LONG checkea(const uint32_t termchar, const int strings);
 #define L_ERRORS 2
 #define P_ERRORS 3
 
-const char *ea_errors[][12] = {
+ASMCTX const char *ea_errors[][12] = {
 	// X:
 	{
 		"unrecognised X: parallel move syntax: expected '(' after 'X:-'",                                       // 0
@@ -19,8 +19,8 @@
 
 
 // Globals
-unsigned int dsp_orgaddr;	// DSP 56001 ORG address
-unsigned int dsp_orgseg;	// DSP 56001 ORG segment
+ASMCTX unsigned int dsp_orgaddr;	// DSP 56001 ORG address
+ASMCTX unsigned int dsp_orgseg;	// DSP 56001 ORG segment
 
 
 // Fucntion prototypes
@@ -14,8 +14,8 @@
 
 // Exported variables
 extern MNTABDSP dsp56k_machtab[];
-extern unsigned int dsp_orgaddr;
-extern unsigned int dsp_orgseg;
+extern ASMCTX unsigned int dsp_orgaddr;
+extern ASMCTX unsigned int dsp_orgseg;
 
 // Exported functions
 extern int dsp_mult(LONG inst);
@@ -0,0 +1,663 @@
+#ifdef DEF_DSP
+/*
+ *  Keyword definitions
+ */
+#define	DSP__56001	64
+#define	DSP__6502	2
+#define	DSP__68000	3
+#define	DSP__68020	58
+#define	DSP__68030	59
+#define	DSP__68040	60
+#define	DSP__68060	61
+#define	DSP__68881	62
+#define	DSP__68882	63
+#define	DSP__ABS	7
+#define	DSP__ALIGN	69
+#define	DSP__ASSERT	28
+#define	DSP__BSS	4
+#define	DSP__CARGS	10
+#define	DSP__CCUNDEF	51
+#define	DSP__COMM	8
+#define	DSP__CSTRUCT	53
+#define	DSP__DATA	5
+#define	DSP__DC	12
+#define	DSP__DCB	17
+#define	DSP__DISABLE	22
+#define	DSP__DPHRASE	42
+#define	DSP__DS	13
+#define	DSP__DSM	68
+#define	DSP__DSP	16
+#define	DSP__DUMP	20
+#define	DSP__EJECT	46
+#define	DSP__ELSE	501
+#define	DSP__ENABLE	23
+#define	DSP__END	34
+#define	DSP__ENDC	502
+#define	DSP__ENDIF	502
+#define	DSP__ENDM	505
+#define	DSP__ENDR	507
+#define	DSP__EQU	18
+#define	DSP__EQURUNDEF	50
+#define	DSP__ERROR	47
+#define	DSP__EVEN	1
+#define	DSP__EXITM	510
+#define	DSP__EXTERN	24
+#define	DSP__GLOBL	24
+#define	DSP__GOTO	11
+#define	DSP__GPU	15
+#define	DSP__GPUMAIN	56
+#define	DSP__IF	500
+#define	DSP__IIF	503
+#define	DSP__INCBIN	21
+#define	DSP__INCLUDE	33
+#define	DSP__INIT	9
+#define	DSP__JPAD	54
+#define	DSP__LIST	38
+#define	DSP__LONG	40
+#define	DSP__MACRO	504
+#define	DSP__MACUNDEF	14
+#define	DSP__NLIST	39
+#define	DSP__NOCLEAR	49
+#define	DSP__NOFPU	65
+#define	DSP__NOJPAD	55
+#define	DSP__NOLIST	39
+#define	DSP__OBJPROC	67
+#define	DSP__OFFSET	7
+#define	DSP__OPT	66
+#define	DSP__ORG	0
+#define	DSP__PHRASE	41
+#define	DSP__PRGFLAGS	57
+#define	DSP__PRINT	52
+#define	DSP__QPHRASE	43
+#define	DSP__REGBANK0	25
+#define	DSP__REGBANK1	26
+#define	DSP__REGUNDEF	50
+#define	DSP__REPT	506
+#define	DSP__SUBTTL	45
+#define	DSP__TABLE	70
+#define	DSP__TEXT	6
+#define	DSP__TITLE	44
+#define	DSP__UNDEFMAC	14
+#define	DSP__WARN	48
+#define	DSP_ABS	2001
+#define	DSP_ADC	2035
+#define	DSP_ADD	2010
+#define	DSP_ADDL	2008
+#define	DSP_ADDR	2009
+#define	DSP_AND	2037
+#define	DSP_ANDI	2041
+#define	DSP_ASL	2002
+#define	DSP_ASR	2003
+#define	DSP_ASSERT	28
+#define	DSP_BCHG	2158
+#define	DSP_BCLR	2167
+#define	DSP_BSET	2176
+#define	DSP_BSS	4
+#define	DSP_BTST	2185
+#define	DSP_CARGS	10
+#define	DSP_CCUNDEF	51
+#define	DSP_CLR	2004
+#define	DSP_CMP	2012
+#define	DSP_CMPM	2014
+#define	DSP_COMM	8
+#define	DSP_CSTRUCT	53
+#define	DSP_DATA	5
+#define	DSP_DC	12
+#define	DSP_DCB	17
+#define	DSP_DEBUG	2316
+#define	DSP_DEBUGCC	2317
+#define	DSP_DEBUGCS	2319
+#define	DSP_DEBUGEC	2321
+#define	DSP_DEBUGEQ	2322
+#define	DSP_DEBUGES	2323
+#define	DSP_DEBUGGE	2324
+#define	DSP_DEBUGGT	2325
+#define	DSP_DEBUGHS	2318
+#define	DSP_DEBUGLC	2326
+#define	DSP_DEBUGLE	2327
+#define	DSP_DEBUGLO	2320
+#define	DSP_DEBUGLS	2328
+#define	DSP_DEBUGLT	2329
+#define	DSP_DEBUGMI	2330
+#define	DSP_DEBUGNE	2331
+#define	DSP_DEBUGNN	2334
+#define	DSP_DEBUGNR	2332
+#define	DSP_DEBUGPL	2333
+#define	DSP_DISABLE	22
+#define	DSP_DIV	2039
+#define	DSP_DO	2194
+#define	DSP_DPHRASE	42
+#define	DSP_DS	13
+#define	DSP_DSM	68
+#define	DSP_DUMP	20
+#define	DSP_EJECT	46
+#define	DSP_ELSE	501
+#define	DSP_ENABLE	23
+#define	DSP_END	34
+#define	DSP_ENDC	502
+#define	DSP_ENDDO	2026
+#define	DSP_ENDIF	502
+#define	DSP_ENDM	505
+#define	DSP_ENDR	507
+#define	DSP_EOR	2038
+#define	DSP_EQU	18
+#define	DSP_EQURUNDEF	50
+#define	DSP_ERROR	47
+#define	DSP_EVEN	1
+#define	DSP_EXITM	510
+#define	DSP_EXTERN	24
+#define	DSP_GLOBL	24
+#define	DSP_GOTO	11
+#define	DSP_GPUMAIN	56
+#define	DSP_IF	500
+#define	DSP_IIF	503
+#define	DSP_ILLEGAL	2027
+#define	DSP_INCBIN	21
+#define	DSP_INCLUDE	33
+#define	DSP_INIT	9
+#define	DSP_JCC	2079
+#define	DSP_JCLR	2239
+#define	DSP_JCS	2083
+#define	DSP_JEC	2087
+#define	DSP_JEQ	2089
+#define	DSP_JES	2091
+#define	DSP_JGE	2097
+#define	DSP_JGT	2095
+#define	DSP_JHS	2081
+#define	DSP_JLC	2099
+#define	DSP_JLE	2101
+#define	DSP_JLO	2085
+#define	DSP_JLS	2103
+#define	DSP_JLT	2105
+#define	DSP_JMI	2107
+#define	DSP_JMP	2117
+#define	DSP_JNE	2109
+#define	DSP_JNN	2115
+#define	DSP_JNR	2111
+#define	DSP_JPAD	54
+#define	DSP_JPL	2113
+#define	DSP_JSCC	2119
+#define	DSP_JSCLR	2212
+#define	DSP_JSCS	2123
+#define	DSP_JSEC	2127
+#define	DSP_JSEQ	2129
+#define	DSP_JSES	2131
+#define	DSP_JSET	2221
+#define	DSP_JSGE	2133
+#define	DSP_JSGT	2135
+#define	DSP_JSHS	2121
+#define	DSP_JSLC	2137
+#define	DSP_JSLE	2139
+#define	DSP_JSLO	2125
+#define	DSP_JSLS	2141
+#define	DSP_JSLT	2143
+#define	DSP_JSMI	2145
+#define	DSP_JSNE	2147
+#define	DSP_JSNN	2153
+#define	DSP_JSNR	2149
+#define	DSP_JSPL	2151
+#define	DSP_JSR	2155
+#define	DSP_JSSET	2230
+#define	DSP_LIST	38
+#define	DSP_LONG	40
+#define	DSP_LSL	2005
+#define	DSP_LSR	2006
+#define	DSP_LUA	2248
+#define	DSP_MAC	2293
+#define	DSP_MACR	2294
+#define	DSP_MACRO	504
+#define	DSP_MACUNDEF	14
+#define	DSP_MOVE	2250
+#define	DSP_MOVEC	2251
+#define	DSP_MOVEM	2269
+#define	DSP_MOVEP	2297
+#define	DSP_MPY	2295
+#define	DSP_MPYR	2296
+#define	DSP_NEG	2157
+#define	DSP_NLIST	39
+#define	DSP_NOCLEAR	49
+#define	DSP_NOFPU	65
+#define	DSP_NOJPAD	55
+#define	DSP_NOLIST	39
+#define	DSP_NOP	2028
+#define	DSP_NORM	2249
+#define	DSP_NOT	2007
+#define	DSP_OFFSET	7
+#define	DSP_OPT	66
+#define	DSP_OR	2040
+#define	DSP_ORG	0
+#define	DSP_ORI	2042
+#define	DSP_PHRASE	41
+#define	DSP_PRGFLAGS	57
+#define	DSP_PRINT	52
+#define	DSP_QPHRASE	43
+#define	DSP_REGUNDEF	50
+#define	DSP_REP	2203
+#define	DSP_REPT	506
+#define	DSP_RESET	2029
+#define	DSP_RND	2020
+#define	DSP_ROL	2021
+#define	DSP_ROR	2022
+#define	DSP_RTI	2030
+#define	DSP_RTS	2031
+#define	DSP_SBC	2036
+#define	DSP_STOP	2032
+#define	DSP_SUB	2016
+#define	DSP_SUBL	2023
+#define	DSP_SUBR	2024
+#define	DSP_SUBTTL	45
+#define	DSP_SWI	2033
+#define	DSP_TCC	2043
+#define	DSP_TCS	2047
+#define	DSP_TEC	2051
+#define	DSP_TEQ	2053
+#define	DSP_TES	2055
+#define	DSP_TEXT	6
+#define	DSP_TFR	2018
+#define	DSP_TGE	2057
+#define	DSP_TGT	2059
+#define	DSP_THS	2045
+#define	DSP_TITLE	44
+#define	DSP_TLC	2061
+#define	DSP_TLE	2063
+#define	DSP_TLO	2049
+#define	DSP_TLS	2065
+#define	DSP_TLT	2067
+#define	DSP_TMI	2069
+#define	DSP_TNE	2071
+#define	DSP_TNN	2077
+#define	DSP_TNR	2073
+#define	DSP_TPL	2075
+#define	DSP_TST	2025
+#define	DSP_UNDEFMAC	14
+#define	DSP_WAIT	2034
+#define	DSP_WARN	48
+#endif
+
+#ifdef DECL_DSP
+/*
+ *  keyword state-machine tables
+ *
+ */
+
+int dspbase[473] = {
+ 0, 23, 43, 31, 51, 64, 72, 43,
+ 62, 90, 92, 76, 100, 102, 70, 6,
+ 109, 114, 133, 15, 5, 0, 0, 98,
+ 12, 129, 150, 146, 110, 47, 32, 66,
+ 7, 116, 159, 125, 33, 6, 39, 171,
+ 58, 98, 100, 151, 117, 155, 170, 174,
+ 108, 132, 136, 144, 165, 170, 164, 165,
+ 184, 185, 169, 181, 177, 179, 189, 176,
+ 195, 179, 177, 182, 196, 193, 188, 184,
+ 184, 200, 195, 205, 206, 207, 207, 192,
+ 214, 206, 218, 219, 232, 197, 207, 229,
+ 227, 227, 216, 217, 236, 240, 249, 247,
+ 234, 249, 239, 253, 255, 257, 262, 256,
+ 261, 268, 257, 273, 268, 275, 276, 263,
+ 277, 264, 264, 283, 276, 287, 275, 269,
+ 286, 290, 0, 1, 2, 272, 287, 285,
+ 287, 289, 288, 297, 291, 292, 311, 295,
+ 307, 303, 304, 313, 301, 320, 301, 305,
+ 320, 317, 312, 308, 308, 324, 329, 330,
+ 314, 320, 332, 327, 336, 330, 335, 323,
+ 337, 327, 340, 342, 344, 350, 351, 330,
+ 335, 352, 339, 346, 350, 356, 355, 345,
+ 345, 346, 360, 354, 356, 357, 353, 371,
+ 352, 373, 357, 360, 374, 373, 377, 377,
+ 364, 368, 370, 365, 382, 386, 374, 378,
+ 387, 391, 374, 378, 393, 395, 396, 397,
+ 381, 403, 392, 406, 392, 400, 389, 403,
+ 407, 407, 401, 402, 414, 411, 413, 421,
+ 418, 413, 432, 428, 421, 418, 416, 418,
+ 434, 424, 429, 422, 431, 439, 425, 432,
+ 3, 2, 9, 6, 441, 445, 444, 438,
+ 440, 436, 454, 455, 439, 442, 456, 455,
+ 459, 459, 445, 449, 451, 446, 462, 467,
+ 455, 458, 471, 454, 471, 456, 471, 461,
+ 461, 469, 468, 469, 477, 471, 469, 488,
+ 484, 477, 474, 491, 474, 475, 484, 477,
+ 486, 494, 486, 483, 483, 499, 483, 498,
+ 504, 506, 488, 497, 495, 505, 492, 496,
+ 502, 498, 505, 517, 512, 511, 500, 504,
+ 503, 509, 511, 523, 507, 523, 508, 529,
+ 512, 527, 514, 522, 515, 536, 524, 520,
+ 521, 537, 537, 6, 16, 17, 18, 19,
+ 20, 20, 530, 527, 527, 543, 527, 547,
+ 549, 531, 540, 547, 533, 537, 543, 539,
+ 546, 558, 551, 540, 547, 549, 544, 560,
+ 545, 566, 549, 551, 565, 552, 560, 553,
+ 573, 574, 562, 557, 573, 574, 574, 561,
+ 577, 580, 581, 573, 568, 585, 577, 578,
+ 587, 597, 585, 596, 597, 601, 599, 584,
+ 585, 601, 606, 589, 605, 598, 598, 592,
+ 608, 611, 603, 597, 612, 604, 605, 611,
+ 607, 618, 619, 623, 621, 606, 612, 608,
+ 624, 629, 612, 618, 629, 622, 622, 630,
+ 617, 635, 636, 636, 621, 642, 633, 645,
+ 631, 639, 641, 644, 635, 639, 647, 653,
+ 642, 657, 660, 661, 666, 662, 649, 665,
+ 666, 668, 659, 669, 670, 658, 674, 671,
+ 674, 669, 676, 681, 678, 678, 666, 680,
+ 684, 683, 683, 671, 23, 685, 689, 687,
+ 688
+};
+
+int dsptab[817] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, 1, -1,
+ 240, 241, 242, 331, -2, 123, 122, -2,
+ 124, 332, 243, 333, 334, 335, 337, 336,
+ -2, -2, -2, -2, -2, -2, -2, -2,
+ -2, -1, -1, -1, 21, 22, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 2, 3, 4, 5, 6, 121, 7,
+ 154, 8, 9, 164, 10, 11, 12, 13,
+ 14, 15, 16, 17, 18, 19, 100, 20,
+ 23, 24, 25, 26, 27, 120, 28, 128,
+ 29, 30, 46, 31, 32, 33, 34, 35,
+ 36, 37, 38, 39, 40, 42, 41, 43,
+ 151, 163, 47, 48, 49, -2, 50, 70,
+ 149, 44, 71, 72, 165, 150, 45, 51,
+ 52, 55, 53, 56, -2, 57, 54, 73,
+ 169, 58, 74, 152, 75, 89, 98, -2,
+ 59, 153, 62, 60, 63, 61, 64, 65,
+ 99, 66, 67, 90, 91, 76, 68, 77,
+ 69, 78, 79, 170, 125, 85, 80, 81,
+ 82, 92, 83, 86, 95, 84, 126, 87,
+ 93, 88, 101, 94, 105, 127, 96, -2,
+ 97, 172, 146, 102, 103, 147, 148, 177,
+ 155, 104, 129, 156, 130, 161, 106, 107,
+ 109, 108, 110, 111, 112, 113, 114, 162,
+ 131, 115, 116, 117, 132, 118, 178, 133,
+ 119, 134, -2, 171, 139, 179, 140, 135,
+ 141, 157, -2, 142, 143, 158, 136, -2,
+ 144, 137, 145, 138, 166, -2, 173, 159,
+ 167, 160, 174, 176, 168, 180, 175, 181,
+ 182, 183, -2, 184, 185, 186, -2, -2,
+ 187, -2, 188, 189, 190, -2, 192, 191,
+ 193, 194, 195, 197, 198, 199, -2, 200,
+ 201, -2, -2, -2, -2, 196, 202, -2,
+ 214, -2, 203, -2, 204, 215, -2, -2,
+ -2, -2, -2, -2, -2, -2, 216, -2,
+ -2, -2, -2, 205, -2, 206, 217, 207,
+ 208, -2, 218, -2, 209, 210, 211, -2,
+ 212, 219, -2, 213, 220, 225, -2, 221,
+ -2, 226, -2, 222, 227, 223, 228, 229,
+ 230, -2, -2, 224, -2, -2, -2, -2,
+ 233, 231, -2, 234, 232, -2, -2, -2,
+ -2, -2, -2, -2, 236, -2, -2, -2,
+ -2, -2, 237, -2, -2, -2, -2, -2,
+ 244, -2, -2, 238, 235, -2, -2, -2,
+ 245, -2, -2, 246, 239, 247, 248, 249,
+ 250, -2, 251, 252, -2, 253, 254, -2,
+ 255, 256, 258, 259, 257, 260, 261, 263,
+ 264, 265, -2, 268, 266, 269, 270, 271,
+ 272, 262, 267, 273, 277, 278, 274, -2,
+ -2, 279, 275, 280, 276, 281, 282, 283,
+ 285, 286, 287, 288, 289, 290, -2, -2,
+ 284, 291, -2, -2, -2, -2, -2, 292,
+ 293, -2, -2, 294, -2, 295, 296, 297,
+ -2, 298, -2, 299, -2, 300, 302, 303,
+ -2, 304, 301, 305, 306, -2, -2, 307,
+ 308, 309, -2, -2, -2, -2, -2, -2,
+ -2, -2, -2, 310, -2, 312, -2, 311,
+ -2, -2, -2, -2, 315, -2, -2, -2,
+ -2, -2, -2, -2, -2, 316, -2, -2,
+ -2, 313, 317, 318, 314, 319, 320, -2,
+ 321, 322, 323, 324, 325, 326, -2, 327,
+ -2, -2, -2, 329, 330, -2, -2, -2,
+ 338, 328, 339, 340, 341, -2, 342, -2,
+ 343, 344, -2, 345, -2, 346, -2, 348,
+ 349, -2, 350, 351, 347, 352, -2, 353,
+ -2, 354, -2, -2, -2, -2, -2, 356,
+ 358, 359, 357, 355, 360, 361, 362, 363,
+ 364, 365, 366, 367, 368, 369, -2, 371,
+ 372, -2, 373, 374, -2, 375, -2, 376,
+ 377, 378, 379, 380, -2, 381, -2, -2,
+ 370, 382, -2, -2, 383, -2, 384, 385,
+ 386, 387, -2, -2, -2, 388, -2, -2,
+ 389, -2, 390, 391, 392, 393, 394, -2,
+ -2, 395, 396, -2, -2, 397, -2, 398,
+ -2, 399, -2, 400, 401, 402, 403, -2,
+ 404, -2, 405, -2, -2, 406, -2, 407,
+ 408, 409, -2, 410, -2, 411, -2, 412,
+ 413, 414, 415, 416, 417, -2, 418, 419,
+ 420, 421, -2, -2, 422, -2, 423, 424,
+ 425, 433, 426, 434, 427, 428, -2, 435,
+ -2, 429, 430, 431, 436, 432, 437, -2,
+ 438, 439, 440, -2, -2, -2, -2, 441,
+ 442, 443, -2, 444, -2, 445, 446, 447,
+ 448, -2, 449, -2, 450, -2, 451, 452,
+ 453, -2, -2, 454, -2, -2, 455, 456,
+ 457, 458, -2, 459, -2, -2, -2, -2,
+ -2, -2, -2, -2, -2, -2, -2, -2,
+ 460, -2, -2, -2, -2, -2, -2, -2,
+ -2, -2, 461, -2, -2, -2, -2, -2,
+ 462, -2, 463, 464, -2, -2, -2, -2,
+ 465, -2, -2, 466, -2, -2, 467, -2,
+ 468, 469, 470, 471, -2, -2, -2, -2,
+ 472, -2, -2, -2, -2, -2, -2, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1
+};
+
+int dspcheck[817] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, 0, -1,
+ 122, 123, 124, 240, 241, 22, 21, 331,
+ 22, 242, 124, 242, 242, 242, 243, 242,
+ 332, 333, 334, 335, 336, 337, 337, 468,
+ 468, -1, -1, -1, 1, 1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 0, 0, 0, 0, 0, 20, 0,
+ 32, 0, 0, 37, 0, 0, 0, 0,
+ 0, 0, 0, 0, 0, 0, 15, 0,
+ 1, 1, 1, 1, 1, 19, 1, 24,
+ 1, 1, 3, 1, 1, 1, 1, 1,
+ 1, 1, 1, 1, 1, 2, 1, 2,
+ 30, 36, 3, 3, 4, 29, 4, 7,
+ 29, 2, 7, 7, 38, 29, 2, 4,
+ 4, 5, 4, 5, 8, 5, 4, 8,
+ 40, 5, 8, 31, 8, 11, 14, 5,
+ 5, 31, 6, 5, 6, 5, 6, 6,
+ 14, 6, 6, 11, 11, 9, 6, 9,
+ 6, 9, 9, 41, 23, 10, 9, 9,
+ 9, 12, 9, 10, 13, 9, 23, 10,
+ 12, 10, 16, 12, 17, 23, 13, 42,
+ 13, 44, 28, 16, 16, 28, 28, 48,
+ 33, 16, 25, 33, 25, 35, 17, 17,
+ 18, 17, 18, 18, 18, 18, 18, 35,
+ 25, 18, 18, 18, 25, 18, 49, 26,
+ 18, 26, 43, 43, 27, 50, 27, 26,
+ 27, 34, 51, 27, 27, 34, 26, 45,
+ 27, 26, 27, 26, 39, 45, 45, 34,
+ 39, 34, 46, 47, 39, 52, 46, 53,
+ 54, 55, 56, 57, 58, 59, 60, 58,
+ 61, 47, 62, 63, 64, 65, 66, 64,
+ 67, 68, 69, 70, 71, 72, 73, 74,
+ 75, 76, 77, 79, 78, 69, 75, 81,
+ 85, 80, 76, 80, 83, 86, 81, 82,
+ 77, 76, 77, 78, 88, 80, 89, 83,
+ 82, 80, 80, 84, 82, 84, 90, 84,
+ 84, 87, 91, 92, 84, 84, 84, 87,
+ 84, 93, 84, 84, 94, 95, 96, 94,
+ 97, 98, 97, 94, 99, 94, 99, 100,
+ 101, 94, 102, 94, 103, 94, 104, 105,
+ 106, 101, 103, 107, 101, 108, 109, 110,
+ 104, 111, 112, 113, 114, 116, 115, 118,
+ 115, 119, 120, 125, 117, 110, 109, 110,
+ 126, 112, 115, 121, 110, 117, 115, 115,
+ 127, 117, 128, 129, 121, 130, 131, 132,
+ 133, 134, 135, 136, 137, 138, 139, 137,
+ 140, 141, 142, 143, 141, 144, 145, 146,
+ 147, 148, 149, 151, 150, 152, 153, 154,
+ 155, 145, 150, 156, 157, 158, 156, 159,
+ 160, 161, 156, 162, 156, 162, 163, 164,
+ 165, 166, 167, 168, 169, 170, 171, 172,
+ 164, 173, 174, 175, 171, 176, 177, 178,
+ 179, 180, 181, 182, 183, 184, 185, 186,
+ 187, 188, 189, 190, 191, 191, 192, 193,
+ 194, 195, 191, 196, 197, 198, 191, 199,
+ 200, 201, 202, 191, 203, 204, 205, 206,
+ 208, 210, 207, 201, 212, 213, 209, 205,
+ 209, 214, 215, 211, 217, 206, 205, 206,
+ 206, 207, 209, 218, 211, 219, 209, 209,
+ 211, 216, 220, 221, 216, 222, 223, 224,
+ 225, 226, 227, 228, 229, 230, 231, 232,
+ 233, 234, 235, 236, 237, 238, 239, 234,
+ 244, 234, 245, 246, 247, 248, 249, 250,
+ 251, 252, 253, 254, 255, 256, 257, 258,
+ 259, 260, 261, 262, 257, 263, 264, 265,
+ 257, 266, 267, 268, 269, 257, 270, 271,
+ 272, 273, 271, 266, 274, 275, 276, 277,
+ 278, 279, 280, 281, 282, 283, 284, 285,
+ 286, 287, 288, 289, 290, 291, 292, 293,
+ 294, 295, 296, 297, 298, 299, 300, 301,
+ 283, 302, 303, 304, 305, 306, 307, 308,
+ 309, 310, 311, 312, 313, 314, 315, 316,
+ 317, 318, 319, 320, 321, 322, 323, 324,
+ 315, 325, 326, 315, 327, 328, 329, 330,
+ 338, 339, 340, 341, 342, 343, 344, 345,
+ 346, 347, 348, 349, 350, 351, 352, 353,
+ 354, 355, 356, 357, 358, 359, 360, 361,
+ 362, 363, 364, 365, 366, 367, 368, 369,
+ 370, 371, 372, 373, 374, 375, 376, 377,
+ 378, 379, 378, 380, 378, 378, 381, 382,
+ 383, 378, 378, 378, 384, 378, 385, 386,
+ 387, 388, 389, 390, 391, 392, 393, 394,
+ 395, 396, 397, 398, 399, 400, 401, 402,
+ 403, 404, 405, 406, 407, 408, 409, 410,
+ 411, 412, 413, 414, 415, 416, 417, 418,
+ 419, 420, 421, 422, 423, 424, 425, 426,
+ 428, 427, 430, 432, 433, 429, 434, 429,
+ 435, 436, 431, 437, 438, 426, 425, 426,
+ 427, 429, 439, 431, 440, 429, 429, 431,
+ 441, 442, 443, 444, 445, 446, 447, 448,
+ 449, 450, 451, 452, 453, 454, 455, 456,
+ 457, 458, 459, 460, 461, 462, 463, 464,
+ 465, 466, 467, 469, 470, 471, 472, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1
+};
+
+int dspaccept[817] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, 2, -1, -1, 64,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ 3, 58, 59, 60, 61, 62, 63, 25,
+ 26, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, 500, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, 12, 500, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, 2194,
+ -1, -1, -1, 13, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, 2001,
+ 2040, 2037, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 12, 2035, 2010, -1, -1, -1, -1,
+ -1, -1, 2004, -1, -1, -1, -1, 2002,
+ -1, 13, -1, -1, -1, 2003, -1, -1,
+ -1, -1, -1, -1, -1, 2012, -1, -1,
+ -1, -1, 17, -1, -1, -1, 68, 2039,
+ -1, 4, -1, -1, -1, 2038, 18, 34,
+ -1, -1, -1, -1, -1, -1, 503, -1,
+ -1, 2079, 2087, 2081, 2097, -1, -1, 2107,
+ -1, 2099, -1, 2101, -1, -1, 2117, 2109,
+ 2089, 2083, 2091, 2095, 2248, 2085, 2293, 2113,
+ 2115, 2103, 2105, -1, 2111, -1, -1, -1,
+ -1, 2005, 2295, 2157, -1, -1, -1, 2006,
+ -1, -1, 2155, -1, -1, -1, 66, -1,
+ 0, -1, 2042, -1, -1, -1, -1, -1,
+ -1, 2028, 2020, -1, 2021, 2007, 2030, 2036,
+ -1, 2203, 2022, 2016, -1, 2033, 2043, 2051,
+ 2031, 2018, 2057, 2045, -1, 2069, 2061, 2075,
+ 2063, 2025, -1, 7, 2071, 2053, 2047, 2055,
+ -1, 2059, 2049, -1, -1, 2077, 2065, 2067,
+ -1, 2073, 4, -1, -1, -1, -1, -1,
+ -1, 17, -1, -1, 68, -1, -1, 16,
+ -1, -1, 18, -1, 34, -1, -1, -1,
+ -1, 15, 503, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, 66,
+ 0, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, 2008, 2041,
+ -1, -1, 2158, 2167, 2009, 2176, 2185, -1,
+ -1, 2014, 8, -1, 5, -1, -1, -1,
+ 20, -1, 501, -1, 502, -1, -1, -1,
+ 1, -1, -1, -1, -1, 11, 505, -1,
+ -1, -1, 9, 507, 2239, 54, 2119, 2127,
+ 2121, 2145, 2133, -1, 2151, -1, 2137, -1,
+ 2139, 38, 40, 2147, 2250, 2129, 2123, 2131,
+ 2221, 2135, 2125, 2296, 2153, -1, 2141, 2143,
+ 2149, 2294, -1, -1, -1, -1, -1, 2249,
+ -1, -1, -1, -1, -1, -1, 506, -1,
+ 2032, 2023, 6, -1, -1, 2034, 48, 2024,
+ -1, -1, -1, -1, -1, 8, -1, 5,
+ -1, -1, 20, -1, 501, -1, 502, -1,
+ -1, 1, -1, -1, -1, -1, 11, -1,
+ 505, -1, 9, 54, 38, 507, 40, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, 506, -1,
+ -1, 6, -1, -1, 48, -1, 10, -1,
+ -1, 2316, -1, -1, 46, -1, 2026, 502,
+ -1, -1, 47, 510, -1, 24, -1, -1,
+ -1, -1, 2212, 2230, 504, -1, 2251, 39,
+ -1, 65, -1, -1, -1, -1, -1, 52,
+ 2269, -1, -1, 2297, 2029, -1, 44, -1,
+ 69, -1, 10, -1, -1, -1, -1, 46,
+ -1, 502, -1, 47, 510, -1, 24, -1,
+ -1, -1, 504, -1, 39, -1, 65, -1,
+ -1, -1, -1, -1, -1, 52, -1, -1,
+ -1, -1, 70, 44, -1, 28, -1, -1,
+ -1, -1, -1, -1, -1, -1, 23, -1,
+ 24, -1, -1, -1, -1, -1, -1, 21,
+ -1, -1, -1, 55, 39, 7, 41, -1,
+ -1, -1, 45, -1, 28, -1, -1, -1,
+ -1, 23, -1, 24, -1, 21, -1, -1,
+ -1, 55, 39, -1, 7, 41, -1, -1,
+ -1, -1, 45, -1, 51, 53, 2317, 2321,
+ 2318, 2324, 2330, 2333, 22, 2326, 42, 2327,
+ -1, 56, 2331, 2027, 33, 2322, 2319, 2323,
+ 2325, 2320, -1, 2334, 49, 2328, 2329, 2332,
+ -1, 43, -1, -1, 51, 53, 22, 42,
+ -1, 56, 33, -1, 49, 67, -1, 43,
+ -1, -1, -1, -1, 14, 57, 50, 14,
+ -1, 14, 57, 50, 14, 50, 50, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1
+};
+#endif
@@ -0,0 +1,334 @@
+/*   1 abs   */  {M_ACC56, M_AM_NONE, PARMOVE, 0x000026, 0, dsp_ab},
+/*   2 asl   */  {M_ACC56, M_AM_NONE, PARMOVE, 0x000032, 0, dsp_ab},
+/*   3 asr   */  {M_ACC56, M_AM_NONE, PARMOVE, 0x000022, 0, dsp_ab},
+/*   4 clr   */  {M_ACC56, M_AM_NONE, PARMOVE, 0x000013, 0, dsp_ab},
+/*   5 lsl   */  {M_ACC56, M_AM_NONE, PARMOVE, 0x000033, 0, dsp_ab},
+/*   6 lsr   */  {M_ACC56, M_AM_NONE, PARMOVE, 0x000023, 0, dsp_ab},
+/*   7 not   */  {M_ACC56, M_AM_NONE, PARMOVE, 0x000017, 0, dsp_ab},
+/*   8 addl  */  {M_ACC56, M_ACC56, PARMOVE, 0x000012, 0, dsp_baab},
+/*   9 addr  */  {M_ACC56, M_ACC56, PARMOVE, 0x000002, 0, dsp_baab},
+/*  10 add   */  {M_ACC56, M_ACC56, PARMOVE, 0x000010, 11, dsp_baab},
+/*  11 -     */  {M_ALL48, M_ACC56, PARMOVE, 0x000000, 0, dsp_acc48},
+/*  12 cmp   */  {M_ACC56, M_ACC56, PARMOVE, 0x000005, 13, dsp_baab},
+/*  13 -     */  {M_ALU24, M_ACC56, PARMOVE, 0x000005, 0, dsp_acc48},
+/*  14 cmpm  */  {M_ACC56, M_ACC56, PARMOVE, 0x000007, 15, dsp_baab},
+/*  15 -     */  {M_ALU24, M_ACC56, PARMOVE, 0x000007, 0, dsp_acc48},
+/*  16 sub   */  {M_ACC56, M_ACC56, PARMOVE, 0x000014, 17, dsp_baab},
+/*  17 -     */  {M_ALL48, M_ACC56, PARMOVE, 0x000004, 0, dsp_acc48},
+/*  18 tfr   */  {M_ACC56, M_ACC56, PARMOVE, 0x000001, 19, dsp_baab},
+/*  19 -     */  {M_ALU24, M_ACC56, PARMOVE, 0x000001, 0, dsp_acc48},
+/*  20 rnd   */  {M_ACC56, M_AM_NONE, PARMOVE, 0x000011, 0, dsp_ab},
+/*  21 rol   */  {M_ACC56, M_AM_NONE, PARMOVE, 0x000037, 0, dsp_ab},
+/*  22 ror   */  {M_ACC56, M_AM_NONE, PARMOVE, 0x000027, 0, dsp_ab},
+/*  23 subl  */  {M_ACC56, M_ACC56, PARMOVE, 0x000016, 0, dsp_baab},
+/*  24 subr  */  {M_ACC56, M_ACC56, PARMOVE, 0x000006, 0, dsp_baab},
+/*  25 tst   */  {M_ACC56, M_AM_NONE, PARMOVE, 0x000003, 0, dsp_ab},
+/*  26 enddo */  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x00008c, 0, dsp_self},
+/*  27 illegal*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000005, 0, dsp_self},
+/*  28 nop   */  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000000, 0, dsp_self},
+/*  29 reset */  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000084, 0, dsp_self},
+/*  30 rti   */  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000004, 0, dsp_self},
+/*  31 rts   */  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x00000c, 0, dsp_self},
+/*  32 stop  */  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000087, 0, dsp_self},
+/*  33 swi   */  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000006, 0, dsp_self},
+/*  34 wait  */  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000086, 0, dsp_self},
+/*  35 adc   */  {M_INP48, M_ACC56, PARMOVE, 0x000021, 0, dsp_xyab},
+/*  36 sbc   */  {M_INP48, M_ACC56, PARMOVE, 0x000025, 0, dsp_xyab},
+/*  37 and   */  {M_ALU24, M_ACC56, PARMOVE, 0x000046, 0, dsp_x0y0ab},
+/*  38 eor   */  {M_ALU24, M_ACC56, PARMOVE, 0x000043, 0, dsp_x0y0ab},
+/*  39 div   */  {M_ALU24, M_ACC56, NOPARMO, 0x018040, 0, dsp_x0y0ab},
+/*  40 or    */  {M_ALU24, M_ACC56, PARMOVE, 0x000042, 0, dsp_x0y0ab},
+/*  41 andi  */  {M_DSPIM8, M_DSPPCU, NOPARMO, 0x0000b8, 0, dsp_immcr},
+/*  42 ori   */  {M_DSPIM8, M_DSPPCU, NOPARMO, 0x0000f8, 0, dsp_immcr},
+/*  43 tcc   */  {M_ACC56, M_ACC56, NOPARMO, 0x020000, 44, dsp_baab},
+/*  44 -     */  {M_ALL48, M_ACC56, NOPARMO, 0x020000, 0, dsp_tcc2},
+/*  45 ths   */  {M_ACC56, M_ACC56, NOPARMO, 0x020000, 46, dsp_baab},
+/*  46 -     */  {M_ALL48, M_ACC56, NOPARMO, 0x020000, 0, dsp_tcc2},
+/*  47 tcs   */  {M_ACC56, M_ACC56, NOPARMO, 0x028000, 48, dsp_baab},
+/*  48 -     */  {M_ALL48, M_ACC56, NOPARMO, 0x028000, 0, dsp_tcc2},
+/*  49 tlo   */  {M_ACC56, M_ACC56, NOPARMO, 0x028000, 50, dsp_baab},
+/*  50 -     */  {M_ALL48, M_ACC56, NOPARMO, 0x028000, 0, dsp_tcc2},
+/*  51 tec   */  {M_ACC56, M_ACC56, NOPARMO, 0x025000, 52, dsp_baab},
+/*  52 -     */  {M_ALL48, M_ACC56, NOPARMO, 0x025000, 0, dsp_tcc2},
+/*  53 teq   */  {M_ACC56, M_ACC56, NOPARMO, 0x02a000, 54, dsp_baab},
+/*  54 -     */  {M_ALL48, M_ACC56, NOPARMO, 0x02a000, 0, dsp_tcc2},
+/*  55 tes   */  {M_ACC56, M_ACC56, NOPARMO, 0x02d000, 56, dsp_baab},
+/*  56 -     */  {M_ALL48, M_ACC56, NOPARMO, 0x02d000, 0, dsp_tcc2},
+/*  57 tge   */  {M_ACC56, M_ACC56, NOPARMO, 0x021000, 58, dsp_baab},
+/*  58 -     */  {M_ALL48, M_ACC56, NOPARMO, 0x021000, 0, dsp_tcc2},
+/*  59 tgt   */  {M_ACC56, M_ACC56, NOPARMO, 0x027000, 60, dsp_baab},
+/*  60 -     */  {M_ALL48, M_ACC56, NOPARMO, 0x027000, 0, dsp_tcc2},
+/*  61 tlc   */  {M_ACC56, M_ACC56, NOPARMO, 0x026000, 62, dsp_baab},
+/*  62 -     */  {M_ALL48, M_ACC56, NOPARMO, 0x026000, 0, dsp_tcc2},
+/*  63 tle   */  {M_ACC56, M_ACC56, NOPARMO, 0x02f000, 64, dsp_baab},
+/*  64 -     */  {M_ALL48, M_ACC56, NOPARMO, 0x02f000, 0, dsp_tcc2},
+/*  65 tls   */  {M_ACC56, M_ACC56, NOPARMO, 0x02e000, 66, dsp_baab},
+/*  66 -     */  {M_ALL48, M_ACC56, NOPARMO, 0x02e000, 0, dsp_tcc2},
+/*  67 tlt   */  {M_ACC56, M_ACC56, NOPARMO, 0x029000, 68, dsp_baab},
+/*  68 -     */  {M_ALL48, M_ACC56, NOPARMO, 0x029000, 0, dsp_tcc2},
+/*  69 tmi   */  {M_ACC56, M_ACC56, NOPARMO, 0x02b000, 70, dsp_baab},
+/*  70 -     */  {M_ALL48, M_ACC56, NOPARMO, 0x02b000, 0, dsp_tcc2},
+/*  71 tne   */  {M_ACC56, M_ACC56, NOPARMO, 0x022000, 72, dsp_baab},
+/*  72 -     */  {M_ALL48, M_ACC56, NOPARMO, 0x022000, 0, dsp_tcc2},
+/*  73 tnr   */  {M_ACC56, M_ACC56, NOPARMO, 0x02c000, 74, dsp_baab},
+/*  74 -     */  {M_ALL48, M_ACC56, NOPARMO, 0x02c000, 0, dsp_tcc2},
+/*  75 tpl   */  {M_ACC56, M_ACC56, NOPARMO, 0x023000, 76, dsp_baab},
+/*  76 -     */  {M_ALL48, M_ACC56, NOPARMO, 0x023000, 0, dsp_tcc2},
+/*  77 tnn   */  {M_ACC56, M_ACC56, NOPARMO, 0x024000, 78, dsp_baab},
+/*  78 -     */  {M_ALL48, M_ACC56, NOPARMO, 0x024000, 0, dsp_tcc2},
+/*  79 jcc   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0e0000, 80, dsp_abs12},
+/*  80 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0a0, 0, dsp_ea},
+/*  81 jhs   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0e0000, 82, dsp_abs12},
+/*  82 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0a0, 0, dsp_ea},
+/*  83 jcs   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0e8000, 84, dsp_abs12},
+/*  84 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0a8, 0, dsp_ea},
+/*  85 jlo   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0e8000, 86, dsp_abs12},
+/*  86 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0a8, 0, dsp_ea},
+/*  87 jec   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0e5000, 88, dsp_abs12},
+/*  88 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0a5, 0, dsp_ea},
+/*  89 jeq   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0ea000, 90, dsp_abs12},
+/*  90 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0aa, 0, dsp_ea},
+/*  91 jes   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0ed000, 92, dsp_abs12},
+/*  92 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0ad, 0, dsp_ea},
+/*  93 jge   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0e1000, 94, dsp_abs12},
+/*  94 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0a1, 0, dsp_ea},
+/*  95 jgt   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0e7000, 96, dsp_abs12},
+/*  96 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0a7, 0, dsp_ea},
+/*  97 jge   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0e1000, 98, dsp_abs12},
+/*  98 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0a1, 0, dsp_ea},
+/*  99 jlc   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0e6000, 100, dsp_abs12},
+/* 100 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0a6, 0, dsp_ea},
+/* 101 jle   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0ef000, 102, dsp_abs12},
+/* 102 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0af, 0, dsp_ea},
+/* 103 jls   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0ee000, 104, dsp_abs12},
+/* 104 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0ae, 0, dsp_ea},
+/* 105 jlt   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0e9000, 106, dsp_abs12},
+/* 106 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0a9, 0, dsp_ea},
+/* 107 jmi   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0eb000, 108, dsp_abs12},
+/* 108 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0ab, 0, dsp_ea},
+/* 109 jne   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0e2000, 110, dsp_abs12},
+/* 110 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0a2, 0, dsp_ea},
+/* 111 jnr   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0ec000, 112, dsp_abs12},
+/* 112 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0ac, 0, dsp_ea},
+/* 113 jpl   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0e3000, 114, dsp_abs12},
+/* 114 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0a3, 0, dsp_ea},
+/* 115 jnn   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0e4000, 116, dsp_abs12},
+/* 116 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac0a4, 0, dsp_ea},
+/* 117 jmp   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0c0000, 118, dsp_abs12},
+/* 118 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0ac080, 0, dsp_ea},
+/* 119 jscc  */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0f0000, 120, dsp_abs12},
+/* 120 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc0a0, 0, dsp_ea},
+/* 121 jshs  */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0f0000, 122, dsp_abs12},
+/* 122 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc0a0, 0, dsp_ea},
+/* 123 jscs  */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0f8000, 124, dsp_abs12},
+/* 124 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc0a8, 0, dsp_ea},
+/* 125 jslo  */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0f8000, 126, dsp_abs12},
+/* 126 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc0a8, 0, dsp_ea},
+/* 127 jsec  */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0f5000, 128, dsp_abs12},
+/* 128 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc0a5, 0, dsp_ea},
+/* 129 jseq  */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0fa000, 130, dsp_abs12},
+/* 130 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc0aa, 0, dsp_ea},
+/* 131 jses  */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0fd000, 132, dsp_abs12},
+/* 132 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc0ad, 0, dsp_ea},
+/* 133 jsge  */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0f1000, 134, dsp_abs12},
+/* 134 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc0a1, 0, dsp_ea},
+/* 135 jsgt  */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0f7000, 136, dsp_abs12},
+/* 136 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc0a7, 0, dsp_ea},
+/* 137 jslc  */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0f6000, 138, dsp_abs12},
+/* 138 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc0a6, 0, dsp_ea},
+/* 139 jsle  */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0ff000, 140, dsp_abs12},
+/* 140 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc0af, 0, dsp_ea},
+/* 141 jsls  */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0fe000, 142, dsp_abs12},
+/* 142 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc0ae, 0, dsp_ea},
+/* 143 jslt  */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0f9000, 144, dsp_abs12},
+/* 144 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc0a9, 0, dsp_ea},
+/* 145 jsmi  */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0fb000, 146, dsp_abs12},
+/* 146 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc0ab, 0, dsp_ea},
+/* 147 jsne  */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0f2000, 148, dsp_abs12},
+/* 148 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc0a2, 0, dsp_ea},
+/* 149 jsnr  */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0fc000, 150, dsp_abs12},
+/* 150 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc0ac, 0, dsp_ea},
+/* 151 jspl  */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0f3000, 152, dsp_abs12},
+/* 152 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc0a3, 0, dsp_ea},
+/* 153 jsnn  */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0f4000, 154, dsp_abs12},
+/* 154 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc0a4, 0, dsp_ea},
+/* 155 jsr   */  {M_DSPABS12, M_AM_NONE, NOPARMO, 0x0d0000, 156, dsp_abs12},
+/* 156 -     */  {C_DSPABSEA, M_AM_NONE, NOPARMO, 0x0bc080, 0, dsp_ea},
+/* 157 neg   */  {M_ACC56, M_AM_NONE, PARMOVE, 0x000036, 0, dsp_ab},
+/* 158 bchg  */  {C_DSPIM, M_DSPEA, NOPARMO, 0x0b4000, 159, dsp_ea_imm5},
+/* 159 -     */  {C_DSPIM, M_DSPAA, NOPARMO, 0x0b0000, 160, dsp_ea_imm5},
+/* 160 -     */  {C_DSPIM, M_DSPPP, NOPARMO, 0x0b8000, 161, dsp_ea_imm5},
+/* 161 -     */  {C_DSPIM, C_DD, NOPARMO, 0x0bc440, 162, dsp_reg_imm5},
+/* 162 -     */  {C_DSPIM, C_DDD, NOPARMO, 0x0bc840, 163, dsp_reg_imm5},
+/* 163 -     */  {C_DSPIM, C_TTT, NOPARMO, 0x0bd040, 164, dsp_reg_imm5},
+/* 164 -     */  {C_DSPIM, C_NNN, NOPARMO, 0x0bd840, 165, dsp_reg_imm5},
+/* 165 -     */  {C_DSPIM, C_FFF, NOPARMO, 0x0be040, 166, dsp_reg_imm5},
+/* 166 -     */  {C_DSPIM, C_GGG, NOPARMO, 0x0bf840, 0, dsp_reg_imm5},
+/* 167 bclr  */  {C_DSPIM, M_DSPEA, NOPARMO, 0x0a4000, 168, dsp_ea_imm5},
+/* 168 -     */  {C_DSPIM, M_DSPAA, NOPARMO, 0x0a0000, 169, dsp_ea_imm5},
+/* 169 -     */  {C_DSPIM, M_DSPPP, NOPARMO, 0x0a8000, 170, dsp_ea_imm5},
+/* 170 -     */  {C_DSPIM, C_DDD, NOPARMO, 0x0ac840, 171, dsp_reg_imm5},
+/* 171 -     */  {C_DSPIM, C_DD, NOPARMO, 0x0ac440, 172, dsp_reg_imm5},
+/* 172 -     */  {C_DSPIM, C_TTT, NOPARMO, 0x0ad040, 173, dsp_reg_imm5},
+/* 173 -     */  {C_DSPIM, C_NNN, NOPARMO, 0x0ad840, 174, dsp_reg_imm5},
+/* 174 -     */  {C_DSPIM, C_FFF, NOPARMO, 0x0ae040, 175, dsp_reg_imm5},
+/* 175 -     */  {C_DSPIM, C_GGG, NOPARMO, 0x0af840, 0, dsp_reg_imm5},
+/* 176 bset  */  {C_DSPIM, M_DSPEA, NOPARMO, 0x0a4020, 177, dsp_ea_imm5},
+/* 177 -     */  {C_DSPIM, M_DSPAA, NOPARMO, 0x0a0020, 178, dsp_ea_imm5},
+/* 178 -     */  {C_DSPIM, M_DSPPP, NOPARMO, 0x0a8020, 179, dsp_ea_imm5},
+/* 179 -     */  {C_DSPIM, C_DD, NOPARMO, 0x0ac460, 180, dsp_reg_imm5},
+/* 180 -     */  {C_DSPIM, C_DDD, NOPARMO, 0x0ac860, 181, dsp_reg_imm5},
+/* 181 -     */  {C_DSPIM, C_TTT, NOPARMO, 0x0ad060, 182, dsp_reg_imm5},
+/* 182 -     */  {C_DSPIM, C_NNN, NOPARMO, 0x0ad860, 183, dsp_reg_imm5},
+/* 183 -     */  {C_DSPIM, C_FFF, NOPARMO, 0x0ae060, 184, dsp_reg_imm5},
+/* 184 -     */  {C_DSPIM, C_GGG, NOPARMO, 0x0af860, 0, dsp_reg_imm5},
+/* 185 btst  */  {C_DSPIM, M_DSPEA, NOPARMO, 0x0b4020, 186, dsp_ea_imm5},
+/* 186 -     */  {C_DSPIM, M_DSPAA, NOPARMO, 0x0b0020, 187, dsp_ea_imm5},
+/* 187 -     */  {C_DSPIM, M_DSPPP, NOPARMO, 0x0b8020, 188, dsp_ea_imm5},
+/* 188 -     */  {C_DSPIM, C_DDD, NOPARMO, 0x0bc860, 189, dsp_reg_imm5},
+/* 189 -     */  {C_DSPIM, C_DD, NOPARMO, 0x0bc460, 190, dsp_reg_imm5},
+/* 190 -     */  {C_DSPIM, C_TTT, NOPARMO, 0x0bd060, 191, dsp_reg_imm5},
+/* 191 -     */  {C_DSPIM, C_NNN, NOPARMO, 0x0bd860, 192, dsp_reg_imm5},
+/* 192 -     */  {C_DSPIM, C_FFF, NOPARMO, 0x0be060, 193, dsp_reg_imm5},
+/* 193 -     */  {C_DSPIM, C_GGG, NOPARMO, 0x0bf860, 0, dsp_reg_imm5},
+/* 194 do    */  {M_DSPEA, C_DSPABS24, NOPARMO, 0x064000, 195, dsp_ea_abs16},
+/* 195 -     */  {M_DSPAA, C_DSPABS24, NOPARMO, 0x060000, 196, dsp_ea_abs16},
+/* 196 -     */  {C_DSPIM, C_DSPABS24, NOPARMO, 0x060080, 197, dsp_imm12_abs16},
+/* 197 -     */  {M_ALU24, C_DSPABS24, NOPARMO, 0x06c000, 198, dsp_alu24_abs16},
+/* 198 -     */  {C_DDD, C_DSPABS24, NOPARMO, 0x06c800, 199, dsp_reg_abs16},
+/* 199 -     */  {C_TTT, C_DSPABS24, NOPARMO, 0x06d000, 200, dsp_reg_abs16},
+/* 200 -     */  {C_NNN, C_DSPABS24, NOPARMO, 0x06d800, 201, dsp_reg_abs16},
+/* 201 -     */  {C_FFF, C_DSPABS24, NOPARMO, 0x06e000, 202, dsp_reg_abs16},
+/* 202 -     */  {C_GGG, C_DSPABS24, NOPARMO, 0x06f800, 0, dsp_reg_abs16},
+/* 203 rep   */  {C_DSPIM, M_AM_NONE, NOPARMO, 0x0600a0, 204, dsp_imm12},
+/* 204 -     */  {M_DSPEA, M_AM_NONE, NOPARMO, 0x064020, 205, dsp_ea},
+/* 205 -     */  {M_DSPAA, M_AM_NONE, NOPARMO, 0x060020, 206, dsp_ea},
+/* 206 -     */  {M_ALU24, M_AM_NONE, NOPARMO, 0x06c020, 207, dsp_alu24},
+/* 207 -     */  {C_DDD, M_AM_NONE, NOPARMO, 0x06c820, 208, dsp_reg},
+/* 208 -     */  {C_TTT, M_AM_NONE, NOPARMO, 0x06d020, 209, dsp_reg},
+/* 209 -     */  {C_NNN, M_AM_NONE, NOPARMO, 0x06d820, 210, dsp_reg},
+/* 210 -     */  {C_FFF, M_AM_NONE, NOPARMO, 0x06e020, 211, dsp_reg},
+/* 211 -     */  {C_GGG, M_AM_NONE, NOPARMO, 0x06f820, 0, dsp_reg},
+/* 212 jsclr */  {C_DSPIM, M_DSPEA, NOPARMO, 0x0b4080, 213, dsp_ea_imm5_abs16},
+/* 213 -     */  {C_DSPIM, M_DSPAA, NOPARMO, 0x0b0080, 214, dsp_ea_imm5_abs16},
+/* 214 -     */  {C_DSPIM, M_DSPPP, NOPARMO, 0x0b8080, 215, dsp_ea_imm5_abs16},
+/* 215 -     */  {C_DSPIM, C_DD, NOPARMO, 0x0bc400, 216, dsp_reg_imm5_abs16},
+/* 216 -     */  {C_DSPIM, C_DDD, NOPARMO, 0x0bc800, 217, dsp_reg_imm5_abs16},
+/* 217 -     */  {C_DSPIM, C_TTT, NOPARMO, 0x0bd000, 218, dsp_reg_imm5_abs16},
+/* 218 -     */  {C_DSPIM, C_NNN, NOPARMO, 0x0bd800, 219, dsp_reg_imm5_abs16},
+/* 219 -     */  {C_DSPIM, C_FFF, NOPARMO, 0x0be000, 220, dsp_reg_imm5_abs16},
+/* 220 -     */  {C_DSPIM, C_GGG, NOPARMO, 0x0be800, 0, dsp_reg_imm5_abs16},
+/* 221 jset  */  {C_DSPIM, M_DSPEA, NOPARMO, 0x0a40a0, 222, dsp_ea_imm5_abs16},
+/* 222 -     */  {C_DSPIM, M_DSPAA, NOPARMO, 0x0a00a0, 223, dsp_ea_imm5_abs16},
+/* 223 -     */  {C_DSPIM, M_DSPPP, NOPARMO, 0x0a80a0, 224, dsp_ea_imm5_abs16},
+/* 224 -     */  {C_DSPIM, C_DD, NOPARMO, 0x0ac420, 225, dsp_reg_imm5_abs16},
+/* 225 -     */  {C_DSPIM, C_DDD, NOPARMO, 0x0ac820, 226, dsp_reg_imm5_abs16},
+/* 226 -     */  {C_DSPIM, C_TTT, NOPARMO, 0x0ad020, 227, dsp_reg_imm5_abs16},
+/* 227 -     */  {C_DSPIM, C_NNN, NOPARMO, 0x0ad820, 228, dsp_reg_imm5_abs16},
+/* 228 -     */  {C_DSPIM, C_FFF, NOPARMO, 0x0ae020, 229, dsp_reg_imm5_abs16},
+/* 229 -     */  {C_DSPIM, C_GGG, NOPARMO, 0x0ae820, 0, dsp_reg_imm5_abs16},
+/* 230 jsset */  {C_DSPIM, M_DSPEA, NOPARMO, 0x0b40a0, 231, dsp_ea_imm5_abs16},
+/* 231 -     */  {C_DSPIM, M_DSPAA, NOPARMO, 0x0b00a0, 232, dsp_ea_imm5_abs16},
+/* 232 -     */  {C_DSPIM, M_DSPPP, NOPARMO, 0x0b80a0, 233, dsp_ea_imm5_abs16},
+/* 233 -     */  {C_DSPIM, C_DD, NOPARMO, 0x0bc420, 234, dsp_reg_imm5_abs16},
+/* 234 -     */  {C_DSPIM, C_DDD, NOPARMO, 0x0bc820, 235, dsp_reg_imm5_abs16},
+/* 235 -     */  {C_DSPIM, C_TTT, NOPARMO, 0x0bd020, 236, dsp_reg_imm5_abs16},
+/* 236 -     */  {C_DSPIM, C_NNN, NOPARMO, 0x0bd820, 237, dsp_reg_imm5_abs16},
+/* 237 -     */  {C_DSPIM, C_FFF, NOPARMO, 0x0be020, 238, dsp_reg_imm5_abs16},
+/* 238 -     */  {C_DSPIM, C_GGG, NOPARMO, 0x0be820, 0, dsp_reg_imm5_abs16},
+/* 239 jclr  */  {C_DSPIM, M_DSPEA, NOPARMO, 0x0a4080, 240, dsp_ea_imm5_abs16},
+/* 240 -     */  {C_DSPIM, M_DSPAA, NOPARMO, 0x0a0080, 241, dsp_ea_imm5_abs16},
+/* 241 -     */  {C_DSPIM, M_DSPPP, NOPARMO, 0x0a8080, 242, dsp_ea_imm5_abs16},
+/* 242 -     */  {C_DSPIM, C_DD, NOPARMO, 0x0ac400, 243, dsp_reg_imm5_abs16},
+/* 243 -     */  {C_DSPIM, C_DDD, NOPARMO, 0x0ac800, 244, dsp_reg_imm5_abs16},
+/* 244 -     */  {C_DSPIM, C_TTT, NOPARMO, 0x0ad000, 245, dsp_reg_imm5_abs16},
+/* 245 -     */  {C_DSPIM, C_NNN, NOPARMO, 0x0ad800, 246, dsp_reg_imm5_abs16},
+/* 246 -     */  {C_DSPIM, C_FFF, NOPARMO, 0x0ae000, 247, dsp_reg_imm5_abs16},
+/* 247 -     */  {C_DSPIM, C_GGG, NOPARMO, 0x0ae800, 0, dsp_reg_imm5_abs16},
+/* 248 lua   */  {M_DSPEA, C_LUADST, NOPARMO, 0x044010, 0, dsp_ea_lua},
+/* 249 norm  */  {M_DSPR, M_ACC56, NOPARMO, 0x01d815, 0, dsp_ab_rn},
+/* 250 move  */  {M_AM_NONE, M_AM_NONE, PARMOVE, 0x000000, 0, dsp_self},
+/* 251 movec */  {M_DSPIM8, C_MOVEC, NOPARMO, 0x0500a0, 252, dsp_immmovec},
+/* 252 -     */  {M_DSPEA, C_MOVEC, NOPARMO, 0x05c020, 253, dsp_movec_ea},
+/* 253 -     */  {C_MOVEC, M_DSPEA, NOPARMO, 0x054020, 254, dsp_movec_ea},
+/* 254 -     */  {C_DSPIM, C_MOVEC, NOPARMO, 0x05f420, 255, dsp_movec_ea},
+/* 255 -     */  {M_DSPAA, C_MOVEC, NOPARMO, 0x058020, 256, dsp_movec_aa},
+/* 256 -     */  {C_MOVEC, M_DSPAA, NOPARMO, 0x050020, 257, dsp_movec_aa},
+/* 257 -     */  {C_MOVEC, M_ALU24, NOPARMO, 0x0440a0, 258, dsp_movec_reg},
+/* 258 -     */  {C_MOVEC, C_DDD, NOPARMO, 0x0448a0, 259, dsp_movec_reg},
+/* 259 -     */  {C_MOVEC, C_TTT, NOPARMO, 0x0450a0, 260, dsp_movec_reg},
+/* 260 -     */  {C_MOVEC, C_NNN, NOPARMO, 0x0458a0, 261, dsp_movec_reg},
+/* 261 -     */  {C_MOVEC, C_FFF, NOPARMO, 0x0460a0, 262, dsp_movec_reg},
+/* 262 -     */  {C_MOVEC, C_GGG, NOPARMO, 0x0478a0, 263, dsp_movec_reg},
+/* 263 -     */  {M_ALU24, C_MOVEC, NOPARMO, 0x04c0a0, 264, dsp_movec_reg},
+/* 264 -     */  {C_DDD, C_MOVEC, NOPARMO, 0x04c8a0, 265, dsp_movec_reg},
+/* 265 -     */  {C_TTT, C_MOVEC, NOPARMO, 0x04d0a0, 266, dsp_movec_reg},
+/* 266 -     */  {C_NNN, C_MOVEC, NOPARMO, 0x04d8a0, 267, dsp_movec_reg},
+/* 267 -     */  {C_FFF, C_MOVEC, NOPARMO, 0x04e0a0, 268, dsp_movec_reg},
+/* 268 -     */  {C_GGG, C_MOVEC, NOPARMO, 0x04f8a0, 0, dsp_movec_reg},
+/* 269 movem */  {M_ALU24, M_DSPEA, NOPARMO, 0x074080, 270, dsp_movem_ea},
+/* 270 -     */  {C_DDD, M_DSPEA, NOPARMO, 0x074088, 271, dsp_movem_ea},
+/* 271 -     */  {C_TTT, M_DSPEA, NOPARMO, 0x074090, 272, dsp_movem_ea},
+/* 272 -     */  {C_NNN, M_DSPEA, NOPARMO, 0x074098, 273, dsp_movem_ea},
+/* 273 -     */  {C_FFF, M_DSPEA, NOPARMO, 0x0740a0, 274, dsp_movem_ea},
+/* 274 -     */  {C_GGG, M_DSPEA, NOPARMO, 0x0740b8, 275, dsp_movem_ea},
+/* 275 -     */  {M_DSPEA, M_ALU24, NOPARMO, 0x07c080, 276, dsp_movem_ea},
+/* 276 -     */  {M_DSPEA, C_DDD, NOPARMO, 0x07c088, 277, dsp_movem_ea},
+/* 277 -     */  {M_DSPEA, C_TTT, NOPARMO, 0x07c090, 278, dsp_movem_ea},
+/* 278 -     */  {M_DSPEA, C_NNN, NOPARMO, 0x07c098, 279, dsp_movem_ea},
+/* 279 -     */  {M_DSPEA, C_FFF, NOPARMO, 0x07c0a0, 280, dsp_movem_ea},
+/* 280 -     */  {M_DSPEA, C_GGG, NOPARMO, 0x07c0b8, 281, dsp_movem_ea},
+/* 281 -     */  {M_ALU24, M_DSPAA, NOPARMO, 0x070000, 282, dsp_movem_aa},
+/* 282 -     */  {C_DDD, M_DSPAA, NOPARMO, 0x070008, 283, dsp_movem_aa},
+/* 283 -     */  {C_TTT, M_DSPAA, NOPARMO, 0x070010, 284, dsp_movem_aa},
+/* 284 -     */  {C_NNN, M_DSPAA, NOPARMO, 0x070018, 285, dsp_movem_aa},
+/* 285 -     */  {C_FFF, M_DSPAA, NOPARMO, 0x070020, 286, dsp_movem_aa},
+/* 286 -     */  {C_GGG, M_DSPAA, NOPARMO, 0x070038, 287, dsp_movem_aa},
+/* 287 -     */  {M_DSPAA, M_ALU24, NOPARMO, 0x078000, 288, dsp_movem_aa},
+/* 288 -     */  {M_DSPAA, C_DDD, NOPARMO, 0x078008, 289, dsp_movem_aa},
+/* 289 -     */  {M_DSPAA, C_TTT, NOPARMO, 0x078010, 290, dsp_movem_aa},
+/* 290 -     */  {M_DSPAA, C_NNN, NOPARMO, 0x078018, 291, dsp_movem_aa},
+/* 291 -     */  {M_DSPAA, C_FFF, NOPARMO, 0x078020, 292, dsp_movem_aa},
+/* 292 -     */  {M_DSPAA, C_GGG, NOPARMO, 0x078038, 0, dsp_movem_aa},
+/* 293 mac   */  {M_ALU24, M_ALU24, PARMOVE, 0x000082, 0, dsp_mult},
+/* 294 macr  */  {M_ALU24, M_ALU24, PARMOVE, 0x000083, 0, dsp_mult},
+/* 295 mpy   */  {M_ALU24, M_ALU24, PARMOVE, 0x000080, 0, dsp_mult},
+/* 296 mpyr  */  {M_ALU24, M_ALU24, PARMOVE, 0x000081, 0, dsp_mult},
+/* 297 movep */  {M_DSPEA, M_DSPPP, NOPARMO, 0x08c080, 298, dsp_movep_ea},
+/* 298 -     */  {M_DSPAA, M_DSPPP, NOPARMO, 0x08c080, 299, dsp_movep_ea},
+/* 299 -     */  {M_DSPPP, M_DSPEA, NOPARMO, 0x084080, 300, dsp_movep_ea},
+/* 300 -     */  {M_DSPPP, M_DSPPP, NOPARMO, 0x084080, 301, dsp_movep_ea},
+/* 301 -     */  {M_DSPPP, M_DSPAA, NOPARMO, 0x084080, 302, dsp_movep_ea},
+/* 302 -     */  {C_DSPIM, M_DSPPP, NOPARMO, 0x08f480, 303, dsp_movep_ea},
+/* 303 -     */  {C_DSPIM, M_DSPEA, NOPARMO, 0x08f480, 304, dsp_movep_ea},
+/* 304 -     */  {M_ALU24, M_DSPPP, NOPARMO, 0x08c000, 305, dsp_movep_reg},
+/* 305 -     */  {C_DDD, M_DSPPP, NOPARMO, 0x08c800, 306, dsp_movep_reg},
+/* 306 -     */  {C_TTT, M_DSPPP, NOPARMO, 0x08d000, 307, dsp_movep_reg},
+/* 307 -     */  {C_NNN, M_DSPPP, NOPARMO, 0x08d800, 308, dsp_movep_reg},
+/* 308 -     */  {C_FFF, M_DSPPP, NOPARMO, 0x08e000, 309, dsp_movep_reg},
+/* 309 -     */  {C_GGG, M_DSPPP, NOPARMO, 0x08f800, 310, dsp_movep_reg},
+/* 310 -     */  {M_DSPPP, M_ALU24, NOPARMO, 0x084000, 311, dsp_movep_reg},
+/* 311 -     */  {M_DSPPP, C_DDD, NOPARMO, 0x084800, 312, dsp_movep_reg},
+/* 312 -     */  {M_DSPPP, C_TTT, NOPARMO, 0x085000, 313, dsp_movep_reg},
+/* 313 -     */  {M_DSPPP, C_NNN, NOPARMO, 0x085800, 314, dsp_movep_reg},
+/* 314 -     */  {M_DSPPP, C_FFF, NOPARMO, 0x086000, 315, dsp_movep_reg},
+/* 315 -     */  {M_DSPPP, C_GGG, NOPARMO, 0x087800, 0, dsp_movep_reg},
+/* 316 debug */  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000200, 0, dsp_self},
+/* 317 debugcc*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000300, 0, dsp_self},
+/* 318 debughs*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000300, 0, dsp_self},
+/* 319 debugcs*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000308, 0, dsp_self},
+/* 320 debuglo*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000308, 0, dsp_self},
+/* 321 debugec*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000305, 0, dsp_self},
+/* 322 debugeq*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x00030a, 0, dsp_self},
+/* 323 debuges*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x00030d, 0, dsp_self},
+/* 324 debugge*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000301, 0, dsp_self},
+/* 325 debuggt*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000307, 0, dsp_self},
+/* 326 debuglc*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000306, 0, dsp_self},
+/* 327 debugle*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x00030f, 0, dsp_self},
+/* 328 debugls*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x00030e, 0, dsp_self},
+/* 329 debuglt*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000309, 0, dsp_self},
+/* 330 debugmi*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x00030b, 0, dsp_self},
+/* 331 debugne*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000302, 0, dsp_self},
+/* 332 debugnr*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x00030c, 0, dsp_self},
+/* 333 debugpl*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000303, 0, dsp_self},
+/* 334 debugnn*/  {M_AM_NONE, M_AM_NONE, NOPARMO, 0x000304, 0, dsp_self},
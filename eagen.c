@@ -12,6 +12,7 @@
 #include "fltpoint.h"
 #include "mach.h"
 #include "mark.h"
+#include "relax.h"
 #include "riscasm.h"
 #include "sect.h"
 #include "token.h"
@@ -28,6 +29,8 @@
 #define aNbexpr   a0bexpr
 #define aNbdexval a0bexval
 #define aNbdexattr a0bexattr
+#define aNsdi     a0sdi
+#define aNpcsdi   a0pcsdi
 #include "eagen0.c"
 
 #define eaNgen    ea1gen
@@ -42,4 +45,6 @@
 #define aNbexpr   a1bexpr
 #define aNbdexval a1bexval
 #define aNbdexattr a1bexattr
+#define aNsdi     a1sdi
+#define aNpcsdi   a1pcsdi
 #include "eagen0.c"
@@ -102,6 +102,7 @@ int eaNgen(WORD siz)
 		{
 			// Arrange for fixup later on
 			AddFixup(FU_WORD | FU_SEXT | FU_PCREL, sloc, aNexpr);
+			RelaxFixup(aNpcsdi);
 			D_word(0);
 		}
 
@@ -318,6 +319,7 @@ int eaNgen(WORD siz)
 		else
 		{
 			AddFixup(FU_WORD | FU_SEXT, sloc, aNexpr);
+			RelaxFixup(aNsdi);
 			D_word(0);
 		}
 
@@ -340,6 +342,8 @@ int eaNgen(WORD siz)
 		else
 		{
 			AddFixup(FU_LONG, sloc, aNexpr);
+			RelaxFixup(aNsdi);
+			RelaxFixup(aNpcsdi);
 			D_long(0);
 		}
 
@@ -477,4 +481,6 @@ int eaNgen(WORD siz)
 #undef aNbdexval
 #undef aNbdexattr
 #undef AnESYM
+#undef aNsdi
+#undef aNpcsdi
 
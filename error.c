@@ -8,8 +8,10 @@
 
 #include "error.h"
 #include <stdarg.h>
+#include "cache.h"
 #include "token.h"
 #include "listing.h"
+#include "relax.h"
 char * interror_msg[] = {
 	"Unknown internal error",	// Error not referenced, should not be displayed
 	"Unknown internal error",	// Error not referenced, should not be displayed
@@ -24,11 +26,48 @@ char * interror_msg[] = {
 };
 
 // Exported variables
-int errcnt;						// Error count
-char * err_fname;				// Name of error message file
+ASMCTX int errcnt;						// Error count
+ASMCTX char * err_fname;				// Name of error message file
+ASMCTX jmp_buf * bailout;				// Where fatal errors go, when not exiting
 
 // Internal variables
 static long unused;				// For supressing 'write' warnings
+static ASMCTX char errbuf[ERRBUFSIZ];	// Error file output buffer
+static ASMCTX int errbufcnt;			// #bytes pending in errbuf
+static ASMCTX char * errfname;			// File & line messages are put down to, when
+static ASMCTX uint32_t errlineno;		// not the current one (NULL: current one)
+static ASMCTX ERRSINK * sink;	// This thread's messages go here (NULL: out)
+
+//
+// Write pending error messages to the error file
+//
+void FlushErrors(void)
+{
+	if (errbufcnt > 0)
+		unused = write(err_fd, errbuf, errbufcnt);
+
+	errbufcnt = 0;
+}
+
+//
+// Ship an error message out, either to the (buffered) error file or to stdout
+//
+static void ShipError(const char * msg)
+{
+	int length = strlen(msg);
+
+	if (!err_flag)
+	{
+		printf("%s", msg);
+		return;
+	}
+
+	if (errbufcnt + length > ERRBUFSIZ)
+		FlushErrors();
+
+	memcpy(errbuf + errbufcnt, msg, length);
+	errbufcnt += length;
+}
 
 //
 // Report error if not at EOL
@@ -50,13 +89,93 @@ int ErrorIfNotAtEOL(void)
 	return 0;
 }
 
+//
+// Send this thread's messages to 'es' (NULL: report them as they come)
+//
+void SetErrorSink(ERRSINK * es)
+{
+	sink = es;
+}
+
+//
+// Keep a message in this thread's sink
+//
+static void SinkMessage(char kind, const char * text)
+{
+	size_t length = strlen(text) + 2;
+
+	if (sink->used + length > sink->size)
+	{
+		size_t size = (sink->size == 0 ? 256 : sink->size * 2);
+
+		while (sink->used + length > size)
+			size *= 2;
+
+		char * buf = realloc(sink->buf, size);
+
+		// Out of memory, the message is lost; better than no assembly
+		if (buf == NULL)
+			return;
+
+		sink->buf = buf;
+		sink->size = size;
+	}
+
+	sink->buf[sink->used] = kind;
+	strcpy(sink->buf + sink->used + 1, text);
+	sink->used += length;
+}
+
+//
+// Report messages kept by an ERRSINK, in the order they were made (the
+// buffer ends with an empty message)
+//
+void ReplayMessages(const char * msgs)
+{
+	for(; *msgs!=EOS; msgs+=strlen(msgs)+1)
+	{
+		switch (*msgs)
+		{
+		case 'E': error("%s", msgs + 1); break;
+		case 'W': warn("%s", msgs + 1); break;
+		case 'F': fatal(msgs + 1); break;
+		case 'I': interror(atoi(msgs + 1)); break;
+		}
+	}
+}
+
+//
+// Put messages down to 'fname' line 'lineno' rather than the current line,
+// without touching curfname & curlineno (fname NULL: the current line again)
+//
+void SetErrorLocation(char * fname, uint32_t lineno)
+{
+	errfname = fname;
+	errlineno = lineno;
+}
+
+//
+// Give up on the assembly. Normally that's the end of rmac, but when it's
+// used as a library, control goes back to RmacAssemble().
+//
+static void GiveUp(void)
+{
+	errfname = NULL;
+	CacheAbandon();
+
+	if (bailout != NULL)
+		longjmp(*bailout, 1);
+
+	exit(1);
+}
+
 //
 // Cannot create a file
 //
 void CantCreateFile(const char * fn)
 {
 	printf("Cannot create file: '%s'\n", fn);
-	exit(1);
+	GiveUp();
 }
 
 //
@@ -80,6 +199,8 @@ void err_setup(void)
 		if ((err_fd = open(fnbuf, _OPEN_FLAGS, _PERM_MODE)) < 0)
 			CantCreateFile(fnbuf);
 
+		CacheNoteOutput(fnbuf);
+
 		err_flag = 1;
 	}
 }
@@ -92,17 +213,32 @@ int error(const char * text, ...)
 	char buf[EBUFSIZ];
 	char buf1[EBUFSIZ];
 
-	err_setup();
+	// Sizing passes only need to know that something went wrong
+	if (relax_pass)
+	{
+		errcnt++;
+		return ERROR;
+	}
 
 	va_list arg;
 	va_start(arg, text);
 	vsprintf(buf, text, arg);
 	va_end(arg);
 
+	if (sink != NULL)
+	{
+		SinkMessage('E', buf);
+		return ERROR;
+	}
+
+	err_setup();
+
 	if (listing > 0)
 		ship_ln(buf);
 
-	if (cur_inobj)
+	if (errfname != NULL)
+		sprintf(buf1, "%s %d: Error: %s\n", errfname, errlineno, buf);
+	else if (cur_inobj)
 	{
 		switch (cur_inobj->in_type)
 		{
@@ -151,10 +287,7 @@ int error(const char * text, ...)
 		// No current file so cur_inobj is NULL
 		sprintf(buf1, "%s %d: Error: %s\n", curfname, curlineno, buf);
 
-	if (err_flag)
-		unused = write(err_fd, buf1, (LONG)strlen(buf1));
-	else
-		printf("%s", buf1);
+	ShipError(buf1);
 
 	taglist('E');
 	errcnt++;
@@ -170,21 +303,29 @@ int warn(const char * text, ...)
 	char buf[EBUFSIZ];
 	char buf1[EBUFSIZ];
 
-	err_setup();
+	if (relax_pass)
+		return OK;
+
 	va_list arg;
 	va_start(arg, text);
 	vsprintf(buf, text, arg);
 	va_end(arg);
 
+	if (sink != NULL)
+	{
+		SinkMessage('W', buf);
+		return OK;
+	}
+
+	err_setup();
+
 	if (listing > 0)
 		ship_ln(buf);
 
-	sprintf(buf1, "%s %d: Warning: %s\n", curfname, curlineno, buf);
+	sprintf(buf1, "%s %d: Warning: %s\n", (errfname != NULL ? errfname : curfname),
+		(errfname != NULL ? errlineno : curlineno), buf);
 
-	if (err_flag)
-		unused = write(err_fd, buf1, (LONG)strlen(buf1));
-	else
-		printf("%s", buf1);
+	ShipError(buf1);
 
 	taglist('W');
 
@@ -195,35 +336,50 @@ int fatal(const char * s)
 {
 	char buf[EBUFSIZ];
 
+	if (sink != NULL)
+	{
+		SinkMessage('F', s);
+		longjmp(sink->bail, 1);
+	}
+
 	err_setup();
 
 	if (listing > 0)
 		ship_ln(s);
 
-	sprintf(buf, "%s %d: Fatal: %s\n", curfname, curlineno, s);
+	sprintf(buf, "%s %d: Fatal: %s\n", (errfname != NULL ? errfname : curfname),
+		(errfname != NULL ? errlineno : curlineno), s);
 
-	if (err_flag)
-		unused = write(err_fd, buf, (LONG)strlen(buf));
-	else
-		printf("%s", buf);
+	ShipError(buf);
+	FlushErrors();
+	FlushListing();
+	GiveUp();
 
-	exit(1);
+	return ERROR;
 }
 
 int interror(int n)
 {
 	char buf[EBUFSIZ];
 
+	if (sink != NULL)
+	{
+		sprintf(buf, "%d", n);
+		SinkMessage('I', buf);
+		longjmp(sink->bail, 1);
+	}
+
 	err_setup();
-	sprintf(buf, "%s %d: Internal error #%d: %s\n", curfname, curlineno, n, interror_msg[n]);
+	sprintf(buf, "%s %d: Internal error #%d: %s\n", (errfname != NULL ? errfname : curfname),
+		(errfname != NULL ? errlineno : curlineno), n, interror_msg[n]);
 
 	if (listing > 0)
 		ship_ln(buf);
 
-	if (err_flag)
-		unused = write(err_fd, buf, (LONG)strlen(buf));
-	else
-		printf("%s", buf);
+	ShipError(buf);
+	FlushErrors();
+	FlushListing();
+	GiveUp();
 
-	exit(1);
+	return ERROR;
 }
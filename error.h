@@ -10,12 +10,26 @@
 #define __ERROR_H__
 
 #include "rmac.h"
+#include <setjmp.h>
 
 #define EBUFSIZ     256		// Max size of an error message
+#define ERRBUFSIZ   0x4000	// Size of error file output buffer
+
+// Where a thread other than the main one puts its messages; they're reported
+// later, by ReplayMessages() on the main thread
+#define ERRSINK struct _errsink
+ERRSINK
+{
+	char * buf;					// Messages: kind ('E', 'W', 'F', 'I'), text, NUL
+	size_t size;				// # of bytes allocated
+	size_t used;				// # of bytes in use
+	jmp_buf bail;				// Where fatal errors go
+};
 
 // Exported variables
-extern int errcnt;
-extern char * err_fname;
+extern ASMCTX int errcnt;
+extern ASMCTX char * err_fname;
+extern ASMCTX jmp_buf * bailout;
 
 // Exported functions
 int error(const char *, ...);
@@ -24,7 +38,11 @@ int fatal(const char *);
 int interror(int);
 void CantCreateFile(const char *);
 void err_setup(void);
+void FlushErrors(void);
 int ErrorIfNotAtEOL(void);
+void SetErrorSink(ERRSINK *);
+void ReplayMessages(const char *);
+void SetErrorLocation(char *, uint32_t);
 
 #endif // __ERROR_H__
 
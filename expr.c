@@ -7,10 +7,12 @@
 //
 
 #include "expr.h"
+#include "cache.h"
 #include "direct.h"
 #include "error.h"
 #include "listing.h"
 #include "mach.h"
+#include "macro.h"
 #include "procln.h"
 #include "riscasm.h"
 #include "sect.h"
@@ -22,9 +24,7 @@
 
 // N.B.: The size of tokenClass should be identical to the largest value of
 //       a token; we're assuming 256 but not 100% sure!
-static char tokenClass[256];		// Generated table of token classes
-static uint64_t evstk[EVSTACKSIZE];	// Evaluator value stack
-static WORD evattr[EVSTACKSIZE];	// Evaluator attribute stack
+static ASMCTX char tokenClass[256];		// Generated table of token classes
 
 // Token-class initialization list
 char itokcl[] = {
@@ -52,11 +52,17 @@ const char str_error[] = "missing symbol or string";
 const char noflt_error[] = "operator not usable with float";
 
 // Convert expression to postfix
-static PTR evalTokenBuffer;		// Deposit tokens here (this is really a
+static ASMCTX PTR evalTokenBuffer;		// Deposit tokens here (this is really a
 								// pointer to exprbuf from direct.c)
 								// (Can also be from others, like
 								// riscasm.c)
-static int symbolNum;			// Pointer to the entry in symbolPtr[]
+static ASMCTX int symbolMax;			// # of entries allocated in symbolPtr[]
+static ASMCTX int symbolNum;			// Pointer to the entry in symbolPtr[]
+static ASMCTX TOKEN * opstart[EVSTACKSIZE];	// Where each operand in evalTokenBuffer starts
+static ASMCTX int opdepth;				// # of operands in evalTokenBuffer
+#define FOLDMAX 64
+static ASMCTX SYM * foldsym[FOLDMAX];	// Equates folded into CONSTs by expr2()
+static ASMCTX int foldnum;				// # of entries in foldsym[]
 
 //
 // Obtain a string value
@@ -90,10 +96,148 @@ void InitExpression(void)
 			tokenClass[(int)(*p)] = (char)i;
 	}
 
+	free(symbolPtr);
+	symbolPtr = NULL;
+	symbolMax = 0;
 	symbolNum = 0;
 }
 
-extern int correctMathRules;
+
+//
+// Put a symbol into symbolPtr[], returning its index there
+//
+static int SymbolIndex(SYM * sy)
+{
+	if (symbolNum == symbolMax)
+	{
+		int max = (symbolMax == 0 ? 4096 : symbolMax * 2);
+		SYM ** p = realloc(symbolPtr, max * sizeof(SYM *));
+
+		if (p == NULL)
+			return fatal("out of memory for symbol references");
+
+		symbolPtr = p;
+		symbolMax = max;
+	}
+
+	symbolPtr[symbolNum] = sy;
+
+	return symbolNum++;
+}
+
+//
+// Note that an operand starts at 'start' in evalTokenBuffer
+//
+static inline void PushOperand(TOKEN * start)
+{
+	if (opdepth < EVSTACKSIZE)
+		opstart[opdepth] = start;
+
+	opdepth++;
+}
+
+//
+// Apply operator 't' to two constants (b is ignored for unary operators),
+// leaving the result in *a. The arithmetic is the same as evexpr()'s for two
+// ABS values, and the result is ABS | DEFINED just the same. Returns 1 if
+// that worked, or 0 for anything evexpr() would complain about (or has no
+// defined result for), which is then left for evexpr() to do.
+//
+int FoldOperator(TOKEN t, uint64_t * a, uint64_t b)
+{
+	switch (t)
+	{
+	case '+':     *a += b; break;
+	case '-':     *a -= b; break;
+	case '*':     *a *= b; break;
+	case '&':     *a &= b; break;
+	case '^':     *a ^= b; break;
+	case '|':     *a |= b; break;
+	case LE:      *a = (*a <= b); break;
+	case GE:      *a = (*a >= b); break;
+	case '<':     *a = (*a < b); break;
+	case '>':     *a = (*a > b); break;
+	case NE:      *a = (*a != b); break;
+	case '=':     *a = (*a == b); break;
+	case UNMINUS: *a = -(int64_t)*a; break;
+	case UNLT:    *a &= 0x00FF; break;
+	case UNGT:    *a = (*a >> 8) & 0x00FF; break;
+	case '!':     *a = !*a; break;
+	case '~':     *a = ~*a; break;
+	case '/':
+		if ((int32_t)b == 0 || (int32_t)b == -1)
+			return 0;
+
+		*a = (int32_t)*a / (int32_t)b;
+		break;
+	case '%':
+		if (b == 0)
+			return 0;
+
+		*a %= b;
+		break;
+	case SHL:
+	case SHR:
+		if (b >= 64)
+			return 0;
+
+		*a = (t == SHL ? *a << b : *a >> b);
+		break;
+	default:
+		return 0;
+	}
+
+	return 1;
+}
+
+//
+// Deposit a unary or binary operator in evalTokenBuffer. If its operands are
+// all single CONSTs, they are replaced by the result as a CONST instead.
+//
+static void EmitOperator(TOKEN t, int binary)
+{
+	int n = (binary ? 2 : 1);
+	PTR ptk;
+
+	if (opdepth > EVSTACKSIZE || opdepth < n)
+		goto nofold;
+
+	TOKEN * start = opstart[opdepth - n];
+
+	if (start + (3 * n) != evalTokenBuffer.u32 || start[0] != CONST
+		|| (binary && start[3] != CONST))
+		goto nofold;
+
+	ptk.u32 = start + 1;
+	uint64_t a = *ptk.u64;
+	ptk.u32 = start + 4;
+
+	if (!FoldOperator(t, &a, (binary ? *ptk.u64 : 0)))
+		goto nofold;
+
+	ptk.u32 = start + 1;
+	*ptk.u64++ = a;
+	evalTokenBuffer.u32 = ptk.u32;
+	opdepth -= n - 1;
+	return;
+
+nofold:
+	*evalTokenBuffer.u32++ = t;
+	opdepth -= n - 1;
+}
+
+//
+// See if a symbol can go into evalTokenBuffer as a CONST: it has to be an
+// ABS equate that can't be SET to something else later, and isn't a register
+// or a float
+//
+static inline int FoldableSymbol(SYM * sy)
+{
+	return ((sy->sattr & (DEFINED | EQUATED | TDB | M56KPXYL | M6502 | FLOAT | RISCREG | COMMON)) == (DEFINED | EQUATED))
+		&& (sy->sattre == 0);
+}
+
+extern ASMCTX int correctMathRules;
 int xor(void);
 int and(void);
 int rel(void);
@@ -115,7 +259,7 @@ do \
 		TOKEN t = *tok++; \
 		if (HIERARCHY_HIGHER() != OK) \
 			return ERROR; \
-		*evalTokenBuffer.u32++ = t; \
+		EmitOperator(t, 1); \
 	} \
 }while (0)
 
@@ -133,7 +277,7 @@ int expr0(void)
 		if (expr1() != OK)
 			return ERROR;
 
-		*evalTokenBuffer.u32++ = t;
+		EmitOperator(t, 1);
 	}
 	}
 	else
@@ -217,10 +361,12 @@ int expr1(void)
 		// With leading + we don't have to deposit anything to the buffer
 		// because there's no unary '+' nor we have to do anything about it
 		if (t != '+')
-			*evalTokenBuffer.u32++ = t;
+			EmitOperator(t, 0);
 	}
 	else if (class == SUNARY)
 	{
+		PushOperand(evalTokenBuffer.u32);
+
 		switch (*tok++)
 		{
 		case CR_ABSCOUNT:
@@ -243,10 +389,13 @@ int expr1(void)
 			// Attempt to open the include file in the current directory, then (if that
 			// failed) try list of include files passed in the enviroment string or by
 			// the "-d" option.
+			// (It's gone through MapInput(), so that the size comes from the
+			// contents the output cache hashes)
 			int fd, i;
 			char buf1[256];
+			size_t filesize;
 
-			if ((fd = open(string[*tok], _OPEN_INC)) < 0)
+			if (MapInput(string[*tok], &filesize) == NULL)
 			{
 				for(i=0; nthpath("RMACPATH", i, buf1)!=0; i++)
 				{
@@ -258,7 +407,7 @@ int expr1(void)
 
 					strcat(buf1, string[*tok]);
 
-					if ((fd = open(buf1, _OPEN_INC)) >= 0)
+					if (MapInput(buf1, &filesize) != NULL)
 						goto allright;
 				}
 
@@ -266,17 +415,18 @@ int expr1(void)
 			}
 
 allright:
-			*evalTokenBuffer.u64++ = (uint64_t)lseek(fd, 0L, SEEK_END);
-			close(fd);
+			*evalTokenBuffer.u64++ = (uint64_t)filesize;
 
 			// Advance tok because of consumed string token
 			tok++;
 			break;
 		case CR_TIME:
+			CacheDontStore();		// Output depends on when it's assembled
 			*evalTokenBuffer.u32++ = CONST;
 			*evalTokenBuffer.u64++ = dos_time();
 			break;
 		case CR_DATE:
+			CacheDontStore();
 			*evalTokenBuffer.u32++ = CONST;
 			*evalTokenBuffer.u64++ = dos_date();
 			break;
@@ -285,7 +435,7 @@ allright:
 				return error(missym_error);
 
 			p = string[*tok++];
-			w = (lookup(p, MACRO, 0) == NULL ? 0 : 1);
+			w = (LookupMacro(p) == NULL ? 0 : 1);
 			*evalTokenBuffer.u32++ = CONST;
 			*evalTokenBuffer.u64++ = (uint64_t)w;
 			break;
@@ -340,6 +490,10 @@ int expr2(void)
 {
 	PTR ptk;
 
+	// Parenthesised expressions push their own operands
+	if (*tok != '(' && *tok != '[' && *tok != '{')
+		PushOperand(evalTokenBuffer.u32);
+
 	switch (*tok++)
 	{
 	case CONST:
@@ -363,10 +517,18 @@ int expr2(void)
 		if (sy == NULL)
 			sy = NewSymbol(p, LABEL, j);
 
+		// It's marked REFERENCED once the whole expression is in, as
+		// evexpr() would have done (^^referenced later on mustn't see it)
+		if (FoldableSymbol(sy) && foldnum < FOLDMAX)
+		{
+			foldsym[foldnum++] = sy;
+			*evalTokenBuffer.u32++ = CONST;
+			*evalTokenBuffer.u64++ = sy->svalue;
+			break;
+		}
+
 		*evalTokenBuffer.u32++ = SYMBOL;
-		*evalTokenBuffer.u32++ = symbolNum;
-		symbolPtr[symbolNum] = sy;
-		symbolNum++;
+		*evalTokenBuffer.u32++ = SymbolIndex(sy);
 		break;
  	}
 	case STRING:
@@ -448,7 +610,8 @@ int expr(TOKEN * otk, uint64_t * a_value, WORD * a_attr, SYM ** a_esym)
 	//         checking if there's an EOL after it depending on the actual
 	//         length of the token (multiple vs. single). Otherwise, we have
 	//         the horror show that is the following:
-	if ((tok[1] == EOL
+	// (tok[1] is only looked at if tok[0] isn't EOL, as it's stale otherwise)
+	if ((tok[0] != EOL && tok[1] == EOL
 			&& (tok[0] != CONST && tokenClass[tok[0]] != SUNARY))
 		|| ((tok[0] == SYMBOL)
 			&& (tokenClass[tok[2]] < UNARY))
@@ -537,9 +700,7 @@ While this approach works, it's wasteful. It would be better to use something
 that's already available, like the symbol "order defined" table (which needs to
 be converted from a linked list into an array).
 */
-			*evalTokenBuffer.u32++ = symbolNum;
-			symbolPtr[symbolNum] = symbol;
-			symbolNum++;
+			*evalTokenBuffer.u32++ = SymbolIndex(symbol);
 #endif
 
 			*a_value = (symbol->sattr & DEFINED ? symbol->svalue : 0);
@@ -575,10 +736,30 @@ be converted from a linked list into an array).
 		return OK;
 	}
 
+	opdepth = 0;
+	foldnum = 0;
+
 	if (expr0() != OK)
 		return ERROR;
 
 	*evalTokenBuffer.u32++ = ENDEXPR;
+
+	for(int i=0; i<foldnum; i++)
+		foldsym[i]->sattr |= REFERENCED;
+
+	// Everything folded into one CONST, so there's nothing left to evaluate
+	if (otk[0] == CONST && otk[3] == ENDEXPR)
+	{
+		ptk.u32 = otk + 1;
+		*a_value = *ptk.u64;
+		*a_attr = ABS | DEFINED;
+
+		if (a_esym != NULL)
+			*a_esym = NULL;
+
+		return OK;
+	}
+
 	return evexpr(otk, a_value, a_attr, a_esym);
 }
 
@@ -592,6 +773,8 @@ int evexpr(TOKEN * _tk, uint64_t * a_value, WORD * a_attr, SYM ** a_esym)
 {
 	WORD attr;
 	SYM * sy;
+	uint64_t evstk[EVSTACKSIZE];			// Value stack (on ours, as fixups
+	WORD evattr[EVSTACKSIZE];				// can be evaluated on several threads)
 	uint64_t * sval = evstk;				// (Empty) initial stack
 	WORD * sattr = evattr;
 	SYM * esym = NULL;						// No external symbol involved
@@ -605,7 +788,10 @@ int evexpr(TOKEN * _tk, uint64_t * a_value, WORD * a_attr, SYM ** a_esym)
 		{
 		case SYMBOL:
 			sy = symbolPtr[*tk.u32++];
-			sy->sattr |= REFERENCED;		// Set "referenced" bit
+
+			// Set "referenced" bit (only if it isn't, see EvalFixupsInParallel())
+			if (!(sy->sattr & REFERENCED))
+				sy->sattr |= REFERENCED;
 
 			if (!(sy->sattr & DEFINED))
 			{
@@ -1131,7 +1317,8 @@ uint16_t ExpressionLength(TOKEN * tk)
 		// Add one to length for 2X tokens, two for 3X tokens
 		if (tk[length] == SYMBOL)
 			length++;
-		else if ((tk[length] == CONST) || (tk[length] == FCONST))
+		else if ((tk[length] == CONST) || (tk[length] == FCONST)
+			|| (tk[length] == ACONST))
 			length += 2;
 	}
 
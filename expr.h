@@ -36,6 +36,7 @@ int expr1(void);
 int expr2(void);
 int expr(TOKEN *, uint64_t *, WORD *, SYM **);
 int evexpr(TOKEN *, uint64_t *, WORD *, SYM **);
+int FoldOperator(TOKEN, uint64_t *, uint64_t);
 uint16_t ExpressionLength(TOKEN *);
 
 #endif // __EXPR_H__
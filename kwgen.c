@@ -30,6 +30,10 @@
  *  The `basename' is a string prepended to the beginning of each of
  *  the output array names, and should be one or two characters.
  *
+ *  If a keyword appears more than once, the last one wins. This way
+ *  several lists can be merged into one state machine, with the list
+ *  that has precedence last (e.g. "cat risc.tab direct.tab | kwgen mr").
+ *
  */
 #include <stdio.h>
 #include <ctype.h>
@@ -72,6 +76,7 @@ int accept[128];		/* tmp table for building accept[] */
 struct name_entry {
 	char *nstr;			/* -> name string */
 	int nval;			/* = name's value */
+	int nord;			/* = order in input */
 } namtab[NSTRINGS];
 
 int nnames;			/* number of keywords */
@@ -178,6 +183,7 @@ empty:			/* use previous entry + 1 */
 			exit(1);
 		}
 
+		namtab[nnames].nord = nnames;
 		++nnames;
 
 		if (nnames >= NSTRINGS)
@@ -189,6 +195,19 @@ empty:			/* use previous entry + 1 */
 
 	qsort(namtab, nnames, sizeof(struct name_entry), comp_entry);
 
+	/*
+	 *  drop duplicates, keeping the last one read
+	 */
+	for(i=k=0; i<nnames; ++i)
+	{
+		if (i+1 < nnames && !strcmp(namtab[i].nstr, namtab[i+1].nstr))
+			continue;
+
+		namtab[k++] = namtab[i];
+	}
+
+	nnames = k;
+
 	/*
 	 *  compute table start indices
 	 */
@@ -340,7 +359,10 @@ void dumptab(char * tabname, char * tabprefix, int * table, int tabsize)
 
 int comp_entry(struct name_entry * ent1, struct name_entry * ent2)
 {
-	return strcmp(ent1->nstr, ent2->nstr);
+	int c = strcmp(ent1->nstr, ent2->nstr);
+
+	/* duplicates in input order */
+	return (c ? c : ent1->nord - ent2->nord);
 }
 
 
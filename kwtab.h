@@ -0,0 +1,114 @@
+#ifdef DEF_KW
+/*
+ *  Keyword definitions
+ */
+#define	KW__CCDEF	183
+#define	KW__EQU	61
+#define	KW__EQUR	85
+#define	KW__EQURUNDEF	50
+#define	KW__REG	82
+#define	KW__REGEQU	85
+#define	KW__REGUNDEF	50
+#define	KW_CCDEF	183
+#define	KW_EQU	61
+#define	KW_EQUR	85
+#define	KW_EQURUNDEF	50
+#define	KW_REG	82
+#define	KW_REGEQU	85
+#define	KW_REGUNDEF	50
+#define	KW_SET	149
+#endif
+
+#ifdef DECL_KW
+/*
+ *  keyword state-machine tables
+ *
+ */
+
+int kwbase[46] = {
+ 0, 3, 1, 0, 2, 4, 7, 3,
+ 6, 8, 1, 6, 3, 10, 3, 8,
+ 11, 7, 21, 22, 10, 24, 24, 10,
+ 15, 19, 28, 14, 19, 23, 24, 18,
+ 36, 27, 22, 40, 42, 42, 44, 44,
+ 45, 45, 47, 47, 48, 49
+};
+
+int kwtab[177] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, 1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, 2, 9, 3, 6, 11,
+ 7, 12, 13, 15, 16, 18, 19, 21,
+ 22, 10, 4, 5, 14, 8, 17, -2,
+ 20, 23, 24, 26, 27, 28, -2, 30,
+ 31, 32, -2, 33, 34, 35, 36, -2,
+ 37, 38, 25, -2, 39, 29, 40, 41,
+ 42, 43, 44, -2, 45, -2, -2, -2,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1
+};
+
+int kwcheck[177] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, 0, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, 0, 2, 0, 1, 4,
+ 1, 5, 6, 8, 9, 11, 13, 15,
+ 16, 3, 0, 0, 7, 1, 10, 12,
+ 14, 17, 18, 19, 20, 21, 22, 23,
+ 24, 25, 26, 27, 28, 29, 30, 31,
+ 32, 33, 18, 34, 35, 21, 36, 37,
+ 38, 39, 40, 41, 42, 43, 44, 45,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1
+};
+
+int kwaccept[177] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, 82, -1, 82,
+ -1, -1, -1, -1, -1, -1, 61, 149,
+ 61, 85, -1, -1, 85, -1, 183, -1,
+ -1, -1, 183, -1, -1, -1, -1, 85,
+ -1, -1, -1, 85, -1, -1, -1, -1,
+ -1, -1, -1, 50, -1, 50, 50, 50,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1
+};
+#endif
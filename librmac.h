@@ -0,0 +1,46 @@
+//
+// RMAC - Renamed Macro Assembler for all Atari computers
+// LIBRMAC.H - Using RMAC as a library
+// Copyright (C) 199x Landon Dyer, 2011-2022 Reboot and Friends
+// RMAC derived from MADMAC v1.07 Written by Landon Dyer, 1986
+// Source utilised with the kind permission of Landon Dyer
+//
+// Link with librmac.a ("make librmac.a", and -lm -lpthread) to run assemblies
+// without starting a new rmac process for each one. What an assembly changes
+// (sections, symbols, tokenizer & input stack, operand state, options, ...)
+// is kept for each thread (see ASMCTX in rmac.h), so every thread is an
+// assembler context of its own: assemblies can run on several threads at
+// once, but on one thread, calls must not overlap. What an assembly
+// allocated is freed when it returns.
+//
+// stdout & stderr are shared by all of them, so assemblies run side by side
+// should be given -e (or -q) to keep their messages apart. Those with --cache
+// take turns, as their output is captured from stdout.
+//
+
+#ifndef __LIBRMAC_H__
+#define __LIBRMAC_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Do an assembly, as if 'argv' (without the program name) had been given to
+// rmac on the command line. Fatal errors end the assembly, not the caller.
+// Returns the number of errors.
+int RmacAssemble(int argc, char ** argv);
+
+// Same, but the object file isn't written out; '*image' is set to it instead
+// (malloc()ed, to be freed by the caller) and '*size' to its size. On errors,
+// '*image' is NULL.
+int RmacAssembleToMemory(int argc, char ** argv, uint8_t ** image, size_t * size);
+
+// Make 'text' available to assemblies as the source file 'name', both on the
+// command line and in .include (names are matched exactly, after rmac has
+// added any ".s"). The text isn't copied, so it must stay put until
+// RmacClearSources(). Sources are the calling thread's: they're seen by the
+// assemblies it runs, and not by those on other threads.
+void RmacAddSource(const char * name, const char * text, size_t size);
+void RmacClearSources(void);
+
+#endif // __LIBRMAC_H__
+
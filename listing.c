@@ -14,33 +14,46 @@
 // nnnnn           =vvvvvvvv
 
 #include "listing.h"
+#include "cache.h"
 #include "error.h"
 #include "procln.h"
 #include "sect.h"
 #include "token.h"
 #include "version.h"
 
-char * list_fname;					// Listing filename
-uint8_t subttl[TITLESIZ];			// Current subtitle
-int listing;						// Listing level
-int pagelen = 61;					// Lines on a page
-int nlines;							// #lines on page so far
-LONG lsloc;							// `sloc' at start of line
+ASMCTX char * list_fname;					// Listing filename
+ASMCTX uint8_t subttl[TITLESIZ];			// Current subtitle
+ASMCTX int listing;						// Listing level
+ASMCTX int pagelen = 61;					// Lines on a page
+ASMCTX int nlines;							// #lines on page so far
+ASMCTX LONG lsloc;							// `sloc' at start of line
 
 // Private
-static int lcursect;				// `cursect' at start of line
-static int llineno;					// `curlineno' at start of line
-static int pageno;					// Current page number
+static ASMCTX int lcursect;				// `cursect' at start of line
+static ASMCTX int llineno;					// `curlineno' at start of line
+static ASMCTX int pageno;					// Current page number
 static int pagewidth;				// #columns on a page
-static int subflag;					// 0, don't do .eject on subttl (set 1)
-static char lnimage[IMAGESIZ];		// Image of output line
-static char title[TITLESIZ];		// Current title
-static char datestr[20];			// Current date dd-mon-yyyy
-static char timestr[20];			// Current time hh:mm:ss [am|pm]
-static char buf[IMAGESIZ];			// Buffer for numbers
+static ASMCTX int subflag;					// 0, don't do .eject on subttl (set 1)
+static ASMCTX char lnimage[IMAGESIZ];		// Image of output line
+static ASMCTX char title[TITLESIZ];		// Current title
+static ASMCTX char datestr[20];			// Current date dd-mon-yyyy
+static ASMCTX char timestr[20];			// Current time hh:mm:ss [am|pm]
+static ASMCTX char buf[IMAGESIZ];			// Buffer for numbers
+static ASMCTX char lstbuf[LSTBUFSIZ];		// Listing output buffer
+static ASMCTX int lstbufcnt;				// #bytes pending in lstbuf
+
+// Private, machine readable (NDJSON) listing only
+static ASMCTX WORD lfileno;				// `cfileno' at start of line
+static ASMCTX char ltag;					// Listing tag at start of line
+static ASMCTX char lflag;					// Error/warning tag for line
+static ASMCTX int ldepth;					// Macro/rept nesting at start of line
+static ASMCTX FIXUP * lfixup;				// Last fixup in section at start of line
+static ASMCTX int lvalset;					// 1, listvalue() was called on this line
+static ASMCTX uint32_t lvalue;				// Value passed to listvalue()
+static const char hexdigit[] = "0123456789ABCDEF";
 static long unused;					// For supressing 'write' warnings
 
-static char * month[16] = {
+static ASMCTX char * month[16] = {
 	"",    "Jan", "Feb", "Mar",
 	"Apr", "May", "Jun", "Jul",
 	"Aug", "Sep", "Oct", "Nov",
@@ -63,18 +76,32 @@ int eject(void)
 }
 
 
+//
+// Get the local time (not with localtime(), whose buffer all threads share)
+//
+static void LocalTime(struct tm * tm)
+{
+	time_t tloc;
+
+	time(&tloc);
+#if defined(WIN32) || defined(WIN64)
+	localtime_s(tm, &tloc);
+#else
+	localtime_r(&tloc, tm);
+#endif
+}
+
+
 //
 // Return GEMDOS format date
 //
 uint32_t dos_date(void)
 {
 	uint32_t v;
-	struct tm * tm;
-	time_t tloc;
+	struct tm tm;
 
-	time(&tloc);
-	tm = localtime(&tloc);
-	v = ((tm->tm_year - 80) << 9) | ((tm->tm_mon + 1) << 5) | tm->tm_mday;
+	LocalTime(&tm);
+	v = ((tm.tm_year - 80) << 9) | ((tm.tm_mon + 1) << 5) | tm.tm_mday;
 
 	return v;
 }
@@ -86,12 +113,10 @@ uint32_t dos_date(void)
 uint32_t dos_time(void)
 {
 	uint32_t v;
-	struct tm * tm;
-	time_t tloc;
+	struct tm tm;
 
-	time(&tloc);
-	tm = localtime(&tloc);
-	v = (tm->tm_hour << 11) | (tm->tm_min) << 5 | tm->tm_sec;
+	LocalTime(&tm);
+	v = (tm.tm_hour << 11) | (tm.tm_min) << 5 | tm.tm_sec;
 
 	return v;
 }
@@ -172,13 +197,15 @@ void list_setup(void)
 	if (*fnbuf == EOS)
 	{
 		strcpy(fnbuf, firstfname);
-		fext(fnbuf, ".prn", 1);
+		fext(fnbuf, (list_json ? ".jsonl" : ".prn"), 1);
 	}
 
 	list_fname = NULL;
 
 	if ((list_fd = open(fnbuf, _OPEN_FLAGS, _PERM_MODE)) < 0)
 		CantCreateFile(fnbuf);
+
+	CacheNoteOutput(fnbuf);
 }
 
 
@@ -188,6 +215,41 @@ void list_setup(void)
 void taglist(char chr)
 {
 	lnimage[TAG_COL + 1] = chr;
+	lflag = chr;
+}
+
+
+//
+// Write pending listing output to the listing file
+//
+void FlushListing(void)
+{
+	if (lstbufcnt > 0)
+		unused = write(list_fd, lstbuf, lstbufcnt);
+
+	lstbufcnt = 0;
+}
+
+
+//
+// Append 'length' bytes to the listing output buffer, flushing it when full
+//
+void ListingWrite(const char * s, int length)
+{
+	if (lstbufcnt + length > LSTBUFSIZ)
+	{
+		FlushListing();
+
+		// Too big to be worth buffering, so just ship it
+		if (length > LSTBUFSIZ)
+		{
+			unused = write(list_fd, s, length);
+			return;
+		}
+	}
+
+	memcpy(lstbuf + lstbufcnt, s, length);
+	lstbufcnt += length;
 }
 
 
@@ -196,15 +258,212 @@ void taglist(char chr)
 //
 void println(const char * ln)
 {
-	unsigned int length;
-
 	//  Create listing file, if necessary
 	if (list_fname != NULL)
 		list_setup();
 
-	length = strlen(ln);
-	unused = write(list_fd, ln, length);
-	unused = write(list_fd, "\n", 1L);
+	ListingWrite(ln, strlen(ln));
+	ListingWrite("\n", 1);
+}
+
+
+//
+// Write 's' to the listing as a JSON string literal (quotes included)
+//
+static void JsonListString(const char * s)
+{
+	char esc[8];
+	const char * run = s;
+
+	ListingWrite("\"", 1);
+
+	for(; *s; s++)
+	{
+		uint8_t c = *s;
+
+		if (c >= 0x20 && c != '"' && c != '\\')
+			continue;
+
+		ListingWrite(run, s - run);
+		sprintf(esc, "\\u%04x", c);
+		ListingWrite(esc, 6);
+		run = s + 1;
+	}
+
+	ListingWrite(run, s - run);
+	ListingWrite("\"", 1);
+}
+
+
+//
+// Return the name used for section 'sno' in the machine readable listing
+//
+static const char * JsonSectionName(int sno)
+{
+	switch (sno)
+	{
+	case TEXT:    return "text";
+	case DATA:    return "data";
+	case BSS:     return "bss";
+	case M6502:   return "6502";
+	case M56001P: return "56001p";
+	case M56001X: return "56001x";
+	case M56001Y: return "56001y";
+	case M56001L: return "56001l";
+	}
+
+	return "abs";
+}
+
+
+//
+// Ship a message (error, warning) out as a machine readable listing record
+//
+static void JsonListMessage(const char * ln)
+{
+	if (list_fname != NULL)
+		list_setup();
+
+	sprintf(buf, "{\"type\":\"msg\",\"file\":%d,\"line\":%d,\"text\":",
+		(int)cfileno, (int)curlineno);
+	ListingWrite(buf, strlen(buf));
+	JsonListString(ln);
+	ListingWrite("}\n", 2);
+}
+
+
+//
+// Ship the current line out as a machine readable listing record:
+//
+//   {"type":"line","file":F,"line":N,"sect":"text","addr":A,"tag":"@",
+//    "depth":D,"bytes":"4E75","fixups":[[off,size],...]}
+//
+// "flag" is added for lines tagged with an error or warning and "value" for
+// lines that list a value (equates, ds in microprocessor mode). No
+// pagination or column formatting is done.
+//
+static void JsonListEOL(void)
+{
+	CHUNK * ch;
+	uint8_t * p;
+	char hex[64];
+	int n;
+
+	if (list_fname != NULL)
+		list_setup();
+
+	SaveSection();		// Update section variables
+
+	sprintf(buf, "{\"type\":\"line\",\"file\":%d,\"line\":%d,\"sect\":\"%s\","
+		"\"addr\":%u,\"tag\":\"%c\",\"depth\":%d", (int)lfileno, llineno,
+		JsonSectionName(lcursect), lsloc, ltag, ldepth);
+	ListingWrite(buf, strlen(buf));
+
+	if (lflag != SPACE)
+	{
+		sprintf(buf, ",\"flag\":\"%c\"", lflag);
+		ListingWrite(buf, strlen(buf));
+	}
+
+	if (lvalset)
+	{
+		sprintf(buf, ",\"value\":%u", lvalue);
+		ListingWrite(buf, strlen(buf));
+	}
+
+	// Same rules as for the text listing as to when bytes get shipped
+	if (lcursect == cursect && (sect[lcursect].scattr & SBSS) == 0
+		&& lsloc != sloc && just_bss == 0)
+	{
+		ch = sect[lcursect].sfcode;
+
+		if (lcursect != M6502)
+		{
+			for(; ch!=NULL; ch=ch->chnext)
+			{
+				if (lsloc >= ch->chloc && lsloc < (ch->chloc + ch->ch_size))
+					break;
+			}
+		}
+
+		if (ch == NULL)
+			interror(6);	// Can't find generated code in section
+
+		p = ch->chptr + (lsloc - ch->chloc);
+		ListingWrite(",\"bytes\":\"", 10);
+		n = 0;
+
+		for(LONG loc=lsloc; loc<sloc; loc++)
+		{
+			if (lcursect != M6502 && loc >= (ch->chloc + ch->ch_size))
+			{
+				if ((ch = ch->chnext) == NULL)
+					interror(6);
+
+				p = ch->chptr;
+			}
+
+			hex[n++] = hexdigit[*p >> 4];
+			hex[n++] = hexdigit[*p++ & 0x0F];
+
+			if (n == sizeof(hex))
+			{
+				ListingWrite(hex, n);
+				n = 0;
+			}
+		}
+
+		ListingWrite(hex, n);
+		ListingWrite("\",\"fixups\":[", 12);
+		n = 0;
+
+		// Only fixups recorded since the start of the line can cover it
+		for(FIXUP * fp=(lfixup ? lfixup->next : sect[lcursect].sffix);
+			fp!=NULL; fp=fp->next)
+		{
+			uint32_t offs;
+			int size = FixupSize(fp->attr, &offs);
+
+			if (size == 0)
+				continue;
+
+			// A block fixup (dcb & co.) covers 'count' values in a row
+			for(uint32_t i=0; i<fp->count; i++)
+			{
+				uint32_t xloc = fp->loc + offs + i * size;
+
+				if (xloc < lsloc || xloc >= sloc)
+					continue;
+
+				sprintf(buf, "%s[%u,%d]", (n++ ? "," : ""), xloc - lsloc, size);
+				ListingWrite(buf, strlen(buf));
+			}
+		}
+
+		ListingWrite("]", 1);
+	}
+
+	ListingWrite("}\n", 2);
+}
+
+
+//
+// Ship the table of file ids used by the machine readable listing
+//
+void JsonListFiles(void)
+{
+	int fileno = 0;
+
+	if (list_fname != NULL)
+		list_setup();
+
+	for(FILEREC * fr=filerec; fr!=NULL; fr=fr->frec_next, fileno++)
+	{
+		sprintf(buf, "{\"type\":\"file\",\"file\":%d,\"name\":", fileno);
+		ListingWrite(buf, strlen(buf));
+		JsonListString(fr->frec_name);
+		ListingWrite("}\n", 2);
+	}
 }
 
 
@@ -217,26 +476,31 @@ void ship_ln(const char * ln)
 	if (listing <= 0)
 		return;
 
+	if (list_json)
+	{
+		JsonListMessage(ln);
+		return;
+	}
+
 	if (list_pag)
 	{
 		// Notice bottom of page
 		if (nlines >= pagelen - BOT_MAR)
 			eject();
 
-		// Print title, boilerplate, and subtitle at top of page
+		// Print title, boilerplate, and subtitle at top of page. The date and
+		// time strings are set up once by InitListing() and reused for every
+		// page.
 		if (nlines == 0)
 		{
 			pageno++;
 			println("");
-			date_string(datestr, dos_date());
-			time_string(timestr, dos_time());
 			sprintf(buf,
 				"%-40s%-20s Page %-4d    %s %s        RMAC %01i.%01i.%02i (%s)",
 				title, curfname, pageno, timestr, datestr, MAJOR, MINOR, PATCH,
 				PLATFORM);
 			println(buf);
-			sprintf(buf, "%s", subttl);
-			println(buf);
+			println(subttl);
 			println("");
 			nlines = 4;
 		}
@@ -259,6 +523,7 @@ void InitListing(void)
 	pagewidth = 132;
 	strcpy(title, "");
 	strcpy(subttl, "");
+	lstbufcnt = 0;
 	date_string(datestr, dos_date());
 	time_string(timestr, dos_time());
 }
@@ -277,6 +542,12 @@ void listeol(void)
 
 	DEBUG printf("~list: lsloc=$%X sloc=$%X\n", lsloc, sloc);
 
+	if (list_json)
+	{
+		JsonListEOL();
+		return;
+	}
+
 	if (lsloc != sloc)
 	{
 		sprintf(buf, "%08X", lsloc);
@@ -386,6 +657,24 @@ void lstout(char tag)
 	lcursect = cursect;
 	llineno = curlineno;
 
+	if (list_json)
+	{
+		lfileno = cfileno;
+		ltag = tag;
+		lflag = SPACE;
+		lfixup = sect[cursect].sfix;
+		lvalset = 0;
+		ldepth = 0;
+
+		for(INOBJ * inobj=cur_inobj; inobj!=NULL; inobj=inobj->in_link)
+		{
+			if (inobj->in_type != SRC_IFILE)
+				ldepth++;
+		}
+
+		return;
+	}
+
 	lnfill(lnimage, SRC_COL, SPACE);	// Fill with spaces
 	lnimage[TAG_COL] = tag;
 
@@ -412,6 +701,12 @@ void lstout(char tag)
 //
 int listvalue(uint32_t v)
 {
+	lvalset = 1;
+	lvalue = v;
+
+	if (list_json)
+		return 0;
+
 	sprintf(buf, "=%08X", v);
 	strncpy(lnimage + DATA_COL - 1, buf, 9);
 	return 0;
@@ -21,14 +21,15 @@
 #define DATA_END        (DATA_COL+20)	// End+1th data column
 #define TAG_COL         38				// Tag character
 #define SRC_COL         40				// Source start
+#define LSTBUFSIZ       0x10000			// Size of listing output buffer
 
 // Exported variables
-extern char * list_fname;
-extern int listing;
-extern int pagelen;
-extern int nlines;
-extern LONG lsloc;
-extern uint8_t subttl[];
+extern ASMCTX char * list_fname;
+extern ASMCTX int listing;
+extern ASMCTX int pagelen;
+extern ASMCTX int nlines;
+extern ASMCTX LONG lsloc;
+extern ASMCTX uint8_t subttl[];
 
 // Exported functions
 int eject(void);
@@ -36,6 +37,9 @@ uint32_t dos_date(void);
 uint32_t dos_time(void);
 void taglist(char);
 void println(const char *);
+void ListingWrite(const char *, int);
+void FlushListing(void);
+void JsonListFiles(void);
 void ship_ln(const char *);
 void InitListing(void);
 void listeol(void);
@@ -13,6 +13,7 @@
 #include "error.h"
 #include "expr.h"
 #include "procln.h"
+#include "relax.h"
 #include "riscasm.h"
 #include "sect.h"
 #include "token.h"
@@ -21,7 +22,7 @@
 #include "68kregs.h"
 
 // Exported variables
-int movep = 0; // Global flag to indicate we're generating a movep instruction
+ASMCTX int movep = 0; // Global flag to indicate we're generating a movep instruction
 
 // Function prototypes
 int m_unimp(WORD, WORD), m_badmode(WORD, WORD);
@@ -174,6 +175,11 @@ MNTAB machtab[] = {
 	{  0,  0L,  0L, 0x0000, 0, m_unimp   }            // Last entry
 };
 
+// Variant selection table, with a row for every entry a mnemonic starts on
+MNVAR mnvartab[] = {
+#include "68kvar.h"
+};
+
 // Register number << 9
 WORD reg_9[8] = {
 	0, 1 << 9, 2 << 9, 3 << 9, 4 << 9, 5 << 9, 6 << 9, 7 << 9
@@ -899,6 +905,8 @@ int m_movep(WORD inst, WORD siz)
 //
 int m_br(WORD inst, WORD siz)
 {
+	int sdino = -1;				// Span-dependent instruction #, if any
+
 	if (a0exattr & DEFINED)
 	{
 		if ((a0exattr & TDB) != cursect)
@@ -955,12 +963,30 @@ int m_br(WORD inst, WORD siz)
 		return OK;
 	}
 	else if (siz == SIZN)
+	{
 		siz = SIZW;
 
+		// Forward branches with no size given are span-dependent; with
+		// --relax the sizing passes tell us whether they can be .s
+		if (CHECK_OPTS(OPT_BSR_BCC_S))
+		{
+			sdino = RelaxSite(SDI_BRANCH);
+
+			if (RelaxState(sdino) == SDI_SHORT)
+			{
+				if (optim_warn_flag)
+					warn("o2: Bcc.w/BSR.w converted to .s");
+
+				siz = SIZS;
+			}
+		}
+	}
+
 	if (siz == SIZB || siz == SIZS)
 	{
 		// .B
 		AddFixup(FU_BBRA | FU_PCREL | FU_SEXT, sloc, a0expr);
+		RelaxFixup(sdino);
 		// So here we have a small issue: this bra.s could be zero offset, but
 		// we can never know. Because unless we know beforehand that the
 		// offset will be zero (i.e. "bra.s +0"), it's going to be a label
@@ -983,6 +1009,7 @@ int m_br(WORD inst, WORD siz)
 		// .W
 		D_word(inst);
 		AddFixup(FU_WORD | FU_PCREL | FU_LBRA | FU_ISBRA, sloc, a0expr);
+		RelaxFixup(sdino);
 		D_word(0);
 	}
 
@@ -3952,3 +3979,58 @@ int m_plpa(WORD inst, WORD siz)
 	return OK;
 }
 
+
+//
+// Check that the variant selection table picks the same machtab[] entry as
+// walking the chain does, for every mnemonic, size and pair of addressing
+// mode bits. Returns the number of mismatches.
+//
+int CheckVariantTable(void)
+{
+	int nrows = sizeof(mnvartab) / sizeof(MNVAR);
+	int bad = 0;
+
+	for(int n=1; n<nrows; n++)
+	{
+		MNVAR * v = &mnvartab[n];
+
+		int head = 0;
+
+		// Only rows that start a mnemonic are filled in
+		for(int s=0; s<9; s++)
+			head |= v->siz[s];
+
+		if (!head)
+			continue;
+
+		for(int s=0; s<9; s++)
+		{
+			for(int b0=0; b0<32; b0++)
+			{
+				for(int b1=0; b1<32; b1++)
+				{
+					WORD siz = (WORD)(1 << s);
+					LONG amsk0 = 1L << b0, amsk1 = 1L << b1;
+					MNTAB * m = &machtab[n];
+
+					while (!(m->mnattr & siz) || (amsk0 & m->mn0) == 0 || (amsk1 & m->mn1) == 0)
+						m = &machtab[m->mncont];
+
+					int bits = v->siz[s] & v->am0[b0] & v->am1[b1];
+					int k = 0;
+
+					if (bits)
+						for(k=n; !(bits & 1); bits >>= 1, k++);
+
+					if (m != &machtab[k])
+					{
+						printf("variant table mismatch: entry %d, size $%X, modes $%X/$%X: %d instead of %d\n", n, siz, (uint32_t)amsk0, (uint32_t)amsk1, k, (int)(m - machtab));
+						bad++;
+					}
+				}
+			}
+		}
+	}
+
+	return bad;
+}
@@ -21,6 +21,16 @@ MNTAB {
 	int (* mnfunc)(WORD, WORD);		// Mnemonic builder
 };
 
+// Variant selection table (made by 68kgen): for every size and addressing
+// mode bit, which variants of a mnemonic take it (bit n = n'th entry from
+// the first)
+#define MNVAR  struct _mnvar
+MNVAR {
+	uint16_t siz[9];				// SIZB..SIZQ
+	uint16_t am0[32];				// ea0 addressing mode mask bits
+	uint16_t am1[32];				// ea1 addressing mode mask bits
+};
+
 // Exported variables
 extern char seg_error[];
 extern char undef_error[];
@@ -29,7 +39,11 @@ extern char range_error[];
 extern char abs_error[];
 extern char unsupport[];
 extern MNTAB machtab[];
-extern int movep;
+extern MNVAR mnvartab[];
+extern ASMCTX int movep;
+
+// Exported functions
+int CheckVariantTable(void);
 
 #endif // __MACH_H__
 
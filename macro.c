@@ -17,17 +17,21 @@
 #include "token.h"
 
 
-LONG curuniq;				// Current macro's unique number
-int macnum;					// Unique number for macro definition
+ASMCTX LONG curuniq;				// Current macro's unique number
+ASMCTX int macnum;					// Unique number for macro definition
 
-static LONG macuniq;		// Unique-per-macro number
-static SYM * curmac;		// Macro currently being defined
-static uint32_t argno;		// Formal argument count
-LONG reptuniq;				// Unique-per-rept number
+static ASMCTX LONG macuniq;		// Unique-per-macro number
+static ASMCTX SYM * curmac;		// Macro currently being defined
+static ASMCTX uint32_t argno;		// Formal argument count
+ASMCTX LONG reptuniq;				// Unique-per-rept number
 
-static LLIST * firstrpt;	// First .rept line
-static LLIST * nextrpt;		// Last .rept line
-int rptlevel;				// .rept nesting level
+static ASMCTX uint8_t * rptbuf;	// .rept lines caught so far (lineno, text)
+static ASMCTX size_t rptsize;		// Size of 'rptbuf'
+static ASMCTX size_t rptused;		// Bytes used in 'rptbuf'
+static ASMCTX uint32_t rptlines;	// # of lines in 'rptbuf'
+ASMCTX int rptlevel;				// .rept nesting level
+
+static ASMCTX SYM * maccache[MACCACHESIZ];	// Last macro looked up, by name hash
 
 // Function prototypes
 static int KWMatch(char *, char *);
@@ -42,6 +46,37 @@ void InitMacro(void)
 	macuniq = 0;
 	macnum = 1;
 	reptuniq = 0;
+	memset(maccache, 0, sizeof(maccache));
+	free(rptbuf);
+	rptbuf = NULL;
+	rptsize = 0;
+}
+
+
+//
+// Look up a macro by name. The same few macros tend to get invoked over and
+// over, so the last one found is kept for every hash slot; this saves a walk
+// down a symbol table bucket that is shared with all the labels.
+//
+SYM * LookupMacro(char * name)
+{
+	uint32_t hash = 0;
+
+	for(char * p=name; *p; p++)
+		hash = (hash * 31) + (uint8_t)*p;
+
+	SYM ** slot = &maccache[hash & (MACCACHESIZ - 1)];
+	SYM * sy = *slot;
+
+	// An .undefmac'd macro has its type changed, so it won't match
+	if ((sy != NULL) && (sy->stype == MACRO) && (*name == *sy->sname)
+		&& !strcmp(name, sy->sname))
+		return sy;
+
+	if ((sy = lookup(name, MACRO, 0)) != NULL)
+		*slot = sy;
+
+	return sy;
 }
 
 
@@ -208,38 +243,31 @@ int defr1(char * line, int kwno)
 
 //DEBUG { printf("  defr1: line=\"%s\", kwno=%d, rptlevel=%d\n", line, kwno, rptlevel); }
 
-#if 0
-//MORE stupidity here...
-WARNING("!!! Casting (char *) as LONG !!!")
-	// Allocate length of line + 1('\0') + LONG
-	LONG * p = (LONG *)malloc(strlen(line) + 1 + sizeof(LONG));
-	*p = 0;
-	strcpy((char *)(p + 1), line);
-
-	if (nextrpt == NULL)
-		firstrpt = p;		// First line of rept statement
-	else
-		*nextrpt = (LONG)p;
-
-	nextrpt = p;
-#else
-	if (firstrpt == NULL)
-	{
-		firstrpt = malloc(sizeof(LLIST));
-		firstrpt->next = NULL;
-		firstrpt->line = strdup(line);
-		firstrpt->lineno = curlineno;
-		nextrpt = firstrpt;
-	}
-	else
+	// The lines are staged here until the block's all in, so the IREPT can
+	// get them in one piece sized to fit
+	size_t len = strlen(line) + 1;
+
+	if (rptused + sizeof(int) + len > rptsize)
 	{
-		nextrpt->next = malloc(sizeof(LLIST));
-		nextrpt->next->next = NULL;
-		nextrpt->next->line = strdup(line);
-		nextrpt->next->lineno = curlineno;
-		nextrpt = nextrpt->next;
+		size_t size = (rptsize == 0 ? 0x1000 : rptsize * 2);
+
+		while (rptused + sizeof(int) + len > size)
+			size *= 2;
+
+		// On failure, the old buffer stays put, to be used by the next .rept
+		uint8_t * buf = realloc(rptbuf, size);
+
+		if (buf == NULL)
+			return fatal("out of memory for .rept lines");
+
+		rptbuf = buf;
+		rptsize = size;
 	}
-#endif
+
+	memcpy(rptbuf + rptused, &curlineno, sizeof(int));
+	memcpy(rptbuf + rptused + sizeof(int), line, len);
+	rptused += sizeof(int) + len;
+	rptlines++;
 
 	return rptlevel;
 }
@@ -257,18 +285,32 @@ int HandleRept(void)
 		return ERROR;
 
 	// Suck in lines for .rept block
-	firstrpt = NULL;
-	nextrpt = NULL;
+	rptused = 0;
+	rptlines = 0;
 	rptlevel = 1;
 	LNCatch(defr1, "endr rept ");
 
-//DEBUG { printf("HandleRept: firstrpt=$%X\n", firstrpt); }
-	// Alloc and init input object
-	if (firstrpt)
+	// Alloc and init input object, with the lines packed in behind it
+	if (rptlines)
 	{
 		INOBJ * inobj = a_inobj(SRC_IREPT);	// Create a new REPT input object
 		IREPT * irept = inobj->inobj.irept;
-		irept->ir_firstln = firstrpt;
+		LLIST * ln = AllocInput(rptlines * sizeof(LLIST));
+		uint8_t * text = AllocInput(rptused - rptlines * sizeof(int));
+		uint8_t * p = rptbuf;
+
+		for(uint32_t i=0; i<rptlines; i++)
+		{
+			memcpy(&ln[i].lineno, p, sizeof(int));
+			p += sizeof(int);
+			size_t len = strlen((char *)p) + 1;
+			ln[i].line = memcpy(text, p, len);
+			ln[i].next = (i + 1 < rptlines ? &ln[i + 1] : NULL);
+			text += len;
+			p += len;
+		}
+
+		irept->ir_firstln = ln;
 		irept->ir_nextln = NULL;
 		irept->ir_count = (uint32_t)eval;
 	}
@@ -397,92 +439,96 @@ int InvokeMacro(SYM * mac, WORD siz)
 {
 	DEBUG { printf("InvokeMacro: arguments="); DumpTokens(tok); }
 
-	INOBJ * inobj = a_inobj(SRC_IMACRO);	// Alloc and init IMACRO
-	IMACRO * imacro = inobj->inobj.imacro;
+	// Size up the arguments, if any (tok comes from token.c, which at this
+	// point points at the macro argument token stream), so they can be
+	// allocated to fit with the IMACRO
 	uint16_t nargs = 0;
+	uint32_t ntokens = 0, nstrings = 0, textsize = 0;
+	int stringNum = 0;
+	int numTokens = 0;
 
-	// Chop up the arguments, if any (tok comes from token.c, which at this
-	// point points at the macro argument token stream)
-	if (*tok != EOL)
+	for(TOKEN * t=tok; *t!=EOL;)
 	{
-		// Parse out the arguments and set them up correctly
-		TOKEN * p = imacro->argument[nargs].token;
-		int stringNum = 0;
-		int numTokens = 0;
+		int n = 1;
 
-		while (*tok != EOL)
+		if (*t == CONST || *t == FCONST || *t == ACONST)	// Constants are 64-bits
+			n = 3;
+		else if ((*t == STRING) || (*t == STRINGA8) || (*t == SYMBOL))
 		{
-			if (*tok == ACONST)
-			{
-				// Sanity checking (it's numTokens + 1 because we need an EOL
-				// if we successfully parse this argument)
-				if ((numTokens + 3) >= TS_MAXTOKENS)
-					return error("Too many tokens in argument #%d in MACRO invocation", nargs + 1);
+			if (stringNum >= TS_MAXSTRINGS)
+				return error("Too many strings in argument #%d in MACRO invocation", nargs + 1);
 
-				for(int i=0; i<3; i++)
-					*p++ = *tok++;
+			textsize += strlen(string[t[1]]) + 1;
+			stringNum++;
+			n = 2;
+		}
+		else if (*t == ',')
+		{
+			// Sanity checking
+			if ((nargs + 1) >= TS_MAXARGS)
+				return error("Too many arguments in MACRO invocation");
+
+			// Comma delimiter was found, so set up for next argument
+			ntokens += numTokens + 1;
+			nstrings += stringNum;
+			stringNum = 0;
+			numTokens = 0;
+			nargs++;
+			t++;
+			continue;
+		}
 
-				numTokens += 3;
-			}
-			else if (*tok == CONST)		// Constants are 64-bits
-			{
-				// Sanity checking (it's numTokens + 1 because we need an EOL
-				// if we successfully parse this argument)
-				if ((numTokens + 3) >= TS_MAXTOKENS)
-					return error("Too many tokens in argument #%d in MACRO invocation", nargs + 1);
-
-				*p++ = *tok++;			// Token
-				uint64_t *p64 = (uint64_t *)p;
-				uint64_t *tok64 = (uint64_t *)tok;
-				*p64++ = *tok64++;
-				tok = (TOKEN *)tok64;
-				p = (uint32_t *)p64;
-				numTokens += 3;
-			}
-			else if ((*tok == STRING) || (*tok == SYMBOL))
-			{
-				// Sanity checking (it's numTokens + 1 because we need an EOL
-				// if we successfully parse this argument)
-				if (stringNum >= TS_MAXSTRINGS)
-					return error("Too many strings in argument #%d in MACRO invocation", nargs + 1);
+		// Sanity checking (it's numTokens + n because we need an EOL if we
+		// successfully parse this argument)
+		if ((numTokens + n) >= TS_MAXTOKENS)
+			return error("Too many tokens in argument #%d in MACRO invocation", nargs + 1);
 
-				if ((numTokens + 2) >= TS_MAXTOKENS)
-					return error("Too many tokens in argument #%d in MACRO invocation", nargs + 1);
+		numTokens += n;
+		t += n;
+	}
 
-				*p++ = *tok++;
-				imacro->argument[nargs].string[stringNum] = strdup(string[*tok++]);
-				*p++ = stringNum++;
-				numTokens += 2;
-			}
-			else if (*tok == ',')
+	if (*tok != EOL)
+	{
+		ntokens += numTokens + 1;
+		nstrings += stringNum;
+		nargs++;
+	}
+
+	INOBJ * inobj = a_inobj(SRC_IMACRO);	// Alloc and init IMACRO
+	IMACRO * imacro = inobj->inobj.imacro;
+	imacro->argument = AllocInput(nargs * sizeof(TOKENSTREAM));
+	TOKEN * p = AllocInput(ntokens * sizeof(TOKEN));
+	char ** sp = AllocInput(nstrings * sizeof(char *));
+	char * text = AllocInput(textsize);
+
+	// Chop up the arguments
+	for(uint16_t i=0; i<nargs; i++)
+	{
+		imacro->argument[i].token = p;
+		imacro->argument[i].string = sp;
+
+		while (*tok != ',' && *tok != EOL)
+		{
+			if (*tok == CONST || *tok == FCONST || *tok == ACONST)
 			{
-				// Sanity checking
-				if ((nargs + 1) >= TS_MAXARGS)
-					return error("Too many arguments in MACRO invocation");
-
-				// Comma delimiter was found, so set up for next argument
-				*p++ = EOL;
-				tok++;
-				stringNum = 0;
-				numTokens = 0;
-				nargs++;
-				p = imacro->argument[nargs].token;
+				for(int j=0; j<3; j++)
+					*p++ = *tok++;
 			}
-			else
+			else if ((*tok == STRING) || (*tok == STRINGA8) || (*tok == SYMBOL))
 			{
-				// Sanity checking (it's numTokens + 1 because we need an EOL
-				// if we successfully parse this argument)
-				if ((numTokens + 1) >= TS_MAXTOKENS)
-					return error("Too many tokens in argument #%d in MACRO invocation", nargs + 1);
-
 				*p++ = *tok++;
-				numTokens++;
+				*sp = strcpy(text, string[*tok++]);
+				text += strlen(text) + 1;
+				*p++ = (TOKEN)(sp++ - imacro->argument[i].string);
 			}
+			else
+				*p++ = *tok++;
 		}
 
-		// Make sure to stuff the final EOL (otherwise, it will be skipped)
 		*p++ = EOL;
-		nargs++;
+
+		if (*tok == ',')
+			tok++;
 	}
 
 	// Setup IMACRO:
@@ -11,14 +11,18 @@
 
 #include "rmac.h"
 
+// Tunable definitions
+#define MACCACHESIZ  64			// Macro lookup cache size (power of 2)
+
 // Exported variables
-extern LONG curuniq;
+extern ASMCTX LONG curuniq;
 extern TOKEN * argPtrs[];
-extern LONG reptuniq;
-extern int rptlevel;
+extern ASMCTX LONG reptuniq;
+extern ASMCTX int rptlevel;
 
 // Exported functions
 void InitMacro(void);
+SYM * LookupMacro(char *);
 int ExitMacro(void);
 int DefineMacro(void);
 int HandleRept(void);
@@ -20,15 +20,14 @@ GOTO NOGEN
 
 echo Generating files...
 
-68kgen 68k.tab <68k.mch >68ktab.h
+68kgen 68k.tab 68kvar.h <68k.mch >68ktab.h
 dsp56kgen dsp56k.tab <dsp56k.mch >dsp56ktab.h
 type direct.tab 68k.tab | kwgen mn >mntab.h
 kwgen kw <kw.tab >kwtab.h
-kwgen mr <risc.tab >risckw.h
-kwgen dsp <dsp56k.tab >dsp56kkw.h
-kwgen mp <6502.tab >6502kw.h
-kwgen mp <6502.tab >6502kw.h
-kwgen mo <op.tab >opkw.h
+type risc.tab direct.tab | kwgen mr >risckw.h
+type dsp56k.tab direct.tab | kwgen dsp >dsp56kkw.h
+type 6502.tab direct.tab | kwgen mp >6502kw.h
+type op.tab direct.tab | kwgen mo >opkw.h
 kwgen reg68 <68kregs.tab >68kregs.h
 kwgen reg56 <56kregs.tab >56kregs.h
 kwgen reg65 <6502regs.tab >6502regs.h
@@ -16,12 +16,12 @@
 #define MARK_ALLOC_INCR 1024		// # bytes to alloc for more mark space
 #define MIN_MARK_MEM    (3 * sizeof(uint16_t) + 1 * sizeof(uint32_t) + sizeof(SYM *))
 
-MCHUNK * firstmch;		// First mark chunk
-MCHUNK * curmch;		// Current mark chunk
-PTR markptr;			// Deposit point in current mark chunk
-uint32_t mcalloc;		// # bytes alloc'd to current mark chunk
-uint32_t mcused;		// # bytes used in current mark chunk
-uint16_t curfrom;		// Current "from" section
+ASMCTX MCHUNK * firstmch;		// First mark chunk
+ASMCTX MCHUNK * curmch;		// Current mark chunk
+ASMCTX PTR markptr;			// Deposit point in current mark chunk
+ASMCTX uint32_t mcalloc;		// # bytes alloc'd to current mark chunk
+ASMCTX uint32_t mcused;		// # bytes used in current mark chunk
+ASMCTX uint16_t curfrom;		// Current "from" section
 
 // Table to convert from TDB to fixup triad
 static uint8_t mark_tr[] = {
@@ -39,6 +39,14 @@ static uint8_t mark_tr[] = {
 //
 void InitMark(void)
 {
+	// Free the last assembly's marks
+	while (firstmch != NULL)
+	{
+		MCHUNK * mch = firstmch;
+		firstmch = mch->mcnext;
+		free(mch);
+	}
+
 	firstmch = curmch = NULL;
 	mcalloc = mcused = 0;
 	curfrom = 0;
@@ -42,7 +42,7 @@ MCHUNK {
 #define MCHFROM      0x8000		// Mark includes change-to-from
 
 // Exported variables
-extern MCHUNK * firstmch;
+extern ASMCTX MCHUNK * firstmch;
 
 // Exported functions
 void InitMark(void);
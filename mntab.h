@@ -0,0 +1,1399 @@
+#ifdef DEF_MN
+/*
+ *  Keyword definitions
+ */
+#define	MN__56001	64
+#define	MN__6502	2
+#define	MN__68000	3
+#define	MN__68020	58
+#define	MN__68030	59
+#define	MN__68040	60
+#define	MN__68060	61
+#define	MN__68881	62
+#define	MN__68882	63
+#define	MN__ABS	7
+#define	MN__ALIGN	69
+#define	MN__ASSERT	28
+#define	MN__BSS	4
+#define	MN__CARGS	10
+#define	MN__CCUNDEF	51
+#define	MN__COMM	8
+#define	MN__CSTRUCT	53
+#define	MN__DATA	5
+#define	MN__DC	12
+#define	MN__DCB	17
+#define	MN__DISABLE	22
+#define	MN__DPHRASE	42
+#define	MN__DS	13
+#define	MN__DSM	68
+#define	MN__DSP	16
+#define	MN__DUMP	20
+#define	MN__EJECT	46
+#define	MN__ELSE	501
+#define	MN__ENABLE	23
+#define	MN__END	34
+#define	MN__ENDC	502
+#define	MN__ENDIF	502
+#define	MN__ENDM	505
+#define	MN__ENDR	507
+#define	MN__EQU	18
+#define	MN__EQURUNDEF	50
+#define	MN__ERROR	47
+#define	MN__EVEN	1
+#define	MN__EXITM	510
+#define	MN__EXTERN	24
+#define	MN__GLOBL	24
+#define	MN__GOTO	11
+#define	MN__GPU	15
+#define	MN__GPUMAIN	56
+#define	MN__IF	500
+#define	MN__IIF	503
+#define	MN__INCBIN	21
+#define	MN__INCLUDE	33
+#define	MN__INIT	9
+#define	MN__JPAD	54
+#define	MN__LIST	38
+#define	MN__LONG	40
+#define	MN__MACRO	504
+#define	MN__MACUNDEF	14
+#define	MN__NLIST	39
+#define	MN__NOCLEAR	49
+#define	MN__NOFPU	65
+#define	MN__NOJPAD	55
+#define	MN__NOLIST	39
+#define	MN__OBJPROC	67
+#define	MN__OFFSET	7
+#define	MN__OPT	66
+#define	MN__ORG	0
+#define	MN__PHRASE	41
+#define	MN__PRGFLAGS	57
+#define	MN__PRINT	52
+#define	MN__QPHRASE	43
+#define	MN__REGBANK0	25
+#define	MN__REGBANK1	26
+#define	MN__REGUNDEF	50
+#define	MN__REPT	506
+#define	MN__SUBTTL	45
+#define	MN__TABLE	70
+#define	MN__TEXT	6
+#define	MN__TITLE	44
+#define	MN__UNDEFMAC	14
+#define	MN__WARN	48
+#define	MN_ABCD	1001
+#define	MN_ADD	1003
+#define	MN_ADDA	1005
+#define	MN_ADDI	1006
+#define	MN_ADDQ	1008
+#define	MN_ADDX	1009
+#define	MN_AND	1011
+#define	MN_ANDI	1013
+#define	MN_ASL	1017
+#define	MN_ASR	1021
+#define	MN_ASSERT	28
+#define	MN_BCC	1025
+#define	MN_BCHG	1053
+#define	MN_BCLR	1057
+#define	MN_BCS	1027
+#define	MN_BEQ	1029
+#define	MN_BFCHG	1061
+#define	MN_BFCLR	1062
+#define	MN_BFEXTS	1063
+#define	MN_BFEXTU	1064
+#define	MN_BFFFO	1065
+#define	MN_BFINS	1066
+#define	MN_BFSET	1067
+#define	MN_BFTST	1068
+#define	MN_BGE	1031
+#define	MN_BGT	1033
+#define	MN_BHI	1035
+#define	MN_BHS	1025
+#define	MN_BKPT	1069
+#define	MN_BLE	1037
+#define	MN_BLO	1027
+#define	MN_BLS	1039
+#define	MN_BLT	1041
+#define	MN_BMI	1043
+#define	MN_BNE	1045
+#define	MN_BNZ	1045
+#define	MN_BPL	1047
+#define	MN_BRA	1070
+#define	MN_BSET	1072
+#define	MN_BSR	1076
+#define	MN_BSS	4
+#define	MN_BT	1071
+#define	MN_BTST	1078
+#define	MN_BVC	1049
+#define	MN_BVS	1051
+#define	MN_BZ	1029
+#define	MN_BZE	1029
+#define	MN_CALLM	1082
+#define	MN_CARGS	10
+#define	MN_CAS	1083
+#define	MN_CAS2	1084
+#define	MN_CCUNDEF	51
+#define	MN_CHK	1085
+#define	MN_CHK2	1090
+#define	MN_CINVA	1089
+#define	MN_CINVL	1087
+#define	MN_CINVP	1088
+#define	MN_CLR	1091
+#define	MN_CMP	1094
+#define	MN_CMP2	1100
+#define	MN_CMPA	1096
+#define	MN_CMPI	1097
+#define	MN_CMPM	1099
+#define	MN_COMM	8
+#define	MN_CPBEQ	1101
+#define	MN_CPBF	1127
+#define	MN_CPBGE	1102
+#define	MN_CPBGL	1104
+#define	MN_CPBGLE	1105
+#define	MN_CPBGT	1103
+#define	MN_CPBLE	1106
+#define	MN_CPBLT	1107
+#define	MN_CPBNE	1108
+#define	MN_CPBNGE	1110
+#define	MN_CPBNGL	1111
+#define	MN_CPBNGLE	1113
+#define	MN_CPBNGT	1109
+#define	MN_CPBNLE	1112
+#define	MN_CPBNZ	1113
+#define	MN_CPBOGE	1116
+#define	MN_CPBOGL	1122
+#define	MN_CPBOGT	1114
+#define	MN_CPBOLE	1120
+#define	MN_CPBOLT	1118
+#define	MN_CPBOR	1124
+#define	MN_CPBRA	1126
+#define	MN_CPBSEQ	1130
+#define	MN_CPBSF	1128
+#define	MN_CPBSNE	1131
+#define	MN_CPBST	1129
+#define	MN_CPBT	1126
+#define	MN_CPBUEQ	1123
+#define	MN_CPBUGE	1119
+#define	MN_CPBUGT	1121
+#define	MN_CPBULE	1115
+#define	MN_CPBULT	1117
+#define	MN_CPBUN	1125
+#define	MN_CPBZ	1101
+#define	MN_CPBZE	1101
+#define	MN_CPDBEQ	1132
+#define	MN_CPDBF	1158
+#define	MN_CPDBGE	1133
+#define	MN_CPDBGL	1135
+#define	MN_CPDBGLE	1136
+#define	MN_CPDBGT	1134
+#define	MN_CPDBLE	1137
+#define	MN_CPDBLT	1138
+#define	MN_CPDBNE	1139
+#define	MN_CPDBNGE	1141
+#define	MN_CPDBNGL	1142
+#define	MN_CPDBNGLE	1144
+#define	MN_CPDBNGT	1140
+#define	MN_CPDBNLE	1143
+#define	MN_CPDBNZ	1144
+#define	MN_CPDBOGE	1147
+#define	MN_CPDBOGL	1153
+#define	MN_CPDBOGT	1145
+#define	MN_CPDBOLE	1151
+#define	MN_CPDBOLT	1149
+#define	MN_CPDBOR	1155
+#define	MN_CPDBRA	1157
+#define	MN_CPDBSEQ	1161
+#define	MN_CPDBSF	1159
+#define	MN_CPDBSNE	1162
+#define	MN_CPDBST	1160
+#define	MN_CPDBT	1157
+#define	MN_CPDBUEQ	1154
+#define	MN_CPDBUGE	1150
+#define	MN_CPDBUGT	1152
+#define	MN_CPDBULE	1146
+#define	MN_CPDBULT	1148
+#define	MN_CPDBUN	1156
+#define	MN_CPDBZ	1132
+#define	MN_CPDBZE	1132
+#define	MN_CPRESTORE	1163
+#define	MN_CPSAC	1172
+#define	MN_CPSAS	1171
+#define	MN_CPSAVE	1164
+#define	MN_CPSBC	1166
+#define	MN_CPSBS	1165
+#define	MN_CPSCC	1180
+#define	MN_CPSCS	1179
+#define	MN_CPSGC	1177
+#define	MN_CPSGS	1178
+#define	MN_CPSIC	1176
+#define	MN_CPSIS	1175
+#define	MN_CPSLC	1168
+#define	MN_CPSLS	1167
+#define	MN_CPSSC	1170
+#define	MN_CPSSS	1169
+#define	MN_CPSWC	1174
+#define	MN_CPSWS	1173
+#define	MN_CPUSHA	1183
+#define	MN_CPUSHL	1181
+#define	MN_CPUSHP	1182
+#define	MN_CSTRUCT	53
+#define	MN_DATA	5
+#define	MN_DBCC	1184
+#define	MN_DBCS	1185
+#define	MN_DBEQ	1186
+#define	MN_DBF	1187
+#define	MN_DBGE	1188
+#define	MN_DBGT	1189
+#define	MN_DBHI	1190
+#define	MN_DBHS	1190
+#define	MN_DBLE	1191
+#define	MN_DBLO	1185
+#define	MN_DBLS	1192
+#define	MN_DBLT	1193
+#define	MN_DBMI	1194
+#define	MN_DBNE	1195
+#define	MN_DBNZ	1195
+#define	MN_DBPL	1196
+#define	MN_DBRA	1187
+#define	MN_DBT	1197
+#define	MN_DBVC	1198
+#define	MN_DBVS	1199
+#define	MN_DBZE	1186
+#define	MN_DC	12
+#define	MN_DCB	17
+#define	MN_DISABLE	22
+#define	MN_DIVS	1200
+#define	MN_DIVSL	1202
+#define	MN_DIVU	1203
+#define	MN_DIVUL	1205
+#define	MN_DPHRASE	42
+#define	MN_DS	13
+#define	MN_DSM	68
+#define	MN_DUMP	20
+#define	MN_EJECT	46
+#define	MN_ELSE	501
+#define	MN_ENABLE	23
+#define	MN_END	34
+#define	MN_ENDC	502
+#define	MN_ENDIF	502
+#define	MN_ENDM	505
+#define	MN_ENDR	507
+#define	MN_EOR	1206
+#define	MN_EORI	1207
+#define	MN_EQU	18
+#define	MN_EQURUNDEF	50
+#define	MN_ERROR	47
+#define	MN_EVEN	1
+#define	MN_EXG	1211
+#define	MN_EXITM	510
+#define	MN_EXT	1212
+#define	MN_EXTB	1214
+#define	MN_EXTERN	24
+#define	MN_FABS	1215
+#define	MN_FACOS	1224
+#define	MN_FADD	1227
+#define	MN_FASIN	1233
+#define	MN_FATAN	1236
+#define	MN_FATANH	1239
+#define	MN_FBEQ	1242
+#define	MN_FBF	1269
+#define	MN_FBGE	1243
+#define	MN_FBGL	1245
+#define	MN_FBGLE	1246
+#define	MN_FBGT	1244
+#define	MN_FBLE	1247
+#define	MN_FBLT	1248
+#define	MN_FBNE	1249
+#define	MN_FBNGE	1251
+#define	MN_FBNGL	1252
+#define	MN_FBNGLE	1255
+#define	MN_FBNGT	1250
+#define	MN_FBNLE	1253
+#define	MN_FBNLT	1254
+#define	MN_FBNZ	1255
+#define	MN_FBOGE	1258
+#define	MN_FBOGL	1264
+#define	MN_FBOGT	1256
+#define	MN_FBOLE	1262
+#define	MN_FBOLT	1260
+#define	MN_FBOR	1266
+#define	MN_FBRA	1268
+#define	MN_FBSEQ	1272
+#define	MN_FBSF	1270
+#define	MN_FBSNE	1273
+#define	MN_FBST	1271
+#define	MN_FBT	1268
+#define	MN_FBUEQ	1265
+#define	MN_FBUGE	1261
+#define	MN_FBUGT	1263
+#define	MN_FBULE	1257
+#define	MN_FBULT	1259
+#define	MN_FBUN	1267
+#define	MN_FBZ	1242
+#define	MN_FBZE	1242
+#define	MN_FCMP	1274
+#define	MN_FCOS	1276
+#define	MN_FCOSH	1279
+#define	MN_FDABS	1221
+#define	MN_FDADD	1231
+#define	MN_FDBEQ	1282
+#define	MN_FDBF	1310
+#define	MN_FDBGE	1283
+#define	MN_FDBGL	1285
+#define	MN_FDBGLE	1286
+#define	MN_FDBGT	1284
+#define	MN_FDBLE	1287
+#define	MN_FDBLT	1288
+#define	MN_FDBNE	1289
+#define	MN_FDBNGE	1291
+#define	MN_FDBNGL	1292
+#define	MN_FDBNGLE	1295
+#define	MN_FDBNGT	1290
+#define	MN_FDBNLE	1293
+#define	MN_FDBNLT	1294
+#define	MN_FDBNZ	1295
+#define	MN_FDBOGE	1298
+#define	MN_FDBOGL	1304
+#define	MN_FDBOGT	1296
+#define	MN_FDBOLE	1302
+#define	MN_FDBOLT	1300
+#define	MN_FDBOR	1306
+#define	MN_FDBRA	1309
+#define	MN_FDBSEQ	1313
+#define	MN_FDBSF	1311
+#define	MN_FDBSNE	1314
+#define	MN_FDBST	1312
+#define	MN_FDBT	1308
+#define	MN_FDBUEQ	1305
+#define	MN_FDBUGE	1301
+#define	MN_FDBUGT	1303
+#define	MN_FDBULE	1297
+#define	MN_FDBULT	1299
+#define	MN_FDBUN	1307
+#define	MN_FDBZ	1282
+#define	MN_FDBZE	1282
+#define	MN_FDDIV	1321
+#define	MN_FDIV	1315
+#define	MN_FDMOVE	1363
+#define	MN_FDMUL	1370
+#define	MN_FDNEG	1378
+#define	MN_FDSQRT	1436
+#define	MN_FDSUB	1443
+#define	MN_FETOX	1324
+#define	MN_FETOXM1	1327
+#define	MN_FGETEXP	1330
+#define	MN_FGETMAN	1333
+#define	MN_FINT	1336
+#define	MN_FINTRZ	1339
+#define	MN_FLOG10	1342
+#define	MN_FLOG2	1345
+#define	MN_FLOGN	1348
+#define	MN_FLOGNP1	1351
+#define	MN_FMOD	1354
+#define	MN_FMOVE	1357
+#define	MN_FMOVECR	1364
+#define	MN_FMOVEM	1365
+#define	MN_FMUL	1366
+#define	MN_FNEG	1372
+#define	MN_FNOP	1381
+#define	MN_FREM	1382
+#define	MN_FRESTORE	1493
+#define	MN_FSABS	1218
+#define	MN_FSADD	1229
+#define	MN_FSAVE	1494
+#define	MN_FSCALE	1384
+#define	MN_FSDIV	1318
+#define	MN_FSEQ	1386
+#define	MN_FSF	1412
+#define	MN_FSGE	1390
+#define	MN_FSGL	1396
+#define	MN_FSGLDIV	1418
+#define	MN_FSGLE	1398
+#define	MN_FSGLMUL	1420
+#define	MN_FSGT	1388
+#define	MN_FSIN	1422
+#define	MN_FSINCOS	1425
+#define	MN_FSINH	1427
+#define	MN_FSLE	1394
+#define	MN_FSLT	1392
+#define	MN_FSMOVE	1362
+#define	MN_FSMUL	1368
+#define	MN_FSNE	1387
+#define	MN_FSNEG	1375
+#define	MN_FSNGE	1391
+#define	MN_FSNGL	1397
+#define	MN_FSNGLE	1399
+#define	MN_FSNGT	1389
+#define	MN_FSNLE	1395
+#define	MN_FSNLT	1393
+#define	MN_FSOGE	1402
+#define	MN_FSOGL	1408
+#define	MN_FSOGT	1400
+#define	MN_FSOLE	1406
+#define	MN_FSOLT	1404
+#define	MN_FSOR	1410
+#define	MN_FSQRT	1430
+#define	MN_FSSEQ	1416
+#define	MN_FSSF	1414
+#define	MN_FSSNE	1417
+#define	MN_FSSQRT	1433
+#define	MN_FSST	1415
+#define	MN_FSSUB	1441
+#define	MN_FST	1413
+#define	MN_FSUB	1439
+#define	MN_FSUEQ	1409
+#define	MN_FSUGE	1405
+#define	MN_FSUGT	1407
+#define	MN_FSULE	1401
+#define	MN_FSULT	1403
+#define	MN_FSUN	1411
+#define	MN_FSZ	1386
+#define	MN_FSZE	1386
+#define	MN_FTAN	1445
+#define	MN_FTANH	1448
+#define	MN_FTENTOX	1451
+#define	MN_FTRAPEQ	1459
+#define	MN_FTRAPF	1488
+#define	MN_FTRAPGE	1462
+#define	MN_FTRAPGL	1464
+#define	MN_FTRAPGLE	1465
+#define	MN_FTRAPGT	1463
+#define	MN_FTRAPLE	1466
+#define	MN_FTRAPLT	1467
+#define	MN_FTRAPNE	1468
+#define	MN_FTRAPNGE	1470
+#define	MN_FTRAPNGL	1471
+#define	MN_FTRAPNGLE	1474
+#define	MN_FTRAPNGT	1469
+#define	MN_FTRAPNLE	1472
+#define	MN_FTRAPNLT	1473
+#define	MN_FTRAPOGE	1477
+#define	MN_FTRAPOGL	1483
+#define	MN_FTRAPOGT	1475
+#define	MN_FTRAPOLE	1481
+#define	MN_FTRAPOLT	1479
+#define	MN_FTRAPOR	1485
+#define	MN_FTRAPSEQ	1491
+#define	MN_FTRAPSF	1489
+#define	MN_FTRAPSNE	1492
+#define	MN_FTRAPST	1490
+#define	MN_FTRAPT	1487
+#define	MN_FTRAPUEQ	1484
+#define	MN_FTRAPUGE	1480
+#define	MN_FTRAPUGT	1482
+#define	MN_FTRAPULE	1476
+#define	MN_FTRAPULT	1478
+#define	MN_FTRAPUN	1486
+#define	MN_FTRAPZ	1461
+#define	MN_FTRAPZE	1460
+#define	MN_FTST	1454
+#define	MN_FTWOTOX	1456
+#define	MN_GLOBL	24
+#define	MN_GOTO	11
+#define	MN_GPUMAIN	56
+#define	MN_IF	500
+#define	MN_IIF	503
+#define	MN_ILLEGAL	1495
+#define	MN_INCBIN	21
+#define	MN_INCLUDE	33
+#define	MN_INIT	9
+#define	MN_JMP	1496
+#define	MN_JPAD	54
+#define	MN_JSR	1498
+#define	MN_LEA	1500
+#define	MN_LINK	1501
+#define	MN_LIST	38
+#define	MN_LONG	40
+#define	MN_LPSTOP	1502
+#define	MN_LSL	1503
+#define	MN_LSR	1507
+#define	MN_MACRO	504
+#define	MN_MACUNDEF	14
+#define	MN_MOVE	1511
+#define	MN_MOVE16	1526
+#define	MN_MOVEA	1521
+#define	MN_MOVEC	1522
+#define	MN_MOVEM	1528
+#define	MN_MOVEP	1529
+#define	MN_MOVEQ	1531
+#define	MN_MOVES	1524
+#define	MN_MULS	1532
+#define	MN_MULU	1534
+#define	MN_NBCD	1536
+#define	MN_NEG	1537
+#define	MN_NEGX	1538
+#define	MN_NLIST	39
+#define	MN_NOCLEAR	49
+#define	MN_NOFPU	65
+#define	MN_NOJPAD	55
+#define	MN_NOLIST	39
+#define	MN_NOP	1539
+#define	MN_NOT	1540
+#define	MN_OFFSET	7
+#define	MN_OPT	66
+#define	MN_OR	1541
+#define	MN_ORG	0
+#define	MN_ORI	1543
+#define	MN_PACK	1547
+#define	MN_PBAC	1555
+#define	MN_PBAS	1554
+#define	MN_PBBC	1549
+#define	MN_PBBS	1548
+#define	MN_PBCC	1563
+#define	MN_PBCS	1562
+#define	MN_PBGC	1561
+#define	MN_PBGS	1560
+#define	MN_PBIC	1559
+#define	MN_PBIS	1558
+#define	MN_PBLC	1551
+#define	MN_PBLS	1550
+#define	MN_PBSC	1553
+#define	MN_PBSS	1552
+#define	MN_PBWC	1557
+#define	MN_PBWS	1556
+#define	MN_PDBAC	1575
+#define	MN_PDBAS	1567
+#define	MN_PDBBC	1572
+#define	MN_PDBBS	1564
+#define	MN_PDBCC	1579
+#define	MN_PDBCS	1571
+#define	MN_PDBGC	1578
+#define	MN_PDBGS	1570
+#define	MN_PDBIC	1577
+#define	MN_PDBIS	1569
+#define	MN_PDBLC	1573
+#define	MN_PDBLS	1565
+#define	MN_PDBSC	1574
+#define	MN_PDBSS	1566
+#define	MN_PDBWC	1576
+#define	MN_PDBWS	1568
+#define	MN_PEA	1627
+#define	MN_PFLUSH	1580
+#define	MN_PFLUSHA	1583
+#define	MN_PFLUSHAN	1582
+#define	MN_PFLUSHN	1581
+#define	MN_PFLUSHR	1584
+#define	MN_PHRASE	41
+#define	MN_PLOADR	1585
+#define	MN_PLOADW	1586
+#define	MN_PLPA	1587
+#define	MN_PMOVE	1588
+#define	MN_PMOVEFD	1590
+#define	MN_PRESTORE	1591
+#define	MN_PRGFLAGS	57
+#define	MN_PRINT	52
+#define	MN_PSAC	1600
+#define	MN_PSAS	1599
+#define	MN_PSAVE	1592
+#define	MN_PSBC	1594
+#define	MN_PSBS	1593
+#define	MN_PSCC	1608
+#define	MN_PSCS	1607
+#define	MN_PSGC	1605
+#define	MN_PSGS	1606
+#define	MN_PSIC	1604
+#define	MN_PSIS	1603
+#define	MN_PSLC	1596
+#define	MN_PSLS	1595
+#define	MN_PSSC	1598
+#define	MN_PSSS	1597
+#define	MN_PSWC	1602
+#define	MN_PSWS	1601
+#define	MN_PTESTR	1609
+#define	MN_PTESTW	1610
+#define	MN_PTRAPAC	1618
+#define	MN_PTRAPAS	1617
+#define	MN_PTRAPBC	1612
+#define	MN_PTRAPBS	1611
+#define	MN_PTRAPCC	1626
+#define	MN_PTRAPCS	1625
+#define	MN_PTRAPGC	1623
+#define	MN_PTRAPGS	1624
+#define	MN_PTRAPIC	1622
+#define	MN_PTRAPIS	1621
+#define	MN_PTRAPLC	1614
+#define	MN_PTRAPLS	1613
+#define	MN_PTRAPSC	1616
+#define	MN_PTRAPSS	1615
+#define	MN_PTRAPWC	1620
+#define	MN_PTRAPWS	1619
+#define	MN_QPHRASE	43
+#define	MN_REGUNDEF	50
+#define	MN_REPT	506
+#define	MN_RESET	1628
+#define	MN_ROL	1629
+#define	MN_ROR	1633
+#define	MN_ROXL	1637
+#define	MN_ROXR	1641
+#define	MN_RTD	1645
+#define	MN_RTE	1646
+#define	MN_RTM	1647
+#define	MN_RTR	1648
+#define	MN_RTS	1649
+#define	MN_SBCD	1650
+#define	MN_SCC	1652
+#define	MN_SCS	1653
+#define	MN_SEQ	1654
+#define	MN_SF	1655
+#define	MN_SGE	1656
+#define	MN_SGT	1657
+#define	MN_SHI	1658
+#define	MN_SHS	1652
+#define	MN_SLE	1659
+#define	MN_SLO	1653
+#define	MN_SLS	1660
+#define	MN_SLT	1661
+#define	MN_SMI	1662
+#define	MN_SNE	1663
+#define	MN_SNZ	1663
+#define	MN_SPL	1664
+#define	MN_ST	1665
+#define	MN_STOP	1668
+#define	MN_SUB	1669
+#define	MN_SUBA	1671
+#define	MN_SUBI	1672
+#define	MN_SUBQ	1674
+#define	MN_SUBTTL	45
+#define	MN_SUBX	1675
+#define	MN_SVC	1666
+#define	MN_SVS	1667
+#define	MN_SWAP	1677
+#define	MN_SZE	1654
+#define	MN_TAS	1678
+#define	MN_TEXT	6
+#define	MN_TITLE	44
+#define	MN_TRAP	1679
+#define	MN_TRAPCC	1680
+#define	MN_TRAPCS	1682
+#define	MN_TRAPEQ	1684
+#define	MN_TRAPF	1686
+#define	MN_TRAPGE	1688
+#define	MN_TRAPGT	1690
+#define	MN_TRAPHI	1692
+#define	MN_TRAPLE	1694
+#define	MN_TRAPLO	1683
+#define	MN_TRAPLS	1696
+#define	MN_TRAPLT	1698
+#define	MN_TRAPMI	1700
+#define	MN_TRAPNE	1702
+#define	MN_TRAPNZ	1703
+#define	MN_TRAPPL	1704
+#define	MN_TRAPT	1706
+#define	MN_TRAPV	1712
+#define	MN_TRAPVC	1708
+#define	MN_TRAPVS	1710
+#define	MN_TRAPZE	1685
+#define	MN_TST	1713
+#define	MN_UNDEFMAC	14
+#define	MN_UNLK	1715
+#define	MN_UNPK	1716
+#define	MN_WARN	48
+#endif
+
+#ifdef DECL_MN
+/*
+ *  keyword state-machine tables
+ *
+ */
+
+int mnbase[844] = {
+ 0, 23, 43, 47, 67, 86, 82, 107,
+ 62, 122, 116, 128, 70, 136, 97, 148,
+ 6, 125, 167, 177, 15, 7, 0, 0,
+ 182, 12, 196, 197, 207, 143, 42, 18,
+ 75, 10, 86, 220, 184, 33, 59, 51,
+ 203, 67, 92, 114, 114, 118, 145, 220,
+ 106, 237, 119, 201, 126, 229, 137, 204,
+ 150, 164, 232, 152, 188, 171, 235, 156,
+ 174, 189, 187, 198, 214, 256, 213, 215,
+ 273, 239, 233, 237, 246, 248, 257, 244,
+ 263, 247, 245, 250, 264, 263, 294, 297,
+ 258, 318, 262, 279, 274, 275, 279, 319,
+ 287, 335, 352, 286, 285, 285, 301, 296,
+ 326, 294, 320, 307, 325, 314, 316, 324,
+ 333, 343, 336, 347, 357, 355, 354, 362,
+ 358, 346, 360, 370, 378, 374, 376, 371,
+ 366, 373, 371, 386, 397, 387, 386, 395,
+ 395, 413, 393, 405, 386, 405, 403, 418,
+ 406, 416, 415, 413, 427, 427, 433, 430,
+ 417, 415, 420, 440, 423, 440, 427, 0,
+ 1, 2, 428, 439, 430, 431, 433, 432,
+ 441, 435, 437, 456, 440, 452, 448, 449,
+ 458, 446, 465, 446, 450, 465, 462, 457,
+ 453, 453, 469, 474, 475, 459, 465, 477,
+ 472, 481, 475, 480, 468, 482, 472, 485,
+ 487, 489, 495, 496, 475, 480, 497, 484,
+ 499, 503, 497, 502, 501, 491, 502, 487,
+ 507, 501, 511, 498, 498, 499, 501, 510,
+ 516, 1, 510, 2, 503, 572, 515, 524,
+ 530, 528, 545, 515, 517, 536, 537, 524,
+ 546, 540, 550, 544, 553, 548, 560, 559,
+ 558, 566, 553, 553, 559, 573, 572, 578,
+ 579, 574, 566, 571, 573, 569, 588, 572,
+ 579, 591, 587, 597, 582, 595, 596, 597,
+ 596, 604, 605, 615, 601, 596, 594, 622,
+ 625, 608, 596, 613, 616, 621, 618, 615,
+ 616, 634, 643, 636, 642, 634, 639, 651,
+ 653, 647, 640, 654, 646, 656, 647, 665,
+ 657, 645, 673, 684, 662, 657, 666, 680,
+ 662, 668, 682, 670, 675, 687, 693, 677,
+ 695, 689, 681, 695, 683, 686, 701, 689,
+ 705, 687, 693, 701, 698, 699, 707, 698,
+ 707, 716, 717, 718, 719, 720, 721, 722,
+ 723, 742, 706, 727, 728, 729, 709, 713,
+ 727, 720, 744, 743, 745, 749, 750, 752,
+ 753, 754, 731, 757, 741, 739, 747, 765,
+ 762, 771, 760, 776, 762, 759, 769, 766,
+ 778, 773, 775, 773, 7, 7, 11, 4,
+ 781, 784, 783, 777, 779, 776, 794, 796,
+ 780, 783, 798, 797, 801, 801, 787, 791,
+ 793, 788, 804, 809, 797, 800, 813, 796,
+ 813, 798, 813, 803, 803, 811, 810, 811,
+ 819, 813, 811, 830, 826, 819, 816, 833,
+ 816, 817, 826, 819, 828, 836, 828, 825,
+ 837, 827, 826, 832, 829, 829, 830, 838,
+ 833, 849, 854, 839, 852, 853, 855, 856,
+ 858, 870, 873, 856, 886, 846, 880, 876,
+ 891, 894, 900, 905, 906, 908, 861, 850,
+ 875, 870, 874, 887, 869, 884, 908, 894,
+ 898, 904, 900, 901, 907, 908, 918, 921,
+ 923, 924, 925, 914, 927, 917, 930, 932,
+ 930, 920, 936, 925, 941, 942, 944, 947,
+ 947, 952, 962, 950, 938, 941, 952, 961,
+ 953, 971, 951, 972, 960, 1026, 976, 962,
+ 964, 980, 981, 975, 966, 985, 988, 970,
+ 981, 987, 990, 992, 994, 995, 981, 986,
+ 999, 987, 1005, 991, 1004, 1006, 1005, 996,
+ 1001, 998, 1007, 1019, 1014, 1013, 1002, 1010,
+ 1012, 1014, 1076, 1010, 1026, 1011, 1032, 1015,
+ 1030, 1033, 1034, 1035, 1036, 1038, 1039, 1040,
+ 1041, 1026, 1027, 1043, 1043, 1029, 1038, 1031,
+ 1051, 1041, 1046, 1062, 1050, 1045, 1046, 1062,
+ 1068, 1062, 15, 18, 19, 20, 21, 22,
+ 22, 1055, 1052, 1053, 1074, 1062, 1083, 1085,
+ 1067, 1079, 1090, 1076, 1080, 1086, 1082, 1089,
+ 1101, 1094, 1083, 1090, 1092, 1087, 1103, 1088,
+ 1109, 1092, 1094, 1108, 1095, 1103, 1096, 1116,
+ 1117, 1105, 1100, 1116, 1117, 1117, 1104, 1106,
+ 1121, 1123, 1124, 1125, 1126, 1127, 1116, 1129,
+ 1118, 1132, 1134, 1123, 1136, 1137, 1138, 1148,
+ 1148, 1153, 1156, 1146, 1133, 1157, 1164, 1166,
+ 1159, 1153, 1169, 1161, 1163, 1170, 1174, 1176,
+ 1177, 1178, 1179, 1180, 1169, 1182, 1171, 1185,
+ 1187, 1188, 1174, 1182, 1172, 1200, 1176, 25,
+ 1187, 1201, 1191, 1203, 1200, 1189, 1196, 1207,
+ 1208, 1195, 1201, 1212, 1205, 1212, 1221, 1209,
+ 1221, 1212, 1225, 20, 1229, 1230, 1215, 1216,
+ 1229, 1234, 1222, 1235, 1227, 1242, 1226, 1245,
+ 1231, 1247, 1241, 1252, 1239, 1253, 1250, 1255,
+ 1252, 1257, 1251, 1262, 1261, 1254, 1249, 1267,
+ 1273, 1265, 1259, 1274, 1266, 1268, 1275, 1271,
+ 1282, 1283, 1287, 1285, 1270, 1276, 1272, 1288,
+ 1293, 1276, 1282, 1293, 1286, 1286, 1294, 1296,
+ 1297, 1298, 1299, 1300, 1301, 1290, 1303, 1292,
+ 1306, 1308, 1299, 1295, 1311, 1312, 1315, 1317,
+ 26, 1307, 1310, 29, 1307, 1309, 1307, 1318,
+ 1312, 1308, 1316, 1329, 1330, 1331, 1330, 1339,
+ 1349, 1334, 1316, 1332, 1335, 1346, 1347, 1337,
+ 1356, 1354, 1342, 1355, 1361, 1362, 1363, 1364,
+ 1365, 1366, 1368, 1369, 1368, 1370, 1375, 1371,
+ 1358, 1374, 1381, 1385, 1376, 1386, 1387, 1375,
+ 1391, 1388, 1391, 1386, 1393, 1398, 1395, 1383,
+ 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1392,
+ 1405, 1394, 1408, 1410, 1410, 1403, 1413, 1400,
+ 1418, 1422, 1421, 1421, 1410, 31, 1425, 1429,
+ 1428, 1428, 1430, 1430
+};
+
+int mntab[1558] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, 1, -1,
+ 380, 381, 382, -2, -2, 160, 159, 578,
+ 161, -2, 383, 579, 584, 580, 581, 582,
+ -2, 583, -2, -2, -2, -2, -2, -2,
+ -2, -2, -2, -2, 22, 23, -2, -2,
+ -2, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 2, 3, 4, 5, 6, 7, 8,
+ 158, 9, 10, 191, 11, 12, 13, 14,
+ 15, 16, 17, 18, 19, 20, 134, 21,
+ 24, 25, 26, 27, 28, 157, 29, 165,
+ 30, 31, 188, 32, 33, 34, 35, 36,
+ 37, 38, 39, 40, 41, 43, 42, 44,
+ -2, 200, 47, 186, 48, 49, 50, 51,
+ 187, 45, 52, 53, 54, 55, 46, 56,
+ 201, 57, 58, 59, 62, 60, 63, 113,
+ 202, 61, 99, 64, 65, 100, 101, 66,
+ 67, 206, 68, 69, 189, 114, 70, 71,
+ 72, 73, 190, 115, 78, 207, 79, 74,
+ 80, 81, 192, 82, 83, 193, 75, 120,
+ 84, 76, 85, 77, 86, 87, 88, 89,
+ 90, 121, 91, 122, 92, 208, 209, 93,
+ 94, 95, 210, -2, -2, 96, 97, 98,
+ -2, 105, 135, 102, 106, 108, 103, 107,
+ 104, 109, 116, -2, 136, 117, 220, 110,
+ 111, 137, -2, 112, 118, 123, 124, 119,
+ 125, 126, 127, 183, 128, -2, 184, 185,
+ 129, 130, -2, -2, 211, -2, 131, 132,
+ 133, 138, 139, 222, 140, -2, 141, 142,
+ -2, 226, 152, 143, 144, 145, 153, 146,
+ 162, 227, 154, 147, 148, 149, 150, -2,
+ 198, 151, 163, 155, 156, 166, 170, 167,
+ 171, 164, 199, 228, 203, -2, 172, -2,
+ 204, -2, -2, 168, 205, 173, 229, 169,
+ 174, 176, 175, 177, -2, 178, 194, -2,
+ 179, 180, 195, 230, 212, 181, -2, 182,
+ 213, 236, -2, 237, 196, 221, 197, -2,
+ 214, -2, 215, 216, -2, 251, 217, 223,
+ -2, -2, -2, -2, 249, 224, 225, 250,
+ 218, 219, 231, -2, 232, 252, 253, 254,
+ 255, 257, 258, 256, 259, 260, -2, 277,
+ 261, 278, 233, 234, 238, 235, 239, -2,
+ 240, 241, 286, 262, 287, 242, 243, 244,
+ 288, 245, 289, 246, 294, -2, 290, 247,
+ 263, 264, 265, 248, 291, 314, 268, -2,
+ 269, 315, 316, -2, 317, 270, -2, 271,
+ 272, 266, 267, 273, 274, -2, 275, 279,
+ 280, 320, 281, 276, 292, -2, -2, 282,
+ 321, 318, 323, 283, 284, 322, 293, 319,
+ 295, 285, 296, 297, 298, -2, 299, 324,
+ 300, -2, 325, 301, 302, 303, 304, -2,
+ 305, 309, 306, -2, 307, 310, 326, 327,
+ 328, 308, 329, 330, 335, 331, -2, -2,
+ 332, -2, 311, 312, 333, 336, 334, 313,
+ 345, -2, -2, 337, 338, 339, -2, 346,
+ 347, 340, 350, 341, 348, 349, 342, 351,
+ 362, 352, 364, 353, 369, 343, 354, 355,
+ 356, 344, 365, -2, 357, 363, 358, -2,
+ -2, 359, -2, 366, -2, -2, 367, -2,
+ 360, -2, -2, 368, 361, -2, -2, -2,
+ -2, -2, -2, -2, 370, 371, -2, -2,
+ -2, -2, 372, -2, -2, -2, -2, 373,
+ 374, 375, -2, -2, 376, 379, -2, -2,
+ 384, 385, -2, 386, 377, 387, 388, 389,
+ 378, 390, -2, 391, 392, -2, 393, 394,
+ -2, 395, 396, 398, 399, 397, 400, 401,
+ 403, 404, 405, -2, 408, 406, 409, 410,
+ 411, 412, 402, 407, 413, 417, 418, 414,
+ -2, -2, 419, 415, 420, 416, 421, 422,
+ 423, 425, 426, 427, 428, 429, 430, -2,
+ -2, 424, -2, 431, -2, -2, 432, 434,
+ -2, 435, 433, 436, 437, 438, -2, -2,
+ -2, -2, 439, 440, 441, 442, -2, -2,
+ -2, 443, -2, 444, 452, 453, 462, 463,
+ 445, -2, 446, 447, -2, -2, 448, 449,
+ -2, 450, 454, 455, 456, -2, 451, -2,
+ 457, -2, 458, -2, -2, 459, -2, -2,
+ -2, -2, -2, -2, 460, -2, -2, 464,
+ 461, -2, -2, 467, 465, -2, 466, -2,
+ 468, -2, -2, -2, 469, -2, -2, -2,
+ 471, -2, 472, -2, 470, 473, -2, -2,
+ -2, 474, 475, -2, 476, -2, 477, -2,
+ -2, -2, -2, 481, 479, -2, -2, 478,
+ 482, 480, 483, -2, -2, 488, -2, -2,
+ -2, 500, -2, 484, 485, 503, 486, -2,
+ 489, -2, 490, 487, 501, -2, 491, -2,
+ 492, 506, 502, 507, 508, 493, 504, 494,
+ 495, 509, 505, 496, 497, -2, 498, -2,
+ -2, -2, -2, 499, -2, 512, 515, 513,
+ 516, -2, 511, -2, 518, -2, 519, 526,
+ 524, 510, 517, -2, 520, 525, 521, 534,
+ 522, 514, -2, -2, -2, 523, 527, -2,
+ 535, 536, -2, 537, 538, -2, -2, 528,
+ 539, 531, 529, 532, 540, -2, 530, 541,
+ 533, -2, -2, -2, -2, -2, -2, 543,
+ 544, 542, 546, 545, -2, -2, -2, -2,
+ 547, 548, 549, 550, 551, 552, -2, -2,
+ -2, -2, -2, -2, -2, -2, -2, 561,
+ 562, 563, -2, 564, 565, 566, 567, -2,
+ -2, -2, -2, -2, -2, -2, -2, 553,
+ 554, 555, -2, -2, -2, 556, 569, 557,
+ -2, -2, 558, -2, -2, -2, 570, 571,
+ 572, 559, -2, -2, -2, 560, 568, -2,
+ -2, -2, 573, -2, -2, -2, -2, -2,
+ -2, -2, -2, -2, -2, 575, 576, 577,
+ -2, -2, -2, -2, 585, 586, 587, 588,
+ -2, -2, 589, -2, 574, 590, 591, -2,
+ -2, 592, -2, 593, -2, 595, 596, -2,
+ 597, 598, 594, 599, -2, 600, -2, 601,
+ -2, -2, -2, -2, -2, 603, 605, 606,
+ 604, 602, 607, 608, 609, 610, 611, 612,
+ 613, 614, 615, 616, -2, 618, 619, -2,
+ 620, 621, -2, 622, -2, -2, 623, -2,
+ -2, -2, -2, -2, -2, 624, 617, -2,
+ -2, -2, -2, -2, -2, -2, 626, 628,
+ 625, 644, -2, 627, 629, 646, -2, 647,
+ -2, -2, -2, 630, -2, 648, 632, -2,
+ 633, -2, -2, -2, 631, 634, -2, -2,
+ 649, -2, -2, 635, -2, 636, -2, -2,
+ 650, -2, 637, -2, 638, 639, 645, -2,
+ 640, 641, -2, 642, -2, -2, -2, -2,
+ 643, -2, -2, 651, -2, -2, 652, -2,
+ -2, -2, 653, -2, -2, -2, -2, -2,
+ -2, -2, -2, -2, -2, 654, -2, -2,
+ -2, -2, -2, -2, -2, -2, -2, -2,
+ -2, -2, -2, -2, -2, -2, -2, 656,
+ -2, 655, 658, -2, 657, 660, -2, 659,
+ -2, -2, -2, 665, -2, -2, 661, 662,
+ -2, 663, -2, 666, -2, -2, 664, 667,
+ -2, 668, 670, 671, -2, 673, 674, -2,
+ -2, 669, -2, 675, -2, 676, -2, 678,
+ 679, -2, -2, -2, -2, -2, 677, -2,
+ -2, -2, 680, -2, -2, 681, -2, -2,
+ -2, -2, -2, -2, -2, -2, -2, -2,
+ 682, 683, 684, -2, 685, 686, 687, 688,
+ -2, 689, -2, -2, 690, 691, -2, 692,
+ -2, 693, 694, 695, -2, -2, -2, -2,
+ 672, -2, -2, -2, -2, 696, 697, 698,
+ 699, 700, 701, -2, -2, -2, -2, -2,
+ -2, -2, -2, -2, -2, 702, 703, 704,
+ 705, -2, 706, -2, 717, -2, 718, 707,
+ -2, 708, -2, 709, 710, -2, 719, -2,
+ 711, 712, 713, 720, 714, 721, 722, -2,
+ -2, -2, 715, 723, -2, -2, 716, -2,
+ -2, 724, -2, -2, 725, -2, 726, 727,
+ 728, -2, 729, -2, 730, -2, 731, 732,
+ 733, 734, 735, 736, -2, 737, 738, 739,
+ 740, -2, -2, 741, -2, -2, 742, -2,
+ -2, -2, -2, -2, -2, -2, -2, -2,
+ 743, -2, -2, -2, -2, -2, -2, -2,
+ -2, 745, -2, -2, 744, -2, 746, -2,
+ -2, 754, -2, 747, -2, -2, 749, -2,
+ 748, 751, -2, 752, -2, -2, -2, 750,
+ 753, 755, -2, 756, 757, -2, -2, 758,
+ -2, -2, -2, -2, -2, -2, -2, -2,
+ -2, -2, -2, -2, -2, 759, -2, -2,
+ -2, -2, -2, 760, 761, -2, -2, -2,
+ -2, 762, -2, 763, 764, -2, 765, -2,
+ -2, 766, 767, 768, -2, -2, -2, -2,
+ 769, 770, -2, 771, 778, 779, 780, -2,
+ 772, 781, 773, 774, -2, 782, 783, 775,
+ -2, 776, -2, -2, -2, 784, 777, -2,
+ -2, 785, 786, 787, -2, -2, 788, 789,
+ 790, -2, 796, 797, 791, -2, 792, -2,
+ -2, 793, -2, -2, -2, -2, -2, -2,
+ 794, -2, -2, 798, 795, -2, -2, -2,
+ 799, -2, -2, -2, 800, 801, 802, -2,
+ 803, -2, -2, -2, 804, -2, 805, 806,
+ 807, -2, -2, 808, -2, -2, 809, 810,
+ 811, 812, -2, 813, -2, -2, -2, -2,
+ -2, -2, -2, -2, -2, -2, 814, -2,
+ -2, -2, 815, -2, -2, -2, -2, 816,
+ -2, -2, -2, -2, -2, -2, -2, 817,
+ -2, -2, -2, -2, -2, -2, -2, -2,
+ -2, 821, 819, -2, -2, 818, 822, 820,
+ 823, -2, -2, -2, -2, -2, -2, -2,
+ 828, 824, 825, -2, 826, 829, -2, -2,
+ 830, 827, 831, -2, -2, -2, -2, -2,
+ -2, -2, -2, -2, -2, -2, -2, 832,
+ 833, -2, -2, -2, -2, -2, -2, -2,
+ -2, -2, -2, -2, -2, 834, -2, -2,
+ 835, -2, -2, 836, -2, 837, 838, 839,
+ -2, 840, 841, -2, -2, -2, -2, -2,
+ -2, -2, -2, -2, 842, -2, -2, -2,
+ -2, -2, -2, -2, -2, -2, -2, -2,
+ -2, -2, 843, -2, -2, -2, -2, -2,
+ -2, -2, -2, -2, -2, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1
+};
+
+int mncheck[1558] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, 0, -1,
+ 159, 160, 161, 225, 227, 23, 22, 380,
+ 23, 381, 161, 382, 383, 382, 382, 382,
+ 578, 382, 579, 580, 581, 582, 583, 584,
+ 584, 671, 691, 760, 1, 1, 763, 837,
+ 837, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 0, 0, 0, 0, 0, 0, 0,
+ 21, 0, 0, 33, 0, 0, 0, 0,
+ 0, 0, 0, 0, 0, 0, 16, 0,
+ 1, 1, 1, 1, 1, 20, 1, 25,
+ 1, 1, 31, 1, 1, 1, 1, 1,
+ 1, 1, 1, 1, 1, 2, 1, 2,
+ 30, 37, 3, 30, 3, 3, 3, 3,
+ 30, 2, 3, 3, 3, 3, 2, 3,
+ 38, 3, 3, 3, 4, 3, 4, 12,
+ 39, 3, 8, 4, 4, 8, 8, 4,
+ 4, 41, 4, 4, 32, 12, 4, 5,
+ 5, 5, 32, 12, 6, 42, 6, 5,
+ 6, 6, 34, 6, 6, 34, 5, 14,
+ 6, 5, 6, 5, 7, 7, 7, 7,
+ 7, 14, 7, 14, 7, 43, 44, 7,
+ 7, 7, 45, 48, 50, 7, 7, 7,
+ 9, 10, 17, 9, 10, 11, 9, 10,
+ 9, 11, 13, 50, 17, 13, 52, 11,
+ 11, 17, 54, 11, 13, 15, 15, 13,
+ 15, 15, 15, 29, 15, 46, 29, 29,
+ 15, 15, 56, 46, 46, 57, 15, 15,
+ 15, 18, 18, 59, 18, 18, 18, 18,
+ 61, 63, 19, 18, 18, 18, 19, 18,
+ 24, 64, 19, 18, 18, 18, 18, 60,
+ 36, 18, 24, 19, 19, 26, 27, 26,
+ 27, 24, 36, 65, 40, 66, 27, 60,
+ 40, 55, 51, 26, 40, 27, 67, 26,
+ 27, 28, 27, 28, 51, 28, 35, 47,
+ 28, 28, 35, 68, 47, 28, 55, 28,
+ 47, 70, 53, 71, 35, 58, 35, 47,
+ 49, 73, 49, 49, 53, 75, 49, 62,
+ 53, 53, 58, 58, 74, 62, 62, 74,
+ 49, 49, 69, 76, 69, 77, 78, 79,
+ 80, 81, 82, 80, 83, 84, 85, 88,
+ 85, 88, 69, 69, 72, 69, 72, 72,
+ 72, 72, 90, 85, 91, 72, 72, 72,
+ 92, 72, 93, 72, 96, 72, 94, 72,
+ 86, 86, 86, 72, 94, 99, 87, 87,
+ 87, 100, 101, 102, 103, 87, 105, 87,
+ 87, 86, 86, 87, 87, 87, 87, 89,
+ 89, 106, 89, 87, 95, 107, 108, 89,
+ 109, 104, 110, 89, 89, 109, 95, 104,
+ 97, 89, 97, 97, 97, 97, 97, 111,
+ 97, 112, 113, 97, 97, 97, 97, 112,
+ 97, 98, 97, 97, 97, 98, 114, 115,
+ 116, 97, 117, 118, 120, 119, 121, 122,
+ 119, 122, 98, 98, 119, 123, 119, 98,
+ 125, 126, 119, 124, 124, 124, 119, 127,
+ 128, 124, 130, 124, 129, 129, 124, 131,
+ 133, 131, 134, 131, 138, 124, 132, 132,
+ 132, 124, 135, 140, 132, 133, 132, 136,
+ 139, 132, 141, 135, 142, 136, 135, 144,
+ 132, 137, 137, 136, 132, 145, 142, 143,
+ 139, 141, 137, 146, 147, 148, 149, 137,
+ 137, 143, 150, 151, 152, 143, 143, 153,
+ 154, 155, 145, 156, 157, 158, 149, 162,
+ 163, 164, 165, 166, 157, 167, 168, 169,
+ 157, 170, 171, 172, 173, 174, 175, 176,
+ 174, 177, 178, 179, 180, 178, 181, 182,
+ 183, 184, 185, 186, 188, 187, 189, 190,
+ 191, 192, 182, 187, 193, 194, 195, 193,
+ 196, 197, 198, 193, 199, 193, 199, 200,
+ 201, 202, 203, 204, 205, 206, 207, 208,
+ 209, 201, 210, 211, 212, 213, 214, 215,
+ 209, 216, 214, 217, 218, 219, 220, 221,
+ 209, 222, 223, 224, 226, 228, 229, 209,
+ 230, 231, 231, 231, 232, 233, 235, 236,
+ 231, 237, 231, 231, 238, 239, 231, 231,
+ 231, 231, 234, 234, 234, 241, 231, 240,
+ 234, 243, 234, 242, 238, 234, 244, 241,
+ 245, 246, 247, 248, 234, 242, 240, 249,
+ 234, 242, 242, 251, 250, 229, 250, 252,
+ 253, 254, 247, 244, 255, 229, 256, 257,
+ 258, 229, 259, 260, 256, 261, 262, 263,
+ 256, 262, 264, 265, 266, 256, 267, 268,
+ 269, 270, 271, 272, 271, 273, 276, 269,
+ 272, 271, 274, 274, 277, 278, 272, 269,
+ 270, 281, 282, 274, 275, 284, 275, 271,
+ 279, 274, 279, 275, 283, 275, 280, 280,
+ 280, 286, 283, 287, 288, 280, 285, 280,
+ 280, 289, 285, 280, 280, 280, 280, 290,
+ 291, 292, 293, 280, 294, 295, 296, 295,
+ 297, 298, 294, 299, 300, 301, 302, 305,
+ 304, 290, 299, 308, 302, 304, 303, 309,
+ 303, 295, 299, 304, 301, 303, 306, 306,
+ 310, 311, 312, 313, 314, 315, 307, 306,
+ 316, 307, 306, 307, 317, 306, 306, 318,
+ 307, 319, 307, 320, 321, 322, 323, 324,
+ 325, 318, 326, 325, 327, 328, 327, 329,
+ 330, 331, 332, 333, 334, 335, 336, 337,
+ 338, 339, 340, 341, 342, 343, 344, 346,
+ 347, 348, 349, 350, 351, 352, 353, 337,
+ 338, 339, 340, 341, 342, 343, 344, 345,
+ 345, 345, 355, 354, 356, 345, 362, 345,
+ 357, 358, 345, 359, 360, 361, 363, 364,
+ 365, 345, 355, 354, 356, 345, 354, 366,
+ 357, 358, 367, 359, 360, 361, 368, 369,
+ 370, 371, 372, 373, 368, 374, 375, 376,
+ 377, 371, 378, 379, 384, 385, 386, 387,
+ 388, 371, 389, 390, 371, 391, 392, 393,
+ 371, 394, 395, 396, 397, 398, 399, 400,
+ 401, 402, 397, 403, 404, 405, 397, 406,
+ 407, 408, 409, 397, 410, 411, 412, 413,
+ 411, 406, 414, 415, 416, 417, 418, 419,
+ 420, 421, 422, 423, 424, 425, 426, 427,
+ 428, 429, 430, 431, 432, 433, 434, 435,
+ 436, 437, 438, 439, 440, 441, 423, 442,
+ 443, 444, 445, 448, 446, 451, 446, 447,
+ 444, 453, 442, 446, 447, 462, 442, 463,
+ 444, 445, 447, 449, 449, 464, 450, 455,
+ 450, 446, 465, 454, 449, 450, 466, 450,
+ 467, 468, 449, 452, 452, 452, 456, 455,
+ 469, 457, 452, 454, 452, 452, 454, 458,
+ 452, 452, 452, 452, 459, 460, 456, 461,
+ 452, 457, 470, 471, 472, 473, 474, 458,
+ 475, 476, 477, 478, 459, 460, 479, 461,
+ 480, 481, 482, 483, 484, 479, 485, 486,
+ 481, 487, 488, 489, 490, 479, 491, 480,
+ 481, 482, 492, 493, 496, 494, 486, 494,
+ 487, 492, 495, 499, 494, 497, 497, 495,
+ 500, 492, 493, 501, 502, 495, 497, 498,
+ 503, 498, 494, 504, 497, 505, 498, 506,
+ 498, 507, 508, 509, 509, 510, 511, 512,
+ 513, 507, 514, 515, 516, 517, 517, 518,
+ 519, 520, 521, 522, 518, 523, 517, 524,
+ 525, 526, 522, 527, 528, 529, 524, 530,
+ 531, 532, 522, 533, 523, 534, 524, 525,
+ 535, 536, 537, 538, 539, 540, 541, 542,
+ 532, 543, 533, 544, 545, 546, 547, 548,
+ 549, 550, 551, 552, 553, 554, 555, 556,
+ 509, 557, 558, 559, 560, 561, 562, 563,
+ 564, 565, 566, 567, 553, 554, 555, 556,
+ 568, 557, 558, 559, 560, 569, 570, 571,
+ 572, 573, 574, 575, 577, 585, 586, 576,
+ 587, 576, 576, 576, 576, 546, 588, 546,
+ 576, 576, 576, 589, 576, 590, 591, 592,
+ 576, 546, 576, 593, 546, 546, 576, 546,
+ 594, 595, 596, 597, 598, 599, 600, 601,
+ 602, 603, 604, 605, 606, 607, 608, 609,
+ 610, 611, 612, 613, 614, 615, 616, 617,
+ 618, 619, 620, 621, 622, 623, 624, 623,
+ 625, 626, 627, 628, 629, 630, 631, 632,
+ 626, 633, 628, 634, 635, 636, 637, 638,
+ 626, 638, 628, 629, 636, 640, 638, 643,
+ 633, 644, 634, 639, 636, 637, 641, 641,
+ 639, 642, 645, 642, 638, 646, 639, 641,
+ 642, 647, 642, 648, 649, 641, 650, 651,
+ 646, 652, 653, 654, 646, 655, 656, 657,
+ 658, 659, 660, 661, 662, 656, 663, 658,
+ 664, 665, 666, 667, 668, 656, 657, 658,
+ 659, 669, 670, 672, 673, 663, 674, 664,
+ 675, 676, 677, 678, 679, 680, 673, 681,
+ 682, 683, 683, 683, 684, 685, 686, 687,
+ 683, 688, 683, 683, 689, 690, 692, 683,
+ 683, 683, 693, 694, 695, 696, 683, 697,
+ 698, 699, 700, 701, 702, 698, 703, 703,
+ 703, 702, 704, 705, 703, 706, 703, 707,
+ 708, 703, 709, 710, 711, 712, 713, 714,
+ 703, 715, 716, 717, 703, 718, 711, 707,
+ 719, 709, 711, 711, 720, 721, 722, 723,
+ 724, 715, 725, 713, 726, 727, 728, 729,
+ 730, 731, 732, 733, 734, 735, 736, 737,
+ 738, 739, 740, 741, 742, 743, 744, 745,
+ 746, 747, 748, 749, 750, 751, 745, 752,
+ 747, 753, 754, 755, 756, 757, 745, 758,
+ 747, 748, 759, 761, 762, 764, 752, 765,
+ 753, 766, 767, 768, 769, 770, 771, 772,
+ 773, 774, 773, 777, 778, 771, 774, 773,
+ 775, 775, 779, 780, 774, 771, 772, 781,
+ 782, 775, 776, 783, 776, 784, 785, 775,
+ 786, 776, 787, 776, 788, 789, 790, 791,
+ 792, 793, 784, 794, 795, 796, 784, 797,
+ 798, 799, 800, 801, 788, 789, 790, 791,
+ 792, 793, 802, 794, 795, 803, 804, 805,
+ 806, 807, 808, 809, 810, 811, 812, 813,
+ 814, 815, 816, 817, 818, 819, 820, 821,
+ 822, 823, 824, 825, 819, 826, 821, 827,
+ 828, 829, 830, 831, 819, 820, 821, 822,
+ 832, 833, 834, 835, 826, 836, 827, 838,
+ 839, 840, 841, 842, 843, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1
+};
+
+int mnaccept[1558] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, 1084, 1090, -1, -1, -1,
+ -1, 2, -1, -1, -1, -1, -1, -1,
+ 64, -1, 3, 58, 59, 60, 61, 62,
+ 63, 1342, 1526, 1327, -1, -1, 1351, 25,
+ 26, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ 500, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, 1071, -1, -1, -1, -1,
+ -1, 1029, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 12, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 13, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, 1541, -1, -1, 1003, -1,
+ -1, -1, 1011, 1029, 1031, -1, -1, -1,
+ 500, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, 1033, -1, -1, -1, -1,
+ -1, -1, 1043, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, 1017, -1, -1,
+ -1, -1, 1047, 1021, -1, 1070, -1, -1,
+ -1, -1, -1, -1, -1, 1655, -1, -1,
+ 1029, -1, -1, -1, -1, -1, -1, -1,
+ -1, 1085, -1, 1665, -1, -1, -1, 1049,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ 12, -1, -1, -1, -1, 1091, -1, 1051,
+ -1, 1045, 1035, -1, -1, -1, 1094, -1,
+ 13, -1, -1, -1, 1025, -1, -1, 1025,
+ -1, -1, -1, -1, -1, -1, 1045, -1,
+ -1, -1, 1037, -1, -1, -1, -1, 1027,
+ -1, 17, -1, -1, 1027, -1, -1, -1,
+ 1039, 1041, 1076, 4, -1, -1, 1083, -1,
+ -1, -1, -1, 68, -1, -1, -1, -1,
+ -1, 1206, 18, 34, -1, -1, 1211, -1,
+ -1, -1, -1, -1, -1, -1, -1, 1187,
+ -1, -1, -1, 1212, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, 1197, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, 1269,
+ -1, -1, -1, 503, -1, -1, 1496, -1,
+ -1, -1, -1, -1, -1, 1268, -1, -1,
+ -1, -1, -1, 1242, -1, 1498, 1500, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, 1412, -1, -1,
+ -1, 1503, -1, -1, -1, -1, -1, 1507,
+ -1, -1, -1, 1413, -1, -1, -1, -1,
+ -1, 1386, 1537, -1, -1, -1, 66, 0,
+ -1, 1543, -1, -1, -1, -1, -1, -1,
+ -1, 1627, 1539, -1, -1, -1, 1540, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, 1654, -1, -1, -1, 1629,
+ 1652, -1, 1656, -1, 1658, 1633, -1, 1662,
+ -1, 1645, 1646, -1, -1, 1663, 1652, 1659,
+ 1653, 1657, 1647, 1664, -1, 1669, 1666, 1648,
+ 1649, 1653, -1, 1654, 1678, 1660, 1661, -1,
+ -1, -1, 1663, 1713, -1, -1, 1667, 7,
+ -1, -1, 4, -1, -1, -1, -1, -1,
+ -1, -1, 17, -1, -1, 68, -1, -1,
+ 16, -1, -1, 18, -1, 34, -1, -1,
+ -1, -1, 15, 503, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ 66, 0, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, 1001,
+ 1005, -1, 1013, -1, 1053, 1057, -1, -1,
+ 1006, -1, -1, -1, -1, -1, 1069, 1072,
+ 1008, 1078, -1, -1, -1, -1, 1100, 1009,
+ 8, -1, 1127, -1, -1, -1, -1, -1,
+ -1, 5, -1, -1, 1184, 1186, -1, -1,
+ 1126, -1, -1, -1, -1, 1190, 1101, 1188,
+ -1, 1194, -1, 1191, 1185, -1, 1195, 1190,
+ 1196, 1187, 1198, 1186, -1, 1185, 1189, -1,
+ -1, 1192, 1193, -1, 1200, 1096, 1203, 20,
+ -1, 501, 1199, 1195, -1, 1097, 502, 1207,
+ -1, 1099, -1, 1, -1, -1, 1214, 1215,
+ 505, -1, -1, 1227, -1, 507, -1, 1242,
+ 1243, 1247, 1249, -1, -1, 1268, 1242, 1245,
+ -1, -1, -1, 1270, 1274, 1276, 1266, 1244,
+ 1248, -1, 1315, -1, -1, -1, -1, 1255,
+ -1, 1271, -1, -1, -1, 1267, -1, 1310,
+ -1, -1, -1, -1, 1336, -1, -1, -1,
+ -1, -1, -1, -1, -1, 1308, -1, 1354,
+ 1366, 1372, 1381, 1282, 1382, -1, -1, -1,
+ -1, 1386, -1, 1390, 1422, 1394, -1, -1,
+ -1, -1, 1396, 1386, -1, -1, 1387, 1445,
+ -1, -1, 1388, 1410, 1392, -1, -1, 1414,
+ -1, -1, 1454, -1, -1, 11, 1439, -1,
+ -1, -1, -1, -1, -1, 1415, -1, -1,
+ -1, 9, 1411, 54, 1501, 38, 40, -1,
+ -1, -1, 1511, -1, 1532, 1536, 1534, 1538,
+ -1, -1, -1, -1, -1, -1, 1547, 1555,
+ 1549, 1563, 1561, 1559, 1551, 1553, 1557, -1,
+ -1, -1, 1587, -1, -1, -1, -1, 1554,
+ 1548, 1562, 1560, 1558, 1550, 1552, 1556, -1,
+ -1, -1, 1594, 1600, 1608, -1, -1, -1,
+ 1605, 1604, -1, 1596, 1598, 1602, -1, -1,
+ -1, -1, 1593, 1599, 1607, -1, -1, 506,
+ 1606, 1603, -1, 1595, 1597, 1601, 1637, 1650,
+ 1668, 1671, 1677, 6, 1641, -1, 1679, -1,
+ 1715, 1672, 1716, 48, -1, -1, -1, -1,
+ 8, 1674, -1, 5, -1, -1, -1, 20,
+ 1675, -1, 501, -1, 502, -1, -1, 1,
+ -1, -1, -1, -1, 11, -1, 505, -1,
+ 9, 54, 38, 507, 40, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, 506, -1, -1, 6,
+ -1, -1, 48, -1, 1061, 1062, -1, 1065,
+ 1066, 1067, 1068, 1082, 10, -1, -1, 1089,
+ 1101, 1102, 1106, 1126, 1108, 1101, -1, -1,
+ 1104, -1, 1087, -1, -1, -1, 1088, -1,
+ 1103, 1107, 1124, -1, 1128, -1, -1, 1166,
+ -1, 1113, 1202, 1172, -1, -1, 1205, 1125,
+ -1, 46, 1129, -1, 1158, -1, 1180, 1165,
+ -1, 1177, -1, 1171, -1, -1, -1, 1176,
+ -1, -1, 1157, -1, 1168, 1170, 1179, 1174,
+ 1132, 1178, 502, -1, 47, 510, -1, 1175,
+ 1224, 1233, 1236, 1246, 1167, 1169, 1251, 1173,
+ 1253, 1258, 1262, 1272, 1273, 1252, 1265, 1261,
+ 1264, 1257, 1279, 1221, 1231, 1250, 1282, 1254,
+ 1256, 1260, 1283, 1287, 1309, 1289, 1263, -1,
+ 1259, 1285, -1, 1282, -1, -1, 1311, -1,
+ 1321, 1284, 1288, -1, 1370, 1306, -1, -1,
+ 1378, -1, 1295, -1, 1312, 1443, -1, 1324,
+ 1307, -1, -1, -1, 1345, 1357, -1, 1218,
+ 1229, -1, 1494, -1, 1318, -1, 1398, -1,
+ -1, 1368, 1375, 1391, 1427, 1395, -1, 1402,
+ 1406, 1430, 1397, 1416, 1417, -1, 1408, 1441,
+ 1409, 1405, 1389, 1401, 1393, 1448, 1400, 1404,
+ -1, -1, -1, 24, -1, -1, -1, -1,
+ 1407, -1, 1403, 504, -1, -1, 39, -1,
+ 65, -1, -1, -1, 1575, 1572, 1579, 1578,
+ 1348, 1577, 1573, 1574, 1576, -1, -1, -1,
+ 1588, -1, -1, 52, 1567, 1564, 1571, 1570,
+ 1592, 1569, 1565, 1566, 1568, -1, -1, -1,
+ -1, 1628, -1, 44, -1, 69, -1, -1,
+ 10, -1, 1686, -1, -1, 1521, -1, 1522,
+ -1, -1, -1, -1, -1, -1, -1, 46,
+ 1706, 1528, 1712, -1, 1529, 1531, -1, 1524,
+ 502, -1, 47, 510, -1, 24, -1, -1,
+ -1, 504, -1, 39, -1, 65, -1, -1,
+ -1, -1, -1, -1, 52, -1, -1, -1,
+ -1, 70, 44, -1, 28, 1063, -1, 1064,
+ 1105, 1110, 1112, 1116, 1120, 1130, 1131, 1123,
+ 1111, 1119, 1122, 1115, 1132, 1133, 1137, 1139,
+ 1109, -1, 1114, 1118, 1135, 1157, -1, 1132,
+ 1121, -1, 1117, -1, 1134, 1138, -1, 1159,
+ -1, -1, 1164, -1, 1144, 1183, 1155, -1,
+ -1, -1, 1156, -1, -1, 1160, 23, -1,
+ 1181, 24, 1239, 1255, 1182, 1286, 1291, 1293,
+ 1298, 1302, 1313, 1314, 1305, 1292, 1301, 1304,
+ 1297, 1363, 1436, -1, -1, 1290, 1294, 1296,
+ 1300, -1, 1339, -1, -1, 1303, -1, 1299,
+ 1384, -1, -1, -1, 1362, 1399, 1365, 1433,
+ -1, -1, 1488, -1, -1, -1, -1, 21,
+ -1, -1, -1, -1, 1502, -1, -1, -1,
+ 1487, -1, 55, 39, 7, 1580, 1461, 41,
+ 1585, -1, -1, -1, 1609, 1586, -1, -1,
+ -1, 1610, -1, -1, -1, 45, -1, 1680,
+ 1684, -1, 1688, 1692, 1694, 1700, 1702, 1704,
+ -1, 1708, 1685, -1, -1, 28, 1683, 1682,
+ -1, 1690, 1696, 1698, -1, -1, -1, 23,
+ -1, 1710, 24, 1703, -1, 21, -1, -1,
+ -1, 55, 39, -1, 7, 41, -1, -1,
+ -1, -1, 45, -1, 51, 1113, 1136, 1141,
+ 1143, 1147, 1151, 1161, 1162, 1154, 1142, 1150,
+ 1153, 1146, -1, 53, 22, 42, 1140, -1,
+ 1145, 1149, 1295, 1330, 1333, 1364, 1152, -1,
+ 1148, 1418, 1420, 1425, 1451, 1459, 1462, 1466,
+ 1468, -1, -1, 1460, 1456, 1464, -1, -1,
+ -1, 1489, 56, 1495, 1485, 1463, 1467, 33,
+ -1, -1, -1, 49, -1, 1583, 1590, 1490,
+ -1, -1, -1, 1486, 1618, 1612, 1626, 1623,
+ 1622, 1614, 1581, 1616, 1620, 43, 1584, -1,
+ -1, 51, 53, 22, 1617, 1611, 1625, 1624,
+ 1621, 1613, 42, 1615, 1619, -1, 56, 33,
+ -1, 49, 67, -1, 43, -1, -1, -1,
+ 1144, -1, -1, 1493, 1465, 1470, 1472, 1477,
+ 1481, 1491, 1492, 1484, 1471, 1480, 1483, 1476,
+ 14, 1582, 1591, 57, 1469, 1473, 1475, 1479,
+ 50, 14, -1, 14, 1482, 57, 1478, 50,
+ 14, 1163, 50, 1474, 50, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1
+};
+#endif
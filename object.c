@@ -19,12 +19,16 @@
 
 //#define DEBUG_ELF
 
-uint32_t symsize = 0;			// Size of BSD/ELF symbol table
-uint32_t strindx = 0x00000004;	// BSD/ELF string table index
-uint8_t * strtable;				// Pointer to the symbol string table
-uint8_t * objImage;				// Global object image pointer
-int elfHdrNum[9] = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-uint32_t extraSyms;
+ASMCTX uint32_t symsize = 0;			// Size of BSD/ELF symbol table
+ASMCTX uint32_t strindx = 0x00000004;	// BSD/ELF string table index
+ASMCTX uint8_t * strtable;				// Pointer to the symbol string table
+ASMCTX uint8_t * objImage;				// Global object image pointer
+ASMCTX int elfHdrNum[9] = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+ASMCTX uint32_t extraSyms;
+ASMCTX int objmem_flag;				// 1, object image goes to objmem, not a file
+ASMCTX uint8_t * objmem;				// Object image written to memory
+ASMCTX size_t objmemsize;				// # bytes in objmem
+static long unused;				// For supressing 'write' warnings
 
 static uint16_t tdb_tab[] = {
 	0,				// absolute
@@ -33,7 +37,7 @@ static uint16_t tdb_tab[] = {
 	AL_BSS			// BSS segment based
 };
 
-uint32_t PRGFLAGS;	/* PRGFLAGS as defined in Atari Compendium Chapter 2
+ASMCTX uint32_t PRGFLAGS;	/* PRGFLAGS as defined in Atari Compendium Chapter 2
 Definition		Bit(s)	Meaning
 --------------- ------- --------------------------------------------------------
 PF_FASTLOAD		0		If set, clear only the BSS area on program load,
@@ -62,6 +66,21 @@ See left.		4 & 5	If these bits are set to 0 (PF_PRIVATE), the processes'
 static void WriteLOD(void);
 static void WriteP56(void);
 
+//
+// Write part of the object image to the object file (or to memory)
+//
+void WriteImage(int fd, const void * buf, size_t size)
+{
+	if (objmem_flag)
+	{
+		objmem = realloc(objmem, objmemsize + size);
+		memcpy(objmem + objmemsize, buf, size);
+		objmemsize += size;
+	}
+	else
+		unused = write(fd, buf, size);
+}
+
 //
 // Add entry to symbol table (in ALCYON mode)
 // If 'globflag' is 1, make the symbol global
@@ -357,7 +376,10 @@ int WriteObject(int fd)
 	uint8_t * buf;			// Scratch area
 	uint8_t * p;			// Temporary ptr
 	LONG trsize, drsize;	// Size of relocations
-	uint32_t unused;		// For supressing 'write' warnings
+
+	symsize = 0;			// Nothing in the symbol & string tables yet
+	strindx = 0x00000004;
+	extraSyms = 0;
 
 	if (verb_flag)
 	{
@@ -381,7 +403,9 @@ int WriteObject(int fd)
 
 		AssignSymbolNos(NULL, NULL);	// Assign index numbers to the symbols
 		tds = sect[TEXT].sloc + sect[DATA].sloc;	// Get size of TEXT and DATA segment
-		buf = malloc(0x800000);			// Allocate 8MB object file image memory
+		// Allocate object file image memory: TEXT & DATA, plus 8MB for the
+		// header, relocation info & symbols
+		buf = malloc(0x800000 + tds);
 
 		if (buf == NULL)
 		{
@@ -389,7 +413,7 @@ int WriteObject(int fd)
 			return ERROR;
 		}
 
-		memset(buf, 0, 0x800000);		// Clear allocated memory
+		memset(buf, 0, 0x800000 + tds);	// Clear allocated memory
 		objImage = buf;					// Set global object image pointer
 		strtable = malloc(0x200000);	// Allocate 2MB string table buffer
 
@@ -405,7 +429,7 @@ int WriteObject(int fd)
 		// Build object file header
 		chptr = buf;					// Base of header (for D_foo macros)
 		ch_size = 0;
-		challoc = 0x800000;
+		challoc = 0x800000 + tds;
 		D_long(0x00000107);				// Magic number
 		D_long(sect[TEXT].sloc);		// TEXT size
 		D_long(sect[DATA].sloc);		// DATA size
@@ -452,7 +476,7 @@ int WriteObject(int fd)
 		D_long(strindx);				// Write string table size
 
 		// Write the BSD object file from the object image buffer
-		unused = write(fd, buf, BSDHDRSIZE + tds + trsize + drsize + symsize + strindx + 4);
+		WriteImage(fd, buf, BSDHDRSIZE + tds + trsize + drsize + symsize + strindx + 4);
 
 		if (verb_flag)
 		{
@@ -531,17 +555,19 @@ int WriteObject(int fd)
 		}
 
 		// Write out the header + text & data + symbol table (if any)
-		unused = write(fd, buf, HDRSIZE + tds + symsize);
+		WriteImage(fd, buf, HDRSIZE + tds + symsize);
 
 		// Construct and write relocation information; the size of it changes if
 		// we're writing a RELMODed executable. N.B.: Destroys buffer!
 		tds = MarkImage(buf, tds, sect[TEXT].sloc, 1);
-		unused = write(fd, buf, tds);
+		WriteImage(fd, buf, tds);
 	}
 	else if (obj_format == ELF)
 	{
-		// Allocate 6MB object file image memory
-		buf = malloc(0x600000);
+		// Allocate object file image memory: TEXT & DATA, plus 6MB for the
+		// rest
+		tds = sect[TEXT].sloc + sect[DATA].sloc;
+		buf = malloc(0x600000 + tds);
 
 		if (buf == NULL)
 		{
@@ -549,7 +575,7 @@ int WriteObject(int fd)
 			return ERROR;
 		}
 
-		memset(buf, 0, 0x600000);
+		memset(buf, 0, 0x600000 + tds);
 		objImage = buf;					// Set global object image pointer
 		strtable = malloc(0x200000);	// Allocate 2MB string table buffer
 
@@ -648,7 +674,7 @@ for(int j=0; j<i; j++)
 		// at Executable and Linkable Format on Wikipedia.
 		chptr = buf;
 		ch_size = 0;
-		challoc = 0x600000;
+		challoc = 0x600000 + tds;
 		D_long(0x7F454C46); // 00 - "<7F>ELF" Magic Number
 		D_byte(0x01); // 04 - 32 vs 64 (1 = 32, 2 = 64)
 		D_byte(0x02); // 05 - Endianness (1 = LE, 2 = BE)
@@ -817,7 +843,7 @@ for(int j=0; j<i; j++)
 		memcpy(buf + headerLoc, headers, headerSize);
 
 		// Finally, write out the object
-		unused = write(fd, buf, elfSize);
+		WriteImage(fd, buf, elfSize);
 
 		// Free allocated memory
 		if (buf)
@@ -852,7 +878,7 @@ for(int j=0; j<i; j++)
 			WriteP56();
 
 		// Write all the things \o/
-		unused = write(fd, buf, chptr - buf);
+		WriteImage(fd, buf, chptr - buf);
 
 		if (buf)
 			free(buf);
@@ -892,7 +918,7 @@ for(int j=0; j<i; j++)
 		}
 
 		// Write out the header + text & data + symbol table (if any)
-		unused = write(fd, buf, tds);
+		WriteImage(fd, buf, tds);
 
 	}
 	return 0;
@@ -42,12 +42,16 @@ enum ELFSectionNames
 #define SHN_COMMON      0xFFF2          /* Associated symbol is common */
 
 // Exported variables.
-extern uint8_t * objImage;
-extern int elfHdrNum[];
-extern uint32_t extraSyms;
+extern ASMCTX uint8_t * objImage;
+extern ASMCTX int elfHdrNum[];
+extern ASMCTX uint32_t extraSyms;
+extern ASMCTX int objmem_flag;
+extern ASMCTX uint8_t * objmem;
+extern ASMCTX size_t objmemsize;
 
 // Exported functions
 int WriteObject(int);
+void WriteImage(int, const void *, size_t);
 
 #endif // __OBJECT_H__
 
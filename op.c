@@ -30,12 +30,10 @@ static int HandleNOP(void);
 static int HandleJump(void);
 
 // OP assembler vars.
-static uint8_t lastObjType;
-static uint32_t lastSloc;
-static char scratchbuf[4096];
-static TOKEN fixupExpr[4] = { CONST, 0, 0, ENDEXPR };
-//static PTR fixupPtr = { .tk = (fixupExpr + 1) };		// C99 \o/
-static PTR fixupPtr = { (uint8_t *)(fixupExpr + 1) };	// meh, it works
+static ASMCTX uint8_t lastObjType;
+static ASMCTX uint32_t lastSloc;
+static ASMCTX char scratchbuf[4096];
+static ASMCTX TOKEN fixupExpr[4] = { CONST, 0, 0, ENDEXPR };
 
 //
 // The main Object Processor assembler. Basically just calls the sub functions
@@ -228,6 +226,7 @@ static int HandleScaledBitmap(void)
 		// been aligned, therefore no fixup is necessary.
 		if (lastObjType == 0)
 		{
+			PTR fixupPtr = { (uint8_t *)(fixupExpr + 1) };
 			*fixupPtr.u64 = (orgaddr + 0x18) & 0xFFFFFFE0;
 			AddFixup(FU_QUAD | FU_OBJLINK, lastSloc, fixupExpr);
 		}
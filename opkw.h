@@ -0,0 +1,463 @@
+#ifdef DEF_MO
+/*
+ *  Keyword definitions
+ */
+#define	MO__56001	64
+#define	MO__6502	2
+#define	MO__68000	3
+#define	MO__68020	58
+#define	MO__68030	59
+#define	MO__68040	60
+#define	MO__68060	61
+#define	MO__68881	62
+#define	MO__68882	63
+#define	MO__ABS	7
+#define	MO__ALIGN	69
+#define	MO__ASSERT	28
+#define	MO__BSS	4
+#define	MO__CARGS	10
+#define	MO__CCUNDEF	51
+#define	MO__COMM	8
+#define	MO__CSTRUCT	53
+#define	MO__DATA	5
+#define	MO__DC	12
+#define	MO__DCB	17
+#define	MO__DISABLE	22
+#define	MO__DPHRASE	42
+#define	MO__DS	13
+#define	MO__DSM	68
+#define	MO__DSP	16
+#define	MO__DUMP	20
+#define	MO__EJECT	46
+#define	MO__ELSE	501
+#define	MO__ENABLE	23
+#define	MO__END	34
+#define	MO__ENDC	502
+#define	MO__ENDIF	502
+#define	MO__ENDM	505
+#define	MO__ENDR	507
+#define	MO__EQU	18
+#define	MO__EQURUNDEF	50
+#define	MO__ERROR	47
+#define	MO__EVEN	1
+#define	MO__EXITM	510
+#define	MO__EXTERN	24
+#define	MO__GLOBL	24
+#define	MO__GOTO	11
+#define	MO__GPU	15
+#define	MO__GPUMAIN	56
+#define	MO__IF	500
+#define	MO__IIF	503
+#define	MO__INCBIN	21
+#define	MO__INCLUDE	33
+#define	MO__INIT	9
+#define	MO__JPAD	54
+#define	MO__LIST	38
+#define	MO__LONG	40
+#define	MO__MACRO	504
+#define	MO__MACUNDEF	14
+#define	MO__NLIST	39
+#define	MO__NOCLEAR	49
+#define	MO__NOFPU	65
+#define	MO__NOJPAD	55
+#define	MO__NOLIST	39
+#define	MO__OBJPROC	67
+#define	MO__OFFSET	7
+#define	MO__OPT	66
+#define	MO__ORG	0
+#define	MO__PHRASE	41
+#define	MO__PRGFLAGS	57
+#define	MO__PRINT	52
+#define	MO__QPHRASE	43
+#define	MO__REGBANK0	25
+#define	MO__REGBANK1	26
+#define	MO__REGUNDEF	50
+#define	MO__REPT	506
+#define	MO__SUBTTL	45
+#define	MO__TABLE	70
+#define	MO__TEXT	6
+#define	MO__TITLE	44
+#define	MO__UNDEFMAC	14
+#define	MO__WARN	48
+#define	MO_ASSERT	28
+#define	MO_BITMAP	3100
+#define	MO_BRANCH	3103
+#define	MO_BSS	4
+#define	MO_CARGS	10
+#define	MO_CCUNDEF	51
+#define	MO_COMM	8
+#define	MO_CSTRUCT	53
+#define	MO_DATA	5
+#define	MO_DC	12
+#define	MO_DCB	17
+#define	MO_DISABLE	22
+#define	MO_DPHRASE	42
+#define	MO_DS	13
+#define	MO_DSM	68
+#define	MO_DUMP	20
+#define	MO_EJECT	46
+#define	MO_ELSE	501
+#define	MO_ENABLE	23
+#define	MO_END	34
+#define	MO_ENDC	502
+#define	MO_ENDIF	502
+#define	MO_ENDM	505
+#define	MO_ENDR	507
+#define	MO_EQU	18
+#define	MO_EQURUNDEF	50
+#define	MO_ERROR	47
+#define	MO_EVEN	1
+#define	MO_EXITM	510
+#define	MO_EXTERN	24
+#define	MO_GLOBL	24
+#define	MO_GOTO	11
+#define	MO_GPUMAIN	56
+#define	MO_GPUOBJ	3102
+#define	MO_IF	500
+#define	MO_IIF	503
+#define	MO_INCBIN	21
+#define	MO_INCLUDE	33
+#define	MO_INIT	9
+#define	MO_JPAD	54
+#define	MO_JUMP	3106
+#define	MO_LIST	38
+#define	MO_LONG	40
+#define	MO_MACRO	504
+#define	MO_MACUNDEF	14
+#define	MO_NLIST	39
+#define	MO_NOCLEAR	49
+#define	MO_NOFPU	65
+#define	MO_NOJPAD	55
+#define	MO_NOLIST	39
+#define	MO_NOP	3105
+#define	MO_OFFSET	7
+#define	MO_OPT	66
+#define	MO_ORG	0
+#define	MO_PHRASE	41
+#define	MO_PRGFLAGS	57
+#define	MO_PRINT	52
+#define	MO_QPHRASE	43
+#define	MO_REGUNDEF	50
+#define	MO_REPT	506
+#define	MO_SCBITMAP	3101
+#define	MO_STOP	3104
+#define	MO_SUBTTL	45
+#define	MO_TEXT	6
+#define	MO_TITLE	44
+#define	MO_UNDEFMAC	14
+#define	MO_WARN	48
+#endif
+
+#ifdef DECL_MO
+/*
+ *  keyword state-machine tables
+ *
+ */
+
+int mobase[412] = {
+ 0, 23, 3, 36, 46, 47, 57, 61,
+ 74, 13, 42, 5, 47, 54, 74, 15,
+ 3, 75, 80, 38, 10, 0, 0, 82,
+ 34, 90, 97, 105, 87, 98, 42, 99,
+ 63, 75, 118, 103, 70, 92, 89, 130,
+ 111, 125, 109, 110, 131, 114, 119, 117,
+ 127, 121, 122, 141, 125, 137, 133, 134,
+ 143, 130, 149, 130, 134, 149, 146, 141,
+ 137, 137, 153, 158, 159, 149, 144, 150,
+ 162, 159, 166, 164, 151, 166, 156, 168,
+ 171, 173, 179, 168, 182, 161, 166, 183,
+ 170, 0, 1, 2, 171, 182, 173, 174,
+ 176, 174, 183, 177, 178, 197, 181, 193,
+ 189, 190, 199, 187, 206, 187, 191, 206,
+ 203, 198, 194, 194, 210, 215, 216, 200,
+ 206, 218, 213, 222, 216, 221, 209, 223,
+ 213, 226, 228, 230, 236, 237, 216, 221,
+ 238, 225, 239, 232, 233, 241, 235, 237,
+ 233, 251, 252, 236, 239, 253, 252, 256,
+ 256, 242, 246, 248, 243, 259, 264, 252,
+ 255, 269, 252, 269, 259, 256, 270, 261,
+ 259, 268, 267, 268, 276, 267, 286, 282,
+ 275, 272, 270, 272, 284, 278, 275, 276,
+ 285, 293, 285, 3, 2, 9, 6, 293,
+ 296, 295, 289, 291, 287, 305, 306, 290,
+ 293, 307, 306, 310, 310, 296, 300, 302,
+ 297, 313, 318, 306, 309, 322, 305, 322,
+ 307, 322, 312, 312, 320, 319, 320, 328,
+ 322, 320, 339, 335, 328, 325, 342, 325,
+ 326, 335, 328, 337, 345, 337, 334, 352,
+ 351, 336, 352, 336, 356, 358, 340, 349,
+ 356, 343, 347, 353, 349, 356, 368, 368,
+ 362, 351, 358, 360, 355, 371, 356, 377,
+ 360, 375, 362, 370, 363, 383, 371, 366,
+ 367, 383, 383, 6, 16, 17, 18, 19,
+ 20, 20, 376, 373, 373, 389, 373, 393,
+ 395, 377, 386, 393, 379, 383, 389, 385,
+ 392, 404, 397, 386, 393, 395, 390, 406,
+ 391, 412, 395, 397, 411, 398, 406, 399,
+ 419, 420, 408, 403, 419, 420, 420, 407,
+ 412, 421, 425, 428, 420, 414, 429, 421,
+ 422, 428, 428, 425, 436, 437, 441, 439,
+ 424, 425, 441, 446, 429, 445, 437, 439,
+ 439, 433, 449, 452, 444, 438, 453, 445,
+ 446, 452, 448, 459, 460, 464, 462, 447,
+ 453, 449, 465, 470, 453, 459, 470, 463,
+ 463, 471, 458, 474, 475, 477, 468, 478,
+ 479, 467, 479, 482, 483, 488, 489, 485,
+ 472, 488, 489, 491, 482, 492, 493, 481,
+ 497, 494, 497, 492, 499, 504, 501, 501,
+ 489, 503, 494, 508, 507, 507, 495, 23,
+ 509, 513, 511, 512
+};
+
+int motab[641] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, 1, -1,
+ 187, 188, 189, 275, -2, 90, 89, -2,
+ 91, 276, 190, 277, 278, 279, 281, 280,
+ -2, -2, -2, -2, -2, -2, -2, -2,
+ -2, -1, -1, -1, 21, 22, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 2, 3, 4, 5, 6, 72, 7,
+ 81, 8, 9, 88, 10, 11, 12, 13,
+ 14, 15, 16, 17, 18, 19, 42, 20,
+ 23, 24, 25, 26, 27, 68, 28, 80,
+ 29, 30, 69, 31, 32, 33, 34, 35,
+ 36, 37, 38, 39, 40, 43, 41, 46,
+ 50, 47, 51, 70, 87, 95, 44, 45,
+ 52, 71, 118, 73, 75, 48, 74, 53,
+ 121, 49, 54, 56, 55, 57, 76, 58,
+ 77, 63, 59, 60, 64, 65, 82, 61,
+ -2, 62, 78, 66, 92, 85, 130, 122,
+ 67, 86, 123, 96, 79, 97, 93, 83,
+ 84, 131, 100, 113, 101, 94, 114, 115,
+ -2, 98, 102, 116, 119, 99, 132, 128,
+ 117, 103, 120, 106, 104, 107, 105, 108,
+ 124, 129, 109, 110, 125, 136, 137, 111,
+ 138, 112, 139, 133, 140, -2, 126, 134,
+ 127, 141, 142, 135, 143, 144, 145, -2,
+ 146, 147, -2, 148, 149, 150, 151, 153,
+ 154, 152, 155, 156, 158, 159, 160, -2,
+ 163, 161, 164, 165, 166, 167, 157, 162,
+ 168, 169, 173, -2, 170, -2, 174, 175,
+ 171, 176, 172, 177, 178, 180, -2, 181,
+ 182, 183, 184, 185, 186, 179, -2, 191,
+ 192, -2, 193, 194, 195, 196, 197, -2,
+ 198, 199, -2, 200, 201, -2, 202, 203,
+ 205, 206, 204, 207, 208, 210, 211, 212,
+ -2, 215, 213, 216, 217, 218, 219, 209,
+ 214, 220, 224, 225, 221, -2, -2, 226,
+ 222, 227, 223, 228, 229, 230, 232, 233,
+ 234, 235, 236, 237, 238, 239, 231, 240,
+ 241, 242, -2, 243, -2, 244, 245, -2,
+ 246, -2, 247, -2, 249, 250, -2, 251,
+ 252, 248, 253, -2, 254, -2, 255, 256,
+ -2, -2, -2, -2, -2, -2, 260, 258,
+ 261, 257, 259, 262, 263, 264, 265, 266,
+ 267, 268, 269, 270, -2, 271, -2, 272,
+ -2, 273, 274, -2, 282, 283, 284, 285,
+ -2, 286, -2, 287, 288, -2, 289, -2,
+ 290, -2, 292, 293, -2, 294, 295, 291,
+ 296, -2, 297, -2, 298, -2, -2, -2,
+ -2, -2, 300, 302, 303, 301, 299, 304,
+ 305, 306, 307, 308, 309, 310, 311, 312,
+ 313, -2, 315, 316, -2, 317, 318, -2,
+ 319, 320, 321, -2, 322, 323, 324, 325,
+ -2, 326, -2, 314, 327, -2, -2, 328,
+ -2, 329, 330, 331, 332, -2, 333, -2,
+ 334, -2, 335, 336, 337, 338, 339, -2,
+ 340, 341, 342, 343, -2, 344, -2, 345,
+ -2, 346, 347, 348, 349, -2, 350, -2,
+ 351, -2, -2, 352, -2, 353, 354, 355,
+ -2, 356, -2, 357, -2, 358, 359, 360,
+ 361, 362, 363, -2, 364, 365, 366, 367,
+ -2, -2, 368, -2, -2, -2, 369, 370,
+ 371, 372, -2, 373, -2, 374, -2, -2,
+ 375, 376, 377, -2, -2, -2, -2, 378,
+ 379, 380, 381, -2, 382, -2, 383, 384,
+ 385, 386, -2, 387, -2, 388, -2, 389,
+ 390, 391, -2, -2, 392, -2, -2, 393,
+ 394, 395, 396, -2, 397, -2, -2, -2,
+ -2, 398, -2, -2, 399, -2, 400, -2,
+ 401, 402, 403, -2, -2, -2, -2, 404,
+ -2, -2, 405, -2, -2, 406, -2, 407,
+ 408, 409, 410, -2, -2, -2, -2, -2,
+ 411, -2, -2, -2, -2, -2, -2, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1
+};
+
+int mocheck[641] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, 0, -1,
+ 89, 90, 91, 187, 188, 22, 21, 275,
+ 22, 189, 91, 189, 189, 189, 190, 189,
+ 276, 277, 278, 279, 280, 281, 281, 407,
+ 407, -1, -1, -1, 1, 1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 0, 0, 0, 0, 0, 11, 0,
+ 16, 0, 0, 20, 0, 0, 0, 0,
+ 0, 0, 0, 0, 0, 0, 2, 0,
+ 1, 1, 1, 1, 1, 9, 1, 15,
+ 1, 1, 9, 1, 1, 1, 1, 1,
+ 1, 1, 1, 1, 1, 3, 1, 4,
+ 5, 4, 5, 10, 19, 24, 3, 3,
+ 5, 10, 30, 12, 13, 4, 12, 5,
+ 32, 4, 5, 6, 5, 6, 13, 6,
+ 13, 7, 6, 6, 7, 7, 17, 6,
+ 8, 6, 14, 8, 23, 18, 36, 33,
+ 8, 18, 33, 25, 14, 25, 23, 17,
+ 17, 37, 26, 28, 26, 23, 28, 28,
+ 29, 25, 26, 29, 31, 25, 38, 35,
+ 29, 26, 31, 27, 26, 27, 26, 27,
+ 34, 35, 27, 27, 34, 40, 41, 27,
+ 42, 27, 43, 39, 44, 45, 34, 39,
+ 34, 46, 47, 39, 48, 49, 50, 51,
+ 52, 53, 54, 55, 56, 57, 58, 59,
+ 60, 58, 61, 62, 63, 64, 65, 66,
+ 68, 67, 69, 70, 71, 72, 62, 67,
+ 73, 74, 75, 76, 74, 77, 78, 79,
+ 74, 79, 74, 80, 81, 82, 74, 83,
+ 84, 85, 86, 87, 88, 81, 92, 93,
+ 94, 95, 96, 97, 98, 99, 100, 101,
+ 102, 103, 104, 105, 106, 104, 107, 108,
+ 109, 110, 108, 111, 112, 113, 114, 115,
+ 116, 118, 117, 119, 120, 121, 122, 112,
+ 117, 123, 124, 125, 123, 126, 127, 128,
+ 123, 129, 123, 129, 130, 131, 132, 133,
+ 134, 135, 136, 137, 138, 139, 131, 140,
+ 141, 142, 143, 144, 145, 146, 147, 148,
+ 149, 150, 151, 152, 153, 154, 155, 156,
+ 157, 152, 158, 159, 160, 152, 160, 161,
+ 162, 163, 152, 164, 165, 166, 168, 167,
+ 169, 161, 167, 170, 171, 172, 173, 174,
+ 175, 176, 177, 178, 179, 180, 181, 182,
+ 183, 184, 185, 186, 191, 192, 193, 194,
+ 195, 196, 197, 198, 199, 200, 201, 202,
+ 203, 204, 205, 206, 207, 208, 209, 204,
+ 210, 211, 212, 204, 213, 214, 215, 216,
+ 204, 217, 218, 219, 220, 218, 213, 221,
+ 222, 223, 224, 225, 226, 227, 228, 229,
+ 230, 231, 232, 233, 234, 235, 236, 237,
+ 238, 239, 240, 241, 242, 243, 244, 245,
+ 246, 247, 248, 230, 249, 250, 251, 252,
+ 253, 254, 255, 256, 257, 258, 259, 260,
+ 261, 262, 263, 264, 265, 266, 267, 268,
+ 269, 270, 271, 272, 273, 274, 282, 283,
+ 284, 285, 286, 287, 288, 289, 290, 291,
+ 292, 293, 294, 295, 296, 297, 298, 299,
+ 300, 301, 302, 303, 304, 305, 306, 307,
+ 308, 309, 310, 311, 312, 313, 314, 315,
+ 316, 317, 318, 319, 320, 321, 322, 323,
+ 324, 325, 326, 327, 328, 329, 330, 331,
+ 332, 333, 334, 335, 336, 337, 338, 339,
+ 340, 341, 342, 343, 344, 345, 346, 347,
+ 348, 349, 350, 351, 352, 353, 354, 355,
+ 356, 357, 358, 359, 360, 361, 362, 363,
+ 364, 365, 366, 367, 368, 369, 370, 371,
+ 372, 373, 374, 375, 376, 377, 378, 379,
+ 380, 381, 382, 383, 384, 385, 386, 387,
+ 388, 389, 390, 391, 392, 393, 394, 395,
+ 396, 397, 398, 399, 400, 401, 402, 403,
+ 404, 405, 406, 408, 409, 410, 411, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1
+};
+
+int moaccept[641] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, 2, -1, -1, 64,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ 3, 58, 59, 60, 61, 62, 63, 25,
+ 26, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, 12, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, 13, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ 500, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, 12, -1, -1, -1,
+ 500, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, 13, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, 4, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, 17,
+ -1, -1, 68, -1, -1, -1, -1, 18,
+ -1, 34, -1, -1, -1, -1, -1, 503,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, 66, -1, 0, -1, -1,
+ -1, -1, -1, -1, -1, -1, 3105, -1,
+ -1, -1, -1, -1, -1, -1, 7, -1,
+ -1, 4, -1, -1, -1, -1, -1, 17,
+ -1, -1, 68, -1, -1, 16, -1, -1,
+ 18, -1, 34, -1, -1, -1, -1, 15,
+ 503, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, 66, 0, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, 8, -1, 5, -1, -1, 20,
+ -1, 501, -1, 502, -1, -1, 1, -1,
+ -1, -1, -1, 11, -1, 505, -1, -1,
+ 9, 54, 507, 3106, 38, 40, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, 506, -1, 3104, -1,
+ 6, -1, -1, 48, -1, -1, -1, -1,
+ 8, -1, 5, -1, -1, 20, -1, 501,
+ -1, 502, -1, -1, 1, -1, -1, -1,
+ -1, 11, -1, 505, -1, 9, 54, 38,
+ 507, 40, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 506, -1, -1, 6, -1, -1, 48,
+ -1, -1, -1, 10, -1, -1, -1, -1,
+ 46, -1, 502, -1, -1, 47, 510, -1,
+ 24, -1, -1, -1, -1, 504, -1, 39,
+ -1, 65, -1, -1, -1, -1, -1, 52,
+ -1, -1, -1, -1, 44, -1, 69, -1,
+ 10, -1, -1, -1, -1, 46, -1, 502,
+ -1, 47, 510, -1, 24, -1, -1, -1,
+ 504, -1, 39, -1, 65, -1, -1, -1,
+ -1, -1, -1, 52, -1, -1, -1, -1,
+ 70, 44, -1, 28, 3100, 3103, -1, -1,
+ -1, -1, 23, -1, 24, -1, 3102, 21,
+ -1, -1, -1, 55, 39, 7, 41, -1,
+ -1, -1, -1, 45, -1, 28, -1, -1,
+ -1, -1, 23, -1, 24, -1, 21, -1,
+ -1, -1, 55, 39, -1, 7, 41, -1,
+ -1, -1, -1, 45, -1, 51, 53, 22,
+ 42, -1, 56, 33, -1, 49, -1, 43,
+ -1, -1, -1, 51, 53, 22, 42, -1,
+ 56, 33, -1, 49, 67, -1, 43, -1,
+ -1, -1, -1, 14, 57, 50, 3101, 14,
+ -1, 14, 57, 50, 14, 50, 50, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1
+};
+#endif
@@ -1170,6 +1170,7 @@ CHK_FOR_DISPn:
 			  if ((CHECK_OPTS(OPT_PC_RELATIVE)) && ((AnEXATTR & (DEFINED | REFERENCED | EQUATED)) == (DEFINED | REFERENCED)))
 					return error("relocation not allowed when o30 is enabled");
 
+				AnFORCEL = 1;
 				tok++;
 			}
 			else
@@ -1185,6 +1186,20 @@ CHK_FOR_DISPn:
 					if (optim_warn_flag)
 						warn("o0: absolute value from $FFFF8000..$00007FFF optimised to absolute short");
 				}
+				// Not known yet; with --relax the sizing passes may find out
+				// that it fits in a word after all
+				else if (CHECK_OPTS(OPT_ABS_SHORT) && !(AnEXATTR & DEFINED))
+				{
+					AnSDI = RelaxSite(SDI_ABSW);
+
+					if (RelaxState(AnSDI) == SDI_SHORT)
+					{
+						AMn = ABSW;
+
+						if (optim_warn_flag)
+							warn("o0: forward absolute value from $FFFF8000..$00007FFF optimised to absolute short");
+					}
+				}
 			}
 
 			goto AnOK;
@@ -1249,5 +1264,7 @@ AnOK:
 #undef AnBZISE
 #undef AnEXTEN
 #undef AMn_030
+#undef AnSDI
+#undef AnFORCEL
 #undef IS_SUPPRESSEDn
 #undef CHECKODn
@@ -9,6 +9,7 @@
 #include "procln.h"
 #include "6502.h"
 #include "amode.h"
+#include "depend.h"
 #include "direct.h"
 #include "dsp56k_amode.h"
 #include "dsp56k_mach.h"
@@ -18,6 +19,7 @@
 #include "mach.h"
 #include "macro.h"
 #include "op.h"
+#include "relax.h"
 #include "riscasm.h"
 #include "sect.h"
 #include "symbol.h"
@@ -49,14 +51,14 @@
 #define DEF_REG56				// Include DSP56K register definitions
 #include "56kregs.h"
 
-IFENT * ifent;					// Current ifent
-static IFENT ifent0;			// Root ifent
-IFENT * f_ifent;				// Freelist of ifents
-int disabled;					// Assembly conditionally disabled
-int just_bss;					// 1, ds.b in microprocessor mode
-uint32_t pcloc;					// Value of "PC" at beginning of line
-SYM * lab_sym;					// Label on line (or NULL)
-char * label_defined;			// The name of the last label defined in current line (if any)
+ASMCTX IFENT * ifent;					// Current ifent
+static ASMCTX IFENT ifent0;			// Root ifent
+ASMCTX IFENT * f_ifent;				// Freelist of ifents
+ASMCTX int disabled;					// Assembly conditionally disabled
+ASMCTX int just_bss;					// 1, ds.b in microprocessor mode
+ASMCTX uint32_t pcloc;					// Value of "PC" at beginning of line
+ASMCTX SYM * lab_sym;					// Label on line (or NULL)
+ASMCTX char * label_defined;			// The name of the last label defined in current line (if any)
 
 const char extra_stuff[] = "extra (unexpected) text found after addressing mode";
 const char comma_error[] = "missing comma";
@@ -117,18 +119,55 @@ LONG amsktab[0124] = {
 	M_FPSCR			// 0123
 };					// 0123 length
 
+// Addressing-mode number to mask bit number (-1 if not exactly one bit)
+static ASMCTX int8_t amclass[0124];
+
+// Keyword sets (the generated state machine a keyword was found in)
+#define KW_68K   0				// Directives and 68000 mnemonics
+#define KW_6502  1				// Directives and 6502 mnemonics
+#define KW_RISC  2				// Directives and GPU/DSP mnemonics
+#define KW_OP    3				// Directives and OP mnemonics
+#define KW_DSP   4				// Directives and 56001 mnemonics
+
 // Function prototypes
 int HandleLabel(char *, int);
+static int FindKeyword(char *, int *);
+static void ConvertToPCRel(MNTAB *, WORD, LONG);
+static MNTAB * SelectVariant(MNTAB *, WORD, int, int);
 
 //
 // Initialize line processor
 //
 void InitLineProcessor(void)
 {
+	// Free the last assembly's .if levels (any left open, and the free list)
+	while (ifent != NULL && ifent != &ifent0)
+	{
+		IFENT * rif = ifent;
+		ifent = rif->if_prev;
+		free(rif);
+	}
+
+	while (f_ifent != NULL)
+	{
+		IFENT * rif = f_ifent;
+		f_ifent = rif->if_prev;
+		free(rif);
+	}
+
 	disabled = 0;
 	ifent = &ifent0;
 	f_ifent = ifent0.if_prev = NULL;
 	ifent0.if_state = 0;
+
+	for(int i=0; i<0124; i++)
+	{
+		LONG msk = amsktab[i];
+		amclass[i] = -1;
+
+		if (msk != 0 && (msk & (msk - 1)) == 0)
+			for(amclass[i]=0; !(msk & 1); msk >>= 1, amclass[i]++);
+	}
 }
 
 //
@@ -155,6 +194,7 @@ void Assemble(void)
 	int listflag;				// 0: Don't call listeol()
 	WORD rmask;					// Register list, for REG
 	int equreg;				// RISC register
+	int kwset = KW_68K;			// Keyword set the mnemonic was found in
 	listflag = 0;				// Initialise listing flag
 
 loop:							// Line processing loop label
@@ -243,26 +283,8 @@ loop1:										// Internal line processing loop
 	//    0..499      vanilla directives (dc, ds, etc.)
 	//    500..999    electric directives (macro, rept, etc.)
 	//    1000..+     mnemonics (move, lsr, etc.)
-	for(state=0; state>=0;)
-	{
-		j = mnbase[state] + (int)tolowertab[*p];
-
-		// Reject, character doesn't match
-		if (mncheck[j] != state)
-		{
-			state = -1;						// No match
-			break;
-		}
-
-		// Must accept or reject at EOS
-		if (!*++p)
-		{
-			state = mnaccept[j];			// (-1 on no terminal match)
-			break;
-		}
-
-		state = mntab[j];
-	}
+	// and `kwset' says which CPU the mnemonic belongs to.
+	state = FindKeyword(opname, &kwset);
 
 	// Check for ".b" ".w" ".l" after directive, macro or mnemonic.
 	siz = SIZN;
@@ -394,7 +416,8 @@ normal:
 				sy->sattr = GLOBAL;
 			}
 		}
-		else if ((sy->sattr & DEFINED) && equtyp != SET)
+		else if (((sy->sattr & DEFINED) || (sy->sattre & EQUATEDLATE))
+			&& equtyp != SET)
 		{
 			if ((equtyp == EQUREG) && (sy->sattre & UNDEF_EQUR))
 			{
@@ -529,13 +552,25 @@ When checking to see if it's already been equated, issue a warning.
 
 		if (!(eattr & DEFINED))
 		{
-			error(undef_error);
+			// A plain equate may refer forward; it gets its value once all
+			// the source has been read
+			if (equtyp != '=' && equtyp != DEQUALS)
+			{
+				error(undef_error);
+				goto loop;
+			}
+
+			AddLateEquate(sy, exprbuf);
+			ErrorIfNotAtEOL();
 			goto loop;
 		}
 
 		sy->sattr |= eattr | EQUATED;	// Symbol inherits value and attributes
 		sy->svalue = eval;
 
+		if (equtyp == SET)				// Value can change from here on
+			sy->sattre |= EQUATEDSET;
+
 		if (list_flag)					// Put value in listing
 			listvalue((uint32_t)eval);
 
@@ -557,198 +592,94 @@ When checking to see if it's already been equated, issue a warning.
 	if (state == -3)
 		goto loop;
 
-	// If we're in 6502 mode and are still in need of a mnemonic, then search
-	// for valid 6502 mnemonic.
-	if (m6502 && (state < 0 || state >= 1000))
+	// Call 6502 code generator if we found a mnemonic
+	if (kwset == KW_6502 && state >= 2000)
 	{
-#ifdef ST
-		state = kmatch(opname, mpbase, mpcheck, mptab, mpaccept);
-#else
-		for(state=0, p=opname; state>= 0; )
-		{
-			j = mpbase[state] + tolowertab[*p];
+		m6502cg(state - 2000);
+		goto loop;
+	}
 
-			if (mpcheck[j] != state)	// Reject, character doesn't match
-			{
-				state = -1;		// No match
-				break;
-			}
+	// Call RISC code generator if we found a mnemonic
+	if (kwset == KW_RISC && state >= 3000)
+	{
+		GenerateRISCCode(state);
+		goto loop;
+	}
 
-			if (!*++p)
-			{			// Must accept or reject at EOS
-				state = mpaccept[j];	// (-1 on no terminal match)
-				break;
-			}
+	// Call OP code generator if we found a mnemonic
+	if (kwset == KW_OP && state >= 3100)
+	{
+		GenerateOPCode(state);
+		goto loop;
+	}
 
-			state = mptab[j];
-		}
-#endif
+	// Call DSP code generator if we found a mnemonic
+	if (kwset == KW_DSP && state >= 2000)
+	{
+		LONG parcode;
+		int operands;
+		MNTABDSP * md = &dsp56k_machtab[state - 2000];
+		deposit_extra_ea = 0;   // Assume no extra word needed
 
-		// Call 6502 code generator if we found a mnemonic
-		if (state >= 2000)
+		if (md->mnfunc == dsp_mult)
 		{
-			m6502cg(state - 2000);
-			goto loop;
+			// Special case for multiplication instructions: they require
+			// 3 operands
+			if ((operands = dsp_amode(3)) == ERROR)
+				goto loop;
 		}
-	}
-
-	// If we are in GPU or DSP mode and still in need of a mnemonic then search
-	// for one
-	if ((rgpu || rdsp) && (state < 0 || state >= 1000))
-	{
-		for(state=0, p=opname; state>=0;)
+		else if ((md->mnattr & PARMOVE) && md->mn0 != M_AM_NONE)
 		{
-			j = mrbase[state] + (int)tolowertab[*p];
-
-			// Reject, character doesn't match
-			if (mrcheck[j] != state)
-			{
-				state = -1;					// No match
-				break;
-			}
-
-			// Must accept or reject at EOS
-			if (!*++p)
-			{
-				state = mraccept[j];		// (-1 on no terminal match)
-				break;
-			}
-
-			state = mrtab[j];
+			if (dsp_amode(2) == ERROR)
+				goto loop;
 		}
-
-		// Call RISC code generator if we found a mnemonic
-		if (state >= 3000)
+		else if ((md->mnattr & PARMOVE) && md->mn0 == M_AM_NONE)
 		{
-			GenerateRISCCode(state);
-			goto loop;
+			// Instructions that have parallel moves but use no operands
+			// (probably only move). In this case, don't parse addressing
+			// modes--just go straight to parallel parse
+			dsp_am0 = dsp_am1 = M_AM_NONE;
 		}
-	}
-
-	// If we are in OP mode and still in need of a mnemonic then search for one
-	if (robjproc && ((state < 0) || (state >= 1000)))
-	{
-		for(state=0, p=opname; state>=0;)
+		else
 		{
-			j = mobase[state] + (int)tolowertab[*p];
-
-			// Reject, character doesn't match
-			if (mocheck[j] != state)
-			{
-				state = -1;					// No match
-				break;
-			}
+			// Non parallel move instructions can have up to 4 parameters
+			// (well, only tcc instructions really)
+			if ((operands = dsp_amode(4)) == ERROR)
+				goto loop;
 
-			// Must accept or reject at EOS
-			if (!*++p)
+			if (operands == 4)
 			{
-				state = moaccept[j];		// (-1 on no terminal match)
-				break;
+				dsp_tcc4(md->mninst);
+				goto loop;
 			}
-
-			state = motab[j];
 		}
 
-		// Call OP code generator if we found a mnemonic
-		if (state >= 3100)
+		if (md->mnattr & PARMOVE)
 		{
-			GenerateOPCode(state);
-			goto loop;
+			// Check for parallel moves
+			if ((parcode = parmoves(dsp_a1reg)) == ERROR)
+				goto loop;
 		}
-	}
-
-	// If we are in 56K mode and still in need of a mnemonic then search for one
-	if (dsp56001 && ((state < 0) || (state >= 1000)))
-	{
-		for(state=0, p=opname; state>=0;)
+		else
 		{
-			j = dspbase[state] + (int)tolowertab[*p];
-
-			// Reject, character doesn't match
-			if (dspcheck[j] != state)
-			{
-				state = -1;					// No match
-				break;
-			}
+			if (*tok != EOL)
+				error("parallel moves not allowed with this instruction");
 
-			// Must accept or reject at EOS
-			if (!*++p)
-			{
-				state = dspaccept[j];		// (-1 on no terminal match)
-				break;
-			}
-
-			state = dsptab[j];
+			parcode = 0;
 		}
 
-		// Call DSP code generator if we found a mnemonic
-		if (state >= 2000)
-		{
-			LONG parcode;
-			int operands;
-			MNTABDSP * md = &dsp56k_machtab[state - 2000];
-			deposit_extra_ea = 0;   // Assume no extra word needed
+		while ((dsp_am0 & md->mn0) == 0 || (dsp_am1 & md->mn1) == 0)
+			md = &dsp56k_machtab[md->mncont];
 
-			if (md->mnfunc == dsp_mult)
-			{
-				// Special case for multiplication instructions: they require
-				// 3 operands
-				if ((operands = dsp_amode(3)) == ERROR)
-					goto loop;
-			}
-			else if ((md->mnattr & PARMOVE) && md->mn0 != M_AM_NONE)
-			{
-				if (dsp_amode(2) == ERROR)
-					goto loop;
-			}
-			else if ((md->mnattr & PARMOVE) && md->mn0 == M_AM_NONE)
-			{
-				// Instructions that have parallel moves but use no operands
-				// (probably only move). In this case, don't parse addressing
-				// modes--just go straight to parallel parse
-				dsp_am0 = dsp_am1 = M_AM_NONE;
-			}
-			else
-			{
-				// Non parallel move instructions can have up to 4 parameters
-				// (well, only tcc instructions really)
-				if ((operands = dsp_amode(4)) == ERROR)
-					goto loop;
-
-				if (operands == 4)
-				{
-					dsp_tcc4(md->mninst);
-					goto loop;
-				}
-			}
-
-			if (md->mnattr & PARMOVE)
-			{
-				// Check for parallel moves
-				if ((parcode = parmoves(dsp_a1reg)) == ERROR)
-					goto loop;
-			}
-			else
-			{
-				if (*tok != EOL)
-					error("parallel moves not allowed with this instruction");
-
-				parcode = 0;
-			}
-
-			while ((dsp_am0 & md->mn0) == 0 || (dsp_am1 & md->mn1) == 0)
-				md = &dsp56k_machtab[md->mncont];
-
-			GENLINENOSYM();
-			(*md->mnfunc)(md->mninst | (parcode << 8));
-			goto loop;
-		}
+		GENLINENOSYM();
+		(*md->mnfunc)(md->mninst | (parcode << 8));
+		goto loop;
 	}
 
 	// Invoke macro or complain about bad mnemonic
 	if (state < 0)
 	{
-		if ((sy = lookup(opname, MACRO, 0)) != NULL)
+		if ((sy = LookupMacro(opname)) != NULL)
 			InvokeMacro(sy, siz);
 		else
 			error("unknown op '%s'", opname);
@@ -801,6 +732,11 @@ When checking to see if it's already been equated, issue a warning.
 		if (*tok != EOL)
 			error(extra_stuff);
 
+	// Absolute long source operands in this section can go PC relative (o31)
+	if (CHECK_OPTS(OPT_PC_CONVERT) && !a0forcel
+		&& (am0 == ABSL || (am0 == ABSW && a0sdi >= 0)))
+		ConvertToPCRel(m, siz, amsktab[am1]);
+
 	amsk0 = amsktab[am0];
 	amsk1 = amsktab[am1];
 
@@ -815,8 +751,7 @@ When checking to see if it's already been equated, issue a warning.
 	// Keep a backup of chptr (used for optimisations during codegen)
 	chptr_opcode = chptr;
 
-	while (!(m->mnattr & siz) || (amsk0 & m->mn0) == 0 || (amsk1 & m->mn1) == 0)
-		m = &machtab[m->mncont];
+	m = SelectVariant(m, siz, am0, am1);
 
 	DEBUG { printf("    68K: mninst=$%X, siz=$%X, mnattr=$%X, amsk0=$%X, mn0=$%X, amsk1=$%X, mn1=$%X\n", m->mninst, siz, m->mnattr, amsk0, m->mn0, amsk1, m->mn1); }
 
@@ -825,6 +760,158 @@ When checking to see if it's already been equated, issue a warning.
 	goto loop;
 }
 
+//
+// Run a keyword through one of the generated state machines. Returns the
+// keyword's value, or -1 if there's no match.
+//
+static inline int KWLookup(char * p, int * base, int * tab, int * check, int * accept)
+{
+	int state, j;
+
+	for(state=0; ; )
+	{
+		j = base[state] + (int)tolowertab[*p];
+
+		// Reject, character doesn't match
+		if (check[j] != state)
+			return -1;
+
+		// Must accept or reject at EOS
+		if (!*++p)
+			return accept[j];			// (-1 on no terminal match)
+
+		state = tab[j];
+	}
+}
+
+
+//
+// Look up a directive or mnemonic. Every CPU mode has its own state machine
+// (made by kwgen) holding the directives plus that CPU's mnemonics, so this
+// normally takes one walk. Should more than one of the 6502, RISC, OP and
+// 56001 modes be on, they're tried in that order. Returns the keyword's
+// value (or -1) and sets *kwset to the set it was found in.
+//
+static int FindKeyword(char * name, int * kwset)
+{
+	int state = -1;
+
+	if (!(m6502 || rgpu || rdsp || robjproc || dsp56001))
+	{
+		*kwset = KW_68K;
+		return KWLookup(name, mnbase, mntab, mncheck, mnaccept);
+	}
+
+	if (m6502)
+	{
+		*kwset = KW_6502;
+		state = KWLookup(name, mpbase, mptab, mpcheck, mpaccept);
+	}
+
+	if ((rgpu || rdsp) && (state < 0))
+	{
+		*kwset = KW_RISC;
+		state = KWLookup(name, mrbase, mrtab, mrcheck, mraccept);
+	}
+
+	if (robjproc && (state < 0))
+	{
+		*kwset = KW_OP;
+		state = KWLookup(name, mobase, motab, mocheck, moaccept);
+	}
+
+	if (dsp56001 && (state < 0))
+	{
+		*kwset = KW_DSP;
+		state = KWLookup(name, dspbase, dsptab, dspcheck, dspaccept);
+	}
+
+	return state;
+}
+
+
+//
+// Pick the machtab[] entry for a 68K mnemonic, given its size and addressing
+// modes. The bits in the mnemonic's mnvartab[] row say which entries in its
+// chain can take each size and mode, so the first entry that can take all
+// three is the lowest bit they have in common. Modes that don't map to a
+// single mask bit walk the chain instead.
+//
+static MNTAB * SelectVariant(MNTAB * m, WORD siz, int mode0, int mode1)
+{
+	int s = 0;
+	int c0 = amclass[mode0];
+	int c1 = amclass[mode1];
+
+	while (s < 9 && siz != (1 << s))
+		s++;
+
+	if (s < 9 && c0 >= 0 && c1 >= 0)
+	{
+		MNVAR * v = &mnvartab[m - machtab];
+		int bits = v->siz[s] & v->am0[c0] & v->am1[c1];
+
+		if (bits == 0)
+			return &machtab[0];
+
+		for(; !(bits & 1); bits >>= 1)
+			m++;
+
+		return m;
+	}
+
+	LONG amsk0 = amsktab[mode0];
+	LONG amsk1 = amsktab[mode1];
+
+	while (!(m->mnattr & siz) || (amsk0 & m->mn0) == 0 || (amsk1 & m->mn1) == 0)
+		m = &machtab[m->mncont];
+
+	return m;
+}
+
+
+//
+// Turn an absolute long source operand (ea0) into (d16,PC) if it refers to
+// the current section and the instruction takes it. Forward references are
+// left to the sizing passes of --relax. am0 is ABSW here only if the operand
+// was relaxed to absolute short; the PC relative site still has to be
+// announced in that case, so every pass sees the same sequence of sites.
+//
+static void ConvertToPCRel(MNTAB * m, WORD siz, LONG amsk1)
+{
+	// Find the variant the operand would be assembled with
+	while (!(m->mnattr & siz) || (m->mn0 & M_ABSL) == 0 || (amsk1 & m->mn1) == 0)
+		m = &machtab[m->mncont];
+
+	// machtab[0] is the catch-all for bad modes: leave those to be reported
+	if (m == &machtab[0] || !(m->mn0 & M_PCDISP))
+		return;
+
+	if (a0exattr & DEFINED)
+	{
+		// Must be in this section, and well within range as the extension
+		// word doesn't always follow the opword directly
+		if (((a0exattr & TDB) != cursect) || orgactive)
+			return;
+
+		if ((uint32_t)(a0exval - (sloc + 2) + 0x7F00) >= 0xFE00)
+			return;
+	}
+	else
+	{
+		a0pcsdi = RelaxSite(SDI_PCDISP);
+
+		if ((am0 != ABSL) || (RelaxState(a0pcsdi) != SDI_SHORT))
+			return;
+	}
+
+	am0 = PCDISP;
+
+	if (optim_warn_flag)
+		warn("o31: absolute long address converted to PC relative");
+}
+
+
 //
 // Handle the creation of labels
 //
@@ -21,13 +21,13 @@ extern const char comma_error[];
 extern const char locgl_error[];
 extern const char syntax_error[];
 extern const char extra_stuff[];
-extern int just_bss;
-extern uint32_t pcloc;
-extern SYM * lab_sym;
+extern ASMCTX int just_bss;
+extern ASMCTX uint32_t pcloc;
+extern ASMCTX SYM * lab_sym;
 extern LONG amsktab[];
-extern IFENT * ifent;
-extern IFENT * f_ifent;
-extern int disabled;
+extern ASMCTX IFENT * ifent;
+extern ASMCTX IFENT * f_ifent;
+extern ASMCTX int disabled;
 
 // Exported functions
 void InitLineProcessor(void);
@@ -0,0 +1,258 @@
+//
+// RMAC - Renamed Macro Assembler for all Atari computers
+// RELAX.C - Span-Dependent Instruction Relaxation
+// Copyright (C) 199x Landon Dyer, 2011-2022 Reboot and Friends
+// RMAC derived from MADMAC v1.07 Written by Landon Dyer, 1986
+// Source utilised with the kind permission of Landon Dyer
+//
+// rmac is a one pass assembler: anything that isn't known when an instruction
+// is assembled gets the long form and a fixup. With --relax, the source is
+// run through extra "sizing" passes that produce no output. Each span-
+// dependent instruction (SDI) is numbered in order of appearance and gets a
+// state that is carried over from one pass to the next; after every pass the
+// fixups of the SDIs are evaluated against the final symbol values to decide
+// which of them can use the short form on the next pass. This goes on until
+// nothing changes, and the real (final) pass then uses those sizes.
+//
+// An SDI that was made short but doesn't fit anymore on a later pass is made
+// long again and locked that way, so the passes always converge. If a pass
+// sees a different sequence of SDIs (because of conditional assembly that
+// depends on code size, say), relaxation is abandoned altogether.
+//
+
+#include "relax.h"
+#include "depend.h"
+#include "error.h"
+#include "expr.h"
+#include "token.h"
+
+// Span-dependent instruction record. The state is carried from pass to pass,
+// everything else gets refreshed every time the SDI is seen.
+#define SDI struct _sdi
+SDI {
+	uint8_t  kind;		// SDI_BRANCH, ...
+	uint8_t  state;		// SDI_LONG, SDI_SHORT or SDI_LOCKED
+	uint16_t fileno;	// File and line the SDI was seen on, used to check
+	uint32_t lineno;	// that every pass sees the same sequence of SDIs
+	uint16_t sno;		// Section the SDI lives in
+	uint32_t loc;		// Location of the instruction in its section
+	FIXUP *  fixup;		// Fixup on the SDI's operand (NULL if none)
+};
+
+ASMCTX int relax_flag;			// 1, relax span-dependent instructions (--relax)
+ASMCTX int relax_pass;			// !=0, # of the sizing pass being run
+
+static ASMCTX SDI * sdi;		// All SDIs, in order of appearance
+static ASMCTX int sdialloc;	// # of SDI records allocated
+static ASMCTX int sdicount;	// # of SDIs known from previous passes
+static ASMCTX int sdicur;		// # of SDIs seen so far in this pass
+static ASMCTX int abandoned;	// 1, relaxation has been given up
+
+
+//
+// Initialize relaxation for a new pass
+//
+void InitRelax(void)
+{
+	sdicur = 0;
+}
+
+
+//
+// Forget everything the passes of a previous assembly found out
+//
+void RelaxReset(void)
+{
+	free(sdi);
+	sdi = NULL;
+	sdialloc = 0;
+	abandoned = 0;
+	sdicount = 0;
+	sdicur = 0;
+}
+
+
+//
+// Announce the next span-dependent instruction. Returns the SDI's number, or
+// -1 if it's not to be relaxed (and the long form should be used). Must be
+// called before anything gets deposited for the instruction.
+//
+int RelaxSite(int kind)
+{
+	SDI * s;
+
+	if (!relax_flag || abandoned)
+		return -1;
+
+	if (sdicur < sdicount)
+	{
+		s = &sdi[sdicur];
+
+		// Not the same SDI as the last pass saw in this spot
+		if (s->kind != kind || s->fileno != cfileno || s->lineno != curlineno)
+		{
+			RelaxAbandon();
+			return -1;
+		}
+	}
+	else
+	{
+		if (sdicount == sdialloc)
+		{
+			sdialloc = (sdialloc ? sdialloc * 2 : 256);
+			sdi = realloc(sdi, sdialloc * sizeof(SDI));
+
+			if (sdi == NULL)
+				fatal("out of memory for relaxation");
+		}
+
+		s = &sdi[sdicount++];
+		s->kind = kind;
+		s->state = SDI_LONG;
+		s->fileno = cfileno;
+		s->lineno = curlineno;
+	}
+
+	s->sno = cursect;
+	s->loc = sloc;
+	s->fixup = NULL;
+
+	return sdicur++;
+}
+
+
+//
+// Return the state of SDI 'n' (as returned by RelaxSite())
+//
+int RelaxState(int n)
+{
+	return (n < 0 ? SDI_LOCKED : sdi[n].state);
+}
+
+
+//
+// Tie the fixup just made to SDI 'n'
+//
+void RelaxFixup(int n)
+{
+	if (n >= 0)
+		sdi[n].fixup = sect[cursect].sfix;
+}
+
+
+//
+// Give up on relaxation; everything gets assembled in its long form
+//
+void RelaxAbandon(void)
+{
+	abandoned = 1;
+}
+
+
+//
+// Evaluate the target of an SDI. Returns its attributes, or 0 if it can't be
+// evaluated.
+//
+static WORD SDITarget(SDI * s, uint64_t * eval)
+{
+	WORD eattr;
+	SYM * esym = NULL;
+
+	if (EvalFixup(s->fixup, eval, &eattr, &esym) != OK)
+		return 0;
+
+	return eattr;
+}
+
+
+//
+// Decide the SDI sizes for the next pass from the outcome of this one.
+// Returns 1 if anything changed (and another pass is needed).
+//
+int RelaxUpdate(void)
+{
+	int changed = 0;
+	uint64_t eval;
+
+	if (abandoned)
+	{
+		// One more pass is needed to get rid of any short forms, unless the
+		// last pass didn't use any
+		changed = (sdicount > 0);
+		sdicount = 0;
+		return changed;
+	}
+
+	// Fewer SDIs than the last time around
+	if (sdicur != sdicount)
+	{
+		RelaxAbandon();
+		return RelaxUpdate();
+	}
+
+	for(int i=0; i<sdicount; i++)
+	{
+		SDI * s = &sdi[i];
+
+		if (s->state == SDI_LOCKED || s->fixup == NULL)
+			continue;
+
+		WORD eattr = SDITarget(s, &eval);
+		int ok = ((eattr & DEFINED) != 0);
+		int32_t disp = 0;
+
+		switch (s->kind)
+		{
+		case SDI_BRANCH:
+			// Target has to be in the branch's own section
+			ok = ok && ((eattr & TDB) == s->sno);
+			disp = (int32_t)(eval - (s->loc + 2));
+
+			// Going short, the branch loses its extension word, which brings
+			// any forward target 2 bytes closer
+			if (s->state != SDI_SHORT && disp > 0)
+				disp -= 2;
+
+			// Null branches can't be short
+			ok = ok && (disp != 0) && ((disp + 0x80) < 0x100);
+			break;
+
+		case SDI_PCDISP:
+			// Target has to be in the operand's own section
+			ok = ok && ((eattr & TDB) == s->sno);
+			disp = (int32_t)(eval - s->fixup->loc);
+
+			// Going short, the extension shrinks from a long to a word
+			if (s->state != SDI_SHORT && disp > 0)
+				disp -= 2;
+
+			ok = ok && (((uint32_t)disp + 0x8000) < 0x10000);
+			break;
+
+		case SDI_ABSW:
+			// Address has to be absolute and sign-extendable from a word,
+			// either as a 32-bit or a 64-bit value
+			ok = ok && !(eattr & TDB) && (((eval + 0x8000) < 0x10000)
+				|| (!(eval >> 32) && (((uint32_t)eval + 0x8000) < 0x10000)));
+			break;
+		}
+
+		if (s->state == SDI_SHORT)
+		{
+			// Short forms that don't fit anymore go back to long, for good
+			if (!ok)
+			{
+				s->state = SDI_LOCKED;
+				changed = 1;
+			}
+		}
+		else if (ok)
+		{
+			s->state = SDI_SHORT;
+			changed = 1;
+		}
+	}
+
+	return changed;
+}
+
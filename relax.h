@@ -0,0 +1,42 @@
+//
+// RMAC - Renamed Macro Assembler for all Atari computers
+// RELAX.H - Span-Dependent Instruction Relaxation
+// Copyright (C) 199x Landon Dyer, 2011-2022 Reboot and Friends
+// RMAC derived from MADMAC v1.07 Written by Landon Dyer, 1986
+// Source utilised with the kind permission of Landon Dyer
+//
+
+#ifndef __RELAX_H__
+#define __RELAX_H__
+
+#include "rmac.h"
+#include "sect.h"
+
+// Span-dependent instruction kinds
+#define SDI_BRANCH      0			// Bcc/BSR: .w forward branch -> .s
+#define SDI_ABSW        1			// xxx.l forward reference -> xxx.w
+#define SDI_PCDISP      2			// xxx.l forward reference -> d16(PC)
+
+// Span-dependent instruction states
+#define SDI_LONG        0			// Long form, may be shortened
+#define SDI_SHORT       1			// Short form
+#define SDI_LOCKED      2			// Long form, never to be shortened again
+
+// Tunable definitions
+#define RELAX_MAXPASS   32			// Give up relaxing after this many passes
+
+// Exported variables
+extern ASMCTX int relax_flag;
+extern ASMCTX int relax_pass;
+
+// Exported functions
+void InitRelax(void);
+void RelaxReset(void);
+int RelaxSite(int);
+int RelaxState(int);
+void RelaxFixup(int);
+int RelaxUpdate(void);
+void RelaxAbandon(void);
+
+#endif // __RELAX_H__
+
@@ -42,12 +42,12 @@ if ((x == ERROR) || (ErrorIfNotAtEOL() == ERROR)) \
 if (ErrorIfNotAtEOL() == ERROR) \
 	return ERROR;
 
-unsigned altbankok = 0;		// Ok to use alternate register bank
-unsigned orgactive = 0;		// RISC/6502 org directive active
-unsigned orgaddr = 0;		// Org'd address
-unsigned orgwarning = 0;	// Has an ORG warning been issued
-int lastOpcode = -1;		// Last RISC opcode assembled
-uint8_t riscImmTokenSeen;	// The '#' (immediate) token was seen
+ASMCTX unsigned altbankok = 0;		// Ok to use alternate register bank
+ASMCTX unsigned orgactive = 0;		// RISC/6502 org directive active
+ASMCTX unsigned orgaddr = 0;		// Org'd address
+ASMCTX unsigned orgwarning = 0;	// Has an ORG warning been issued
+ASMCTX int lastOpcode = -1;		// Last RISC opcode assembled
+ASMCTX uint8_t riscImmTokenSeen;	// The '#' (immediate) token was seen
 
 static const char reg_err[] = "missing register R0...R31";
 
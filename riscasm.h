@@ -35,11 +35,11 @@
 #define CHECK_COMMA  if (*tok++ != ',') { return error(comma_error); }
 
 // Globals, externals etc
-extern unsigned orgactive;
-extern unsigned orgaddr;
-extern unsigned orgwarning;
-extern unsigned altbankok;
-extern uint8_t riscImmTokenSeen;
+extern ASMCTX unsigned orgactive;
+extern ASMCTX unsigned orgaddr;
+extern ASMCTX unsigned orgwarning;
+extern ASMCTX unsigned altbankok;
+extern ASMCTX uint8_t riscImmTokenSeen;
 
 // Prototypes
 int GenerateRISCCode(int);
@@ -0,0 +1,558 @@
+#ifdef DEF_MR
+/*
+ *  Keyword definitions
+ */
+#define	MR__56001	64
+#define	MR__6502	2
+#define	MR__68000	3
+#define	MR__68020	58
+#define	MR__68030	59
+#define	MR__68040	60
+#define	MR__68060	61
+#define	MR__68881	62
+#define	MR__68882	63
+#define	MR__ABS	7
+#define	MR__ALIGN	69
+#define	MR__ASSERT	28
+#define	MR__BSS	4
+#define	MR__CARGS	10
+#define	MR__CCUNDEF	51
+#define	MR__COMM	8
+#define	MR__CSTRUCT	53
+#define	MR__DATA	5
+#define	MR__DC	12
+#define	MR__DCB	17
+#define	MR__DISABLE	22
+#define	MR__DPHRASE	42
+#define	MR__DS	13
+#define	MR__DSM	68
+#define	MR__DSP	16
+#define	MR__DUMP	20
+#define	MR__EJECT	46
+#define	MR__ELSE	501
+#define	MR__ENABLE	23
+#define	MR__END	34
+#define	MR__ENDC	502
+#define	MR__ENDIF	502
+#define	MR__ENDM	505
+#define	MR__ENDR	507
+#define	MR__EQU	18
+#define	MR__EQURUNDEF	50
+#define	MR__ERROR	47
+#define	MR__EVEN	1
+#define	MR__EXITM	510
+#define	MR__EXTERN	24
+#define	MR__GLOBL	24
+#define	MR__GOTO	11
+#define	MR__GPU	15
+#define	MR__GPUMAIN	56
+#define	MR__IF	500
+#define	MR__IIF	503
+#define	MR__INCBIN	21
+#define	MR__INCLUDE	33
+#define	MR__INIT	9
+#define	MR__JPAD	54
+#define	MR__LIST	38
+#define	MR__LONG	40
+#define	MR__MACRO	504
+#define	MR__MACUNDEF	14
+#define	MR__NLIST	39
+#define	MR__NOCLEAR	49
+#define	MR__NOFPU	65
+#define	MR__NOJPAD	55
+#define	MR__NOLIST	39
+#define	MR__OBJPROC	67
+#define	MR__OFFSET	7
+#define	MR__OPT	66
+#define	MR__ORG	0
+#define	MR__PHRASE	41
+#define	MR__PRGFLAGS	57
+#define	MR__PRINT	52
+#define	MR__QPHRASE	43
+#define	MR__REGBANK0	25
+#define	MR__REGBANK1	26
+#define	MR__REGUNDEF	50
+#define	MR__REPT	506
+#define	MR__SUBTTL	45
+#define	MR__TABLE	70
+#define	MR__TEXT	6
+#define	MR__TITLE	44
+#define	MR__UNDEFMAC	14
+#define	MR__WARN	48
+#define	MR_ABS	3022
+#define	MR_ADD	3000
+#define	MR_ADDC	3001
+#define	MR_ADDQ	3002
+#define	MR_ADDQMOD	3058
+#define	MR_ADDQT	3003
+#define	MR_AND	3009
+#define	MR_ASSERT	28
+#define	MR_BCLR	3015
+#define	MR_BSET	3014
+#define	MR_BSS	4
+#define	MR_BTST	3013
+#define	MR_CARGS	10
+#define	MR_CCUNDEF	51
+#define	MR_CMP	3031
+#define	MR_CMPQ	3032
+#define	MR_COMM	8
+#define	MR_CSTRUCT	53
+#define	MR_DATA	5
+#define	MR_DC	12
+#define	MR_DCB	17
+#define	MR_DISABLE	22
+#define	MR_DIV	3021
+#define	MR_DPHRASE	42
+#define	MR_DS	13
+#define	MR_DSM	68
+#define	MR_DUMP	20
+#define	MR_EJECT	46
+#define	MR_ELSE	501
+#define	MR_ENABLE	23
+#define	MR_END	34
+#define	MR_ENDC	502
+#define	MR_ENDIF	502
+#define	MR_ENDM	505
+#define	MR_ENDR	507
+#define	MR_EQU	18
+#define	MR_EQURUNDEF	50
+#define	MR_ERROR	47
+#define	MR_EVEN	1
+#define	MR_EXITM	510
+#define	MR_EXTERN	24
+#define	MR_GLOBL	24
+#define	MR_GOTO	11
+#define	MR_GPUMAIN	56
+#define	MR_IF	500
+#define	MR_IIF	503
+#define	MR_IMACN	3020
+#define	MR_IMULT	3017
+#define	MR_IMULTN	3018
+#define	MR_INCBIN	21
+#define	MR_INCLUDE	33
+#define	MR_INIT	9
+#define	MR_JPAD	54
+#define	MR_JR	3050
+#define	MR_JUMP	3049
+#define	MR_LIST	38
+#define	MR_LOAD	3060
+#define	MR_LOADB	3041
+#define	MR_LOADP	3043
+#define	MR_LOADW	3042
+#define	MR_LONG	40
+#define	MR_MACRO	504
+#define	MR_MACUNDEF	14
+#define	MR_MIRROR	3048
+#define	MR_MMULT	3051
+#define	MR_MOVE	3059
+#define	MR_MOVEFA	3039
+#define	MR_MOVEI	3040
+#define	MR_MOVEQ	3037
+#define	MR_MOVETA	3038
+#define	MR_MTOI	3052
+#define	MR_MULT	3016
+#define	MR_NEG	3008
+#define	MR_NLIST	39
+#define	MR_NOCLEAR	49
+#define	MR_NOFPU	65
+#define	MR_NOJPAD	55
+#define	MR_NOLIST	39
+#define	MR_NOP	3054
+#define	MR_NORMI	3053
+#define	MR_NOT	3012
+#define	MR_OFFSET	7
+#define	MR_OPT	66
+#define	MR_OR	3010
+#define	MR_ORG	0
+#define	MR_PACK	3057
+#define	MR_PHRASE	41
+#define	MR_PRGFLAGS	57
+#define	MR_PRINT	52
+#define	MR_QPHRASE	43
+#define	MR_REGUNDEF	50
+#define	MR_REPT	506
+#define	MR_RESMAC	3019
+#define	MR_ROLQ	3030
+#define	MR_ROR	3028
+#define	MR_RORQ	3029
+#define	MR_SAT16	3035
+#define	MR_SAT16S	3036
+#define	MR_SAT24	3055
+#define	MR_SAT32S	3044
+#define	MR_SAT8	3033
+#define	MR_SH	3023
+#define	MR_SHA	3026
+#define	MR_SHARQ	3027
+#define	MR_SHLQ	3024
+#define	MR_SHRQ	3025
+#define	MR_STORE	3061
+#define	MR_STOREB	3045
+#define	MR_STOREP	3047
+#define	MR_STOREW	3046
+#define	MR_SUB	3004
+#define	MR_SUBC	3005
+#define	MR_SUBQ	3006
+#define	MR_SUBQMOD	3034
+#define	MR_SUBQT	3007
+#define	MR_SUBTTL	45
+#define	MR_TEXT	6
+#define	MR_TITLE	44
+#define	MR_UNDEFMAC	14
+#define	MR_UNPACK	3056
+#define	MR_WARN	48
+#define	MR_XOR	3011
+#endif
+
+#ifdef DECL_MR
+/*
+ *  keyword state-machine tables
+ *
+ */
+
+int mrbase[467] = {
+ 0, 24, 44, 32, 52, 53, 63, 45,
+ 70, 70, 55, 81, 88, 89, 91, 6,
+ 44, 96, 101, 16, 5, 17, 0, 0,
+ 96, 31, 110, 111, 121, 106, 128, 50,
+ 131, 7, 111, 142, 60, 73, 6, 98,
+ 146, 110, 127, 117, 137, 145, 131, 140,
+ 148, 135, 138, 136, 143, 148, 142, 143,
+ 162, 146, 158, 156, 157, 166, 153, 172,
+ 153, 157, 172, 169, 164, 160, 160, 176,
+ 182, 181, 184, 173, 168, 187, 188, 174,
+ 172, 172, 180, 184, 190, 189, 196, 194,
+ 184, 198, 204, 191, 204, 202, 208, 205,
+ 198, 218, 205, 219, 198, 205, 222, 210,
+ 211, 0, 1, 2, 212, 223, 214, 215,
+ 217, 216, 226, 220, 221, 240, 224, 236,
+ 232, 233, 242, 230, 249, 230, 234, 249,
+ 246, 241, 237, 237, 253, 258, 259, 243,
+ 249, 261, 256, 265, 259, 264, 252, 266,
+ 256, 269, 271, 273, 279, 280, 259, 264,
+ 281, 268, 284, 283, 272, 271, 272, 286,
+ 280, 278, 283, 279, 297, 298, 282, 286,
+ 300, 299, 303, 303, 289, 293, 295, 290,
+ 306, 311, 299, 302, 314, 306, 317, 300,
+ 318, 307, 304, 321, 319, 309, 310, 319,
+ 327, 324, 314, 316, 324, 321, 322, 330,
+ 327, 322, 331, 342, 338, 331, 328, 326,
+ 328, 336, 333, 334, 10, 334, 336, 337,
+ 337, 353, 337, 346, 354, 359, 347, 3,
+ 2, 17, 1, 355, 358, 357, 351, 353,
+ 349, 367, 368, 353, 356, 371, 370, 374,
+ 374, 360, 364, 366, 361, 377, 382, 370,
+ 373, 386, 369, 386, 371, 386, 376, 376,
+ 384, 383, 384, 392, 386, 384, 403, 399,
+ 392, 389, 406, 389, 390, 399, 392, 401,
+ 409, 401, 403, 399, 399, 415, 399, 419,
+ 421, 404, 413, 420, 407, 411, 417, 413,
+ 420, 432, 420, 415, 427, 416, 436, 424,
+ 426, 426, 422, 437, 424, 440, 426, 447,
+ 430, 441, 446, 434, 443, 436, 457, 446,
+ 460, 1, 10, 13, 445, 458, 451, 445,
+ 461, 461, 465, 15, 22, 24, 25, 26,
+ 27, 30, 455, 452, 453, 469, 453, 473,
+ 475, 457, 466, 473, 459, 463, 469, 465,
+ 472, 484, 477, 466, 473, 475, 470, 486,
+ 471, 492, 475, 477, 491, 478, 486, 479,
+ 499, 500, 488, 483, 499, 500, 500, 492,
+ 488, 504, 507, 499, 493, 508, 500, 501,
+ 507, 503, 504, 515, 516, 503, 521, 522,
+ 523, 521, 506, 507, 523, 528, 511, 527,
+ 529, 514, 515, 533, 521, 525, 525, 528,
+ 520, 536, 539, 531, 525, 540, 532, 533,
+ 539, 536, 547, 548, 552, 550, 535, 542,
+ 538, 554, 559, 542, 548, 559, 552, 552,
+ 562, 561, 548, 564, 565, 567, 558, 568,
+ 569, 557, 569, 572, 573, 575, 579, 575,
+ 562, 578, 579, 581, 572, 582, 583, 571,
+ 587, 584, 587, 582, 589, 594, 591, 591,
+ 579, 593, 597, 596, 596, 584, 33, 598,
+ 602, 600, 601
+};
+
+int mrtab[730] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, 1, -1,
+ 223, 224, 225, 323, -2, 106, 105, 393,
+ 107, 329, 226, 313, 314, 315, -2, 394,
+ -2, 324, -2, 325, 326, 327, -2, 328,
+ -2, -2, -2, -2, -1, 22, 23, -2,
+ -2, -2, -2, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 2, 3, 4, 5, 6, 103, 7,
+ 137, 8, 9, 147, 10, 11, 12, 13,
+ 14, 15, 16, 17, 18, 19, 93, 20,
+ 21, 24, 25, 26, 27, 28, 102, 29,
+ 104, 30, 31, 47, 32, 33, 34, 35,
+ 36, 37, 38, 39, 40, 41, 43, 42,
+ 44, 94, 111, 48, 49, 50, 55, 51,
+ 56, 68, 45, 95, 69, 70, 57, 46,
+ 76, 52, 134, 53, 144, 58, 77, 54,
+ 59, 61, 60, 62, -2, 63, 145, 71,
+ 64, 65, 78, 72, 73, 66, 74, 67,
+ -2, 146, 79, 75, 90, 84, 80, 87,
+ 81, 96, 108, 91, 85, 82, 83, 86,
+ 97, 88, 100, 89, 109, 92, 101, 112,
+ 116, 113, 117, 110, 98, 99, 129, 148,
+ 118, 130, 131, 138, 152, 114, 139, 119,
+ 153, 115, 120, 122, 121, 123, -2, 124,
+ -2, 132, 125, 126, 135, 154, 133, 127,
+ 140, 128, 136, 149, 141, -2, 155, 150,
+ 156, 157, 158, 151, 159, 160, 142, 161,
+ 143, 162, 163, 164, -2, 165, 166, -2,
+ -2, -2, 167, 168, 169, 170, 172, 173,
+ 171, 174, 175, 177, 178, 179, -2, 180,
+ 182, 184, 185, 186, 187, 176, 183, 189,
+ 190, 191, 192, 193, 194, -2, 195, 196,
+ 201, 188, 197, 181, -2, -2, 198, 202,
+ 199, 203, 206, 204, -2, 205, 200, 207,
+ -2, 210, 212, 213, 216, 217, 218, 211,
+ 208, 219, 220, 209, 222, -2, 214, -2,
+ 227, 228, -2, 229, 215, 230, 221, 231,
+ 232, 233, -2, 234, 235, -2, 236, 237,
+ -2, 238, 239, 241, 242, 240, 243, 244,
+ 246, 247, 248, -2, 251, 249, 252, 253,
+ 254, 255, 245, 250, 256, 260, 261, 257,
+ -2, -2, 262, 258, 263, 259, 264, 265,
+ 266, 268, 269, 270, 271, 272, 273, -2,
+ 275, 267, -2, -2, -2, 276, 277, -2,
+ -2, 278, -2, 279, 280, 274, -2, 281,
+ -2, 282, -2, 284, 285, -2, 286, 287,
+ 283, 288, -2, 289, -2, 290, 291, 292,
+ -2, -2, -2, -2, -2, 294, -2, 295,
+ 297, 293, 296, 298, 299, -2, -2, 300,
+ 301, 302, 303, 304, 305, 306, -2, 307,
+ 308, 309, 310, 311, -2, 312, -2, -2,
+ 316, -2, -2, 317, -2, -2, 320, 321,
+ 322, -2, 330, 331, 332, 333, -2, 334,
+ -2, 335, 318, 336, -2, 319, 337, -2,
+ 338, -2, 340, 341, -2, 342, 343, 339,
+ 344, -2, 345, -2, 346, -2, -2, -2,
+ -2, -2, 348, 350, 351, 349, 347, 352,
+ 353, 354, 355, 356, 357, 358, 359, 360,
+ 361, -2, 363, 364, -2, 365, 366, -2,
+ 367, 368, -2, 369, 370, 371, 372, -2,
+ -2, 373, -2, 362, 374, -2, -2, 375,
+ -2, 376, -2, 377, 378, 379, -2, -2,
+ 380, 381, -2, 382, -2, 384, -2, -2,
+ 385, 386, -2, 387, -2, 388, -2, 389,
+ -2, 383, 390, -2, 391, 392, -2, 395,
+ 396, 397, -2, 398, 399, -2, 400, -2,
+ -2, 401, 402, 403, 404, -2, 405, -2,
+ 406, -2, -2, 407, -2, 408, 409, 410,
+ -2, 411, -2, 412, -2, 413, 414, 415,
+ 416, 417, 418, -2, 419, 420, 421, 422,
+ -2, -2, 423, 424, -2, 425, 426, 427,
+ 428, -2, 429, -2, 430, -2, -2, 431,
+ 432, -2, -2, -2, 433, -2, -2, -2,
+ -2, 434, 435, 436, -2, -2, -2, -2,
+ 437, -2, 438, -2, -2, 439, 440, 441,
+ 442, -2, 443, -2, 444, -2, -2, 445,
+ 446, 447, -2, -2, -2, 448, -2, -2,
+ 449, 450, 451, 452, -2, 453, -2, -2,
+ -2, -2, -2, 454, -2, -2, 455, -2,
+ 456, -2, 457, -2, 458, -2, -2, -2,
+ -2, 459, -2, -2, 460, -2, -2, 461,
+ -2, 462, 463, 464, 465, -2, -2, -2,
+ -2, 466, -2, -2, -2, -2, -2, -2,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1
+};
+
+int mrcheck[730] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, 0, -1,
+ 105, 106, 107, 223, 224, 23, 22, 313,
+ 23, 226, 107, 212, 212, 212, 314, 315,
+ 323, 225, 212, 225, 225, 225, 324, 225,
+ 325, 326, 327, 328, -1, 1, 1, 329,
+ 329, 462, 462, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 0, 0, 0, 0, 0, 20, 0,
+ 33, 0, 0, 38, 0, 0, 0, 0,
+ 0, 0, 0, 0, 0, 0, 15, 0,
+ 0, 1, 1, 1, 1, 1, 19, 1,
+ 21, 1, 1, 3, 1, 1, 1, 1,
+ 1, 1, 1, 1, 1, 1, 2, 1,
+ 2, 16, 25, 3, 3, 4, 5, 4,
+ 5, 7, 2, 16, 7, 7, 5, 2,
+ 10, 4, 31, 4, 36, 5, 10, 4,
+ 5, 6, 5, 6, 8, 6, 36, 8,
+ 6, 6, 11, 8, 8, 6, 9, 6,
+ 9, 37, 11, 9, 14, 12, 11, 13,
+ 11, 17, 24, 14, 12, 11, 11, 12,
+ 17, 13, 18, 13, 24, 14, 18, 26,
+ 27, 26, 27, 24, 17, 17, 29, 39,
+ 27, 29, 29, 34, 41, 26, 34, 27,
+ 42, 26, 27, 28, 27, 28, 30, 28,
+ 43, 30, 28, 28, 32, 44, 30, 28,
+ 35, 28, 32, 40, 35, 45, 46, 40,
+ 47, 48, 49, 40, 50, 51, 35, 52,
+ 35, 53, 54, 55, 56, 57, 58, 48,
+ 57, 59, 60, 61, 62, 63, 64, 65,
+ 63, 66, 67, 68, 69, 70, 71, 72,
+ 73, 74, 75, 76, 77, 67, 73, 78,
+ 79, 80, 81, 82, 83, 84, 85, 86,
+ 87, 77, 86, 72, 88, 89, 86, 90,
+ 86, 91, 93, 92, 86, 92, 86, 94,
+ 86, 95, 96, 97, 98, 99, 100, 95,
+ 94, 101, 102, 94, 103, 104, 97, 108,
+ 109, 110, 111, 112, 97, 113, 102, 114,
+ 115, 116, 117, 118, 119, 120, 121, 122,
+ 120, 123, 124, 125, 126, 124, 127, 128,
+ 129, 130, 131, 132, 134, 133, 135, 136,
+ 137, 138, 128, 133, 139, 140, 141, 139,
+ 142, 143, 144, 139, 145, 139, 145, 146,
+ 147, 148, 149, 150, 151, 152, 153, 154,
+ 155, 147, 156, 157, 158, 159, 160, 161,
+ 162, 163, 164, 165, 166, 154, 167, 168,
+ 169, 170, 171, 172, 173, 174, 175, 176,
+ 171, 177, 178, 179, 171, 180, 181, 182,
+ 183, 171, 184, 185, 186, 187, 188, 189,
+ 190, 182, 189, 191, 192, 193, 194, 195,
+ 196, 197, 198, 199, 200, 201, 202, 203,
+ 204, 205, 206, 207, 208, 209, 210, 211,
+ 213, 214, 215, 216, 217, 218, 219, 220,
+ 221, 222, 227, 228, 229, 230, 231, 232,
+ 233, 234, 217, 235, 236, 217, 237, 238,
+ 239, 240, 241, 242, 243, 244, 245, 240,
+ 246, 247, 248, 240, 249, 250, 251, 252,
+ 240, 253, 254, 255, 256, 254, 249, 257,
+ 258, 259, 260, 261, 262, 263, 264, 265,
+ 266, 267, 268, 269, 270, 271, 272, 273,
+ 274, 275, 276, 277, 278, 279, 280, 274,
+ 281, 282, 283, 266, 284, 285, 286, 287,
+ 288, 289, 290, 291, 292, 293, 294, 295,
+ 296, 297, 298, 299, 300, 301, 299, 302,
+ 303, 304, 305, 306, 294, 307, 299, 308,
+ 309, 299, 310, 294, 311, 312, 316, 317,
+ 318, 319, 320, 321, 322, 330, 331, 318,
+ 332, 333, 334, 335, 336, 337, 338, 339,
+ 340, 341, 342, 343, 344, 345, 346, 347,
+ 348, 349, 350, 351, 352, 353, 354, 355,
+ 356, 357, 358, 359, 360, 361, 362, 363,
+ 364, 365, 366, 367, 368, 369, 370, 371,
+ 372, 373, 374, 375, 376, 377, 378, 379,
+ 380, 381, 382, 383, 384, 385, 386, 387,
+ 388, 389, 390, 391, 392, 393, 394, 395,
+ 396, 397, 398, 399, 400, 401, 402, 403,
+ 404, 405, 406, 407, 408, 395, 409, 410,
+ 411, 412, 413, 414, 395, 415, 416, 417,
+ 418, 419, 420, 421, 422, 423, 424, 425,
+ 426, 427, 428, 429, 430, 431, 432, 433,
+ 434, 435, 436, 437, 438, 439, 440, 441,
+ 442, 443, 444, 445, 446, 447, 448, 449,
+ 450, 451, 452, 453, 454, 455, 456, 457,
+ 458, 459, 460, 461, 463, 464, 465, 466,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1
+};
+
+int mraccept[730] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, 2, -1, -1, 3035,
+ -1, -1, -1, -1, -1, -1, 3055, -1,
+ 64, -1, 3033, -1, -1, -1, 3, -1,
+ 58, 59, 60, 61, -1, -1, -1, 62,
+ 63, 25, 26, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ 12, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ 13, -1, -1, -1, 500, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ 3050, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ 3023, -1, -1, 3010, -1, -1, -1, -1,
+ -1, -1, 12, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, 13, -1, -1, -1, 500, -1,
+ 3022, -1, -1, -1, -1, 3000, -1, -1,
+ -1, -1, -1, -1, -1, 3009, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, 3031,
+ -1, -1, -1, -1, 17, -1, -1, 4,
+ 3021, 68, -1, -1, -1, -1, 18, -1,
+ 34, -1, -1, -1, -1, -1, 503, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, 3008, -1, -1,
+ -1, -1, -1, -1, 66, 0, -1, -1,
+ -1, -1, -1, -1, 3054, -1, -1, -1,
+ 3012, -1, -1, 3026, -1, 3004, -1, 3028,
+ -1, -1, -1, -1, -1, 3011, -1, 7,
+ -1, -1, 4, -1, -1, -1, -1, -1,
+ -1, -1, 17, -1, -1, 68, -1, -1,
+ 16, -1, -1, 18, -1, 34, -1, -1,
+ -1, -1, 15, 503, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ 66, 0, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, 3001,
+ -1, -1, 3015, 3014, 3013, -1, -1, 3032,
+ 8, -1, 5, -1, -1, 3002, 20, -1,
+ 501, -1, 502, -1, -1, 1, -1, -1,
+ -1, -1, 11, -1, 505, -1, -1, -1,
+ 9, 507, 54, 3049, 38, 3060, 40, -1,
+ -1, -1, -1, -1, 3059, 3052, 3016, -1,
+ -1, -1, -1, -1, -1, -1, 3057, -1,
+ -1, -1, -1, -1, 506, -1, 3030, 3029,
+ -1, 3024, 3025, -1, 3005, 6, -1, -1,
+ -1, 48, -1, -1, -1, -1, 8, -1,
+ 5, -1, 3006, -1, 20, -1, -1, 501,
+ -1, 502, -1, -1, 1, -1, -1, -1,
+ -1, 11, -1, 505, -1, 9, 54, 38,
+ 507, 40, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 506, -1, -1, 6, -1, -1, 48,
+ -1, -1, 10, -1, -1, -1, -1, 3003,
+ 46, -1, 502, -1, -1, 47, 510, -1,
+ 24, -1, 3020, 3017, -1, -1, 3041, 504,
+ -1, -1, 3051, -1, 39, -1, 3040, 65,
+ -1, -1, 3053, -1, 3043, -1, 3037, -1,
+ 52, -1, -1, 3042, -1, -1, 3027, 3061,
+ -1, -1, 44, -1, -1, 69, -1, 3007,
+ 10, -1, -1, -1, -1, 46, -1, 502,
+ -1, 47, 510, -1, 24, -1, -1, -1,
+ 504, -1, 39, -1, 65, -1, -1, -1,
+ -1, -1, -1, 52, -1, -1, -1, -1,
+ 70, 44, -1, -1, 28, -1, -1, -1,
+ -1, 23, -1, 24, -1, 3018, 21, -1,
+ -1, 3048, 3039, 3038, -1, 55, 39, 7,
+ 41, -1, -1, -1, 3019, 3036, 3044, 3045,
+ -1, 45, -1, 3056, 28, -1, -1, -1,
+ -1, 23, -1, 24, -1, 3047, 21, -1,
+ -1, -1, 55, 39, 3046, -1, 7, 41,
+ -1, -1, -1, -1, 45, -1, 3058, 51,
+ 53, 22, 42, -1, 56, 33, -1, 49,
+ -1, 43, -1, 3034, -1, 51, 53, 22,
+ 42, -1, 56, 33, -1, 49, 67, -1,
+ 43, -1, -1, -1, -1, 14, 57, 50,
+ 14, -1, 14, 57, 50, 14, 50, 50,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1
+};
+#endif
@@ -8,60 +8,74 @@
 
 #include "rmac.h"
 #include "6502.h"
+#include "cache.h"
 #include "debug.h"
+#include "depend.h"
 #include "direct.h"
 #include "dsp56k.h"
 #include "error.h"
 #include "expr.h"
+#include "librmac.h"
 #include "listing.h"
+#include "mach.h"
 #include "mark.h"
 #include "macro.h"
 #include "object.h"
 #include "procln.h"
+#include "relax.h"
 #include "riscasm.h"
 #include "sect.h"
+#include "server.h"
 #include "symbol.h"
 #include "token.h"
 #include "version.h"
-
-int perm_verb_flag;				// Permanently verbose, interactive mode
-int list_flag;					// "-l" listing flag on command line
-int list_pag = 1;				// Enable listing pagination by default
-int verb_flag;					// Be verbose about what's going on
-int m6502;						// 1, assembling 6502 code
-int glob_flag;					// Assume undefined symbols are global
-int lsym_flag;					// Include local symbols in object file (ALWAYS true)
-int dsym_flag;					// Gen debug syms (Requires obj_format = BSD)
-int optim_warn_flag;			// Warn about possible short branches
-int prg_flag;					// !=0, produce .PRG executable (2=symbols)
-int prg_extend;					// !=0, output extended .PRG symbols
-int legacy_flag;				// Do stuff like insert code in RISC assembler
-int obj_format;					// Object format flag
-int debug;						// [1..9] Enable debugging levels
-int err_flag;					// '-e' specified
-int err_fd;						// File to write error messages to
-int rgpu, rdsp;					// Assembling Jaguar GPU or DSP code
-int robjproc;					// Assembling Jaguar Object Processor code
-int dsp56001;					// Assembling DSP 56001 code
-int list_fd;					// File to write listing to
-int segpadsize;					// Segment padding size
-int endian;						// Host processor endianess (0 = LE, 1 = BE)
-int *regbase;					// Points to current DFA register table (base)
-int *regtab;					// Points to current DFA register table (tab)
-int *regcheck;					// Points to current DFA register table (check)
-int *regaccept;					// Points to current DFA register table (accept)
-char * objfname;				// Object filename pointer
-char * firstfname;				// First source filename
-char * cmdlnexec;				// Executable name, pointer to ARGV[0]
-char searchpatha[512] = { 0 };	// Buffer to hold searchpath when specified
-char * searchpath = NULL;		// Search path for include files
+#include "watch.h"
+
+#if !defined(WIN32) && !defined(WIN64)
+#include <poll.h>
+#include <sys/wait.h>
+#endif
+
+ASMCTX int perm_verb_flag;				// Permanently verbose, interactive mode
+ASMCTX int list_flag;					// "-l" listing flag on command line
+ASMCTX int list_pag = 1;				// Enable listing pagination by default
+ASMCTX int list_json;					// 1, write machine readable (NDJSON) listing
+ASMCTX int verb_flag;					// Be verbose about what's going on
+ASMCTX int m6502;						// 1, assembling 6502 code
+ASMCTX int glob_flag;					// Assume undefined symbols are global
+ASMCTX int lsym_flag;					// Include local symbols in object file (ALWAYS true)
+ASMCTX int dsym_flag;					// Gen debug syms (Requires obj_format = BSD)
+ASMCTX int optim_warn_flag;			// Warn about possible short branches
+ASMCTX int prg_flag;					// !=0, produce .PRG executable (2=symbols)
+ASMCTX int prg_extend;					// !=0, output extended .PRG symbols
+ASMCTX int legacy_flag;				// Do stuff like insert code in RISC assembler
+ASMCTX int obj_format;					// Object format flag
+ASMCTX int debug;						// [1..9] Enable debugging levels
+ASMCTX int err_flag;					// '-e' specified
+ASMCTX int err_fd;						// File to write error messages to
+ASMCTX int rgpu, rdsp;					// Assembling Jaguar GPU or DSP code
+ASMCTX int robjproc;					// Assembling Jaguar Object Processor code
+ASMCTX int dsp56001;					// Assembling DSP 56001 code
+ASMCTX int list_fd;					// File to write listing to
+ASMCTX int segpadsize;					// Segment padding size
+ASMCTX int endian;						// Host processor endianess (0 = LE, 1 = BE)
+ASMCTX int *regbase;					// Points to current DFA register table (base)
+ASMCTX int *regtab;					// Points to current DFA register table (tab)
+ASMCTX int *regcheck;					// Points to current DFA register table (check)
+ASMCTX int *regaccept;					// Points to current DFA register table (accept)
+ASMCTX char * objfname;				// Object filename pointer
+ASMCTX char * firstfname;				// First source filename
+ASMCTX char * cmdlnexec;				// Executable name, pointer to ARGV[0]
+ASMCTX char searchpatha[512] = { 0 };	// Buffer to hold searchpath when specified
+ASMCTX char * searchpath = NULL;		// Search path for include files
 char defname[] = "noname.o";	// Default output filename
-int optim_flags[OPT_COUNT_ALL] = { 0 };	// Specific optimisations on/off matrix
-int activecpu = CPU_68000;		// Active 68k CPU (68000 by default)
-int activefpu = FPU_NONE;		// Active FPU (none by default)
-int org68k_active = 0;			// .org switch for 68k (only with RAW output format)
-uint32_t org68k_address;		// .org for 68k
-int correctMathRules;			// 1, use C operator precedence in expressions
+ASMCTX int optim_flags[OPT_COUNT_ALL] = { 0 };	// Specific optimisations on/off matrix
+ASMCTX int activecpu = CPU_68000;		// Active 68k CPU (68000 by default)
+ASMCTX int activefpu = FPU_NONE;		// Active FPU (none by default)
+ASMCTX int org68k_active = 0;			// .org switch for 68k (only with RAW output format)
+ASMCTX uint32_t org68k_address;		// .org for 68k
+ASMCTX int correctMathRules;			// 1, use C operator precedence in expressions
+ASMCTX int fixup_threads;				// # of threads to evaluate fixups on
 
 //
 // Convert a string to uppercase
@@ -170,8 +184,11 @@ void DisplayHelp(void)
 		"                    r: absolute address\n"
 		"  -g                Output source level debug information (BSD object only)\n"
 		"  -i[path]          Directory to search for include files\n"
+		"  -j[jobs]          Assemble each source file into its own object file,\n"
+		"                    this many at once (default: one per processor)\n"
 		"  -l[filename]      Create an output listing file\n"
 		"  -l*[filename]     Create an output listing file without pagination\n"
+		"  -l+[filename]     Create a machine readable (NDJSON) listing file\n"
 		"  -m[cpu]           Select default CPU. Available options:\n"
 		"                    68000, 68020, 68030, 68040, 68060, 6502, tom, jerry, 56001\n"
 		"  -n                Don't do things behind your back in RISC assembler\n"
@@ -191,6 +208,8 @@ void DisplayHelp(void)
 		"                    o10: 56001 Use short format for immediate values if possible\n"
 		"                    o11: 56001 Auto convert short addressing mode to long (default: on)\n"
 		"                    o30: Enforce PC relative (alternative name: op)\n"
+		"                    o31: Absolute long source operands to PC relative\n"
+		"                         (alternative name: opc)\n"
 		"  ~o[value]         Turn a specific optimisation off\n"
 		"  +oall             Turn all optimisations on\n"
 		"  ~oall             Turn all optimisations off\n"
@@ -210,6 +229,21 @@ void DisplayHelp(void)
 		"  -x                Turn on debugging mode\n"
 		"  -y[pagelen]       Set page line length (default: 61)\n"
 		"  -4                Use C style operator precedence\n"
+		"  --relax           Shorten forward branches (needs o2) using extra\n"
+		"                    sizing passes\n"
+		"  --fixup-threads=n Evaluate fixup expressions on n threads\n"
+		"  --cache=dir       Keep outputs in dir, to be reused when the same\n"
+		"                    assembly is done again with the same inputs\n"
+		"  --cache-size=n    Limit the cache to n megabytes (default: 256)\n"
+		"  --cache-stats=dir Show the cache's hits and misses\n"
+		"  --server=socket   Stay resident, doing the assemblies asked for by\n"
+		"                    rmac --connect=socket (must be the first option)\n"
+		"  --connect=socket  Have the rmac server on socket do the assembly\n"
+		"                    (must be the first option)\n"
+		"  --watch           Assemble again whenever a file read changes\n"
+		"                    (must be the first option)\n"
+		"  --snapshots       With --watch, pick up from the last .include\n"
+		"                    before the first changed file\n"
 		"\n", cmdlnexec);
 }
 
@@ -255,7 +289,13 @@ int ParseOptimization(char * optstring)
 		}
 		else if (optstring[1] == 'o' || optstring[1] == 'O') // Turn on specific optimisation
 		{
-			if (optstring[2] == 'p' || optstring[2] == 'P')
+			if ((optstring[2] == 'p' || optstring[2] == 'P')
+				&& (optstring[3] == 'c' || optstring[3] == 'C'))
+			{
+				optim_flags[OPT_PC_CONVERT] = onoff;
+				optstring += 4;
+			}
+			else if (optstring[2] == 'p' || optstring[2] == 'P')
 			{
 				optim_flags[OPT_PC_RELATIVE] = onoff;
 				optstring += 3;
@@ -264,7 +304,8 @@ int ParseOptimization(char * optstring)
 			{
 				int opt_no = atoi(&optstring[2]);
 
-				if ((opt_no >= 0) && (opt_no < OPT_COUNT))
+				if (((opt_no >= 0) && (opt_no < OPT_COUNT))
+					|| (opt_no == OPT_PC_RELATIVE) || (opt_no == OPT_PC_CONVERT))
 				{
 					optim_flags[opt_no] = onoff;
 					optstring += 3;
@@ -355,6 +396,7 @@ int Process(int argc, char ** argv)
 	debug = 0;						// Initialize debug flag
 	objfname = NULL;				// Initialize object filename
 	list_fname = NULL;				// Initialize listing filename
+	list_json = 0;					// Initialize listing format
 	err_fname = NULL;				// Initialize error filename
 	obj_format = BSD;				// Initialize object format
 	firstfname = NULL;				// Initialize first filename
@@ -376,6 +418,23 @@ int Process(int argc, char ** argv)
 	regcheck = reg68check;			// Idem
 	regaccept = reg68accept;		// Idem
     correctMathRules = 0;			// respect operator precedence
+	legacy_flag = 1;				// Default is legacy mode on (:-P)
+	activecpu = CPU_68000;			// Initialize 68k CPU
+	activefpu = FPU_NONE;			// Initialize 68k FPU
+	org68k_active = 0;				// No 68k .org seen yet
+	dsp56001 = 0;					// Not assembling 56001 code
+	dsp_currentorg = &dsp_orgmap[0];	// Initialize 56001 org map
+	dsp_written_data_in_current_org = 0;
+	searchpatha[0] = EOS;			// Initialize include search path
+	searchpath = NULL;				// Idem
+	fixup_threads = 1;				// Evaluate fixups on this thread only
+	largestAlign[0] = largestAlign[1] = largestAlign[2] = 2;
+
+	// Initialize optimisations (56001 short immediates ensure compatibility
+	// with Motorola's 56k assembler)
+	memset(optim_flags, 0, sizeof(optim_flags));
+	optim_flags[OPT_56K_SHORT] = 1;
+
 	// Initialize modules
 	InitSymbolTable();				// Symbol table
 	InitTokenizer();				// Tokenizer
@@ -386,6 +445,8 @@ int Process(int argc, char ** argv)
 	InitMacro();					// Macro processor
 	InitListing();					// Listing generator
 	Init6502();						// 6502 assembler
+	InitRelax();					// Span-dependent instruction relaxation
+	InitDepend();					// Dependency graph of equates & fixups
 
 	// Process command line arguments and assemble source files
 	for(argno=0; argno<argc; argno++)
@@ -399,27 +460,32 @@ int Process(int argc, char ** argv)
                           break;
 			case 'd':				// Define symbol
 			case 'D':
-				for(s=argv[argno]+2; *s!=EOS;)
+				// Copy the symbol name, leaving argv alone as it gets parsed
+				// again on every pass
+				for(s=argv[argno]+2, i=0; *s!=EOS && i<FNSIZ-1;)
 				{
 					if (*s++ == '=')
-					{
-						s[-1] = EOS;
 						break;
-					}
+
+					fnbuf[i++] = s[-1];
 				}
 
-				if (argv[argno][2] == EOS)
+				fnbuf[i] = EOS;
+
+				if (fnbuf[0] == EOS)
 				{
-					printf("-d: empty symbol\n");
+					if (!relax_pass)
+						printf("-d: empty symbol\n");
+
 					errcnt++;
 					return errcnt;
 				}
 
-				sy = lookup((uint8_t *)argv[argno] + 2, 0, 0);
+				sy = lookup((uint8_t *)fnbuf, 0, 0);
 
 				if (sy == NULL)
 				{
-				  sy = NewSymbol((uint8_t *)argv[argno] + 2, LABEL, 0);
+				  sy = NewSymbol((uint8_t *)fnbuf, LABEL, 0);
 					sy->svalue = 0;
 				}
 
@@ -464,7 +530,9 @@ int Process(int argc, char ** argv)
                     obj_format = RAW;
                     break;
 				default:
-					printf("-f: unknown object format specified\n");
+					if (!relax_pass)
+						printf("-f: unknown object format specified\n");
+
 					errcnt++;
 					return errcnt;
 				}
@@ -491,7 +559,9 @@ int Process(int argc, char ** argv)
 
 						if (test == NULL)
 						{
-							printf("Invalid include path: %s\n", current_path);
+							if (!relax_pass)
+								printf("Invalid include path: %s\n", current_path);
+
 							errcnt++;
 							return errcnt;
 						}
@@ -510,11 +580,29 @@ int Process(int argc, char ** argv)
 					list_fname = argv[argno] + 3;
 					list_pag = 0;    // Special case - turn off pagination
 				}
+				else if (*(argv[argno] + 2) == '+')
+				{
+					list_fname = argv[argno] + 3;
+					list_pag = 0;
+					list_json = 1;	// Records don't carry source text, so
+									// no need to save lines
+					if (!relax_pass)
+					{
+						listing = 1;
+						list_flag = 1;
+					}
+
+					break;
+				}
 				else
 				{
 					list_fname = argv[argno] + 2;
 				}
 
+				// No listing from sizing passes
+				if (relax_pass)
+					break;
+
 				listing = 1;
 				list_flag = 1;
 				lnsave++;
@@ -545,7 +633,9 @@ int Process(int argc, char ** argv)
 					d_dsp();
 				else
 				{
-					printf("Unrecognized CPU '%s'\n", argv[argno] + 2);
+					if (!relax_pass)
+						printf("Unrecognized CPU '%s'\n", argv[argno] + 2);
+
 					errcnt++;
 					return errcnt;
 				}
@@ -558,7 +648,9 @@ int Process(int argc, char ** argv)
 				{
 					if (++argno >= argc)
 					{
-						printf("Missing argument to -o");
+						if (!relax_pass)
+							printf("Missing argument to -o");
+
 						errcnt++;
 						return errcnt;
 					}
@@ -591,7 +683,9 @@ int Process(int argc, char ** argv)
 						break;
 
 					default:
-						printf("-p: syntax error\n");
+						if (!relax_pass)
+							printf("-p: syntax error\n");
+
 						errcnt++;
 						return errcnt;
 				}
@@ -624,14 +718,22 @@ int Process(int argc, char ** argv)
 			case 'V':
 				verb_flag++;
 
-				if (verb_flag > 1)
+				if (verb_flag > 1 && !relax_pass)
 					DisplayVersion();
 
 				break;
 			case 'x':				// Turn on debugging
 			case 'X':
 				debug = 1;
-				printf("~ Debugging ON\n");
+				if (!relax_pass)
+				{
+					printf("~ Debugging ON\n");
+
+					// The variant table must agree with the machtab[] chains
+					if (CheckVariantTable())
+						errcnt++;
+				}
+
 				break;
 			case 'y':				// -y<pagelen>
 			case 'Y':
@@ -639,11 +741,49 @@ int Process(int argc, char ** argv)
 
 				if (pagelen < 10)
 				{
-					printf("-y: bad page length\n");
+					if (!relax_pass)
+						printf("-y: bad page length\n");
+
 					errcnt++;
 					return errcnt;
 				}
 
+				break;
+			case '-':				// Long options
+				if (strcmp(argv[argno] + 2, "relax") == 0)
+					break;			// Handled by main()
+
+				if (strncmp(argv[argno] + 2, "cache=", 6) == 0
+					|| strncmp(argv[argno] + 2, "cache-size=", 11) == 0)
+					break;			// Handled by CacheLookup()
+
+				if (strcmp(argv[argno] + 2, "snapshots") == 0)
+					break;			// Handled by RunWatch()
+
+				if (strncmp(argv[argno] + 2, "fixup-threads=", 14) == 0)
+				{
+					fixup_threads = atoi(argv[argno] + 16);
+
+					if (fixup_threads < 1)
+					{
+						if (!relax_pass)
+							printf("--fixup-threads: bad number of threads\n");
+
+						errcnt++;
+						return errcnt;
+					}
+
+					break;
+				}
+
+				if (!relax_pass)
+				{
+					DisplayVersion();
+					printf("Unknown switch: %s\n\n", argv[argno]);
+					DisplayHelp();
+				}
+
+				errcnt++;
 				break;
 			case EOS:				// Input is stdin
 				ProcessFile(0, NULL);
@@ -651,19 +791,29 @@ int Process(int argc, char ** argv)
 			case 'h':				// Display command line usage
 			case 'H':
 			case '?':
-				DisplayVersion();
-				DisplayHelp();
+				if (!relax_pass)
+				{
+					DisplayVersion();
+					DisplayHelp();
+				}
+
 				errcnt++;
 				break;
 			case 'n':				// Turn off legacy mode
 			case 'N':
 				legacy_flag = 0;
-				printf("Legacy mode OFF\n");
+				if (!relax_pass)
+					printf("Legacy mode OFF\n");
+
 				break;
 			default:
-				DisplayVersion();
-				printf("Unknown switch: %s\n\n", argv[argno]);
-				DisplayHelp();
+				if (!relax_pass)
+				{
+					DisplayVersion();
+					printf("Unknown switch: %s\n\n", argv[argno]);
+					DisplayHelp();
+				}
+
 				errcnt++;
 				break;
 			}
@@ -672,9 +822,13 @@ int Process(int argc, char ** argv)
 		{
 			if (ParseOptimization(argv[argno]) != OK)
 			{
-				DisplayVersion();
-				printf("Unknown switch: %s\n\n", argv[argno]);
-				DisplayHelp();
+				if (!relax_pass)
+				{
+					DisplayVersion();
+					printf("Unknown switch: %s\n\n", argv[argno]);
+					DisplayHelp();
+				}
+
 				errcnt++;
 				break;
 			}
@@ -683,11 +837,13 @@ int Process(int argc, char ** argv)
 		{
 			strcpy(fnbuf, argv[argno]);
 			fext(fnbuf, ".s", 0);
-			fd = open(fnbuf, 0);
+			fd = OpenSource(fnbuf);
 
-			if (fd < 0)
+			if (fd == -1)
 			{
-				printf("Cannot open: %s\n", fnbuf);
+				if (!relax_pass)
+					printf("Cannot open: %s\n", fnbuf);
+
 				errcnt++;
 				continue;
 			}
@@ -745,6 +901,11 @@ int Process(int argc, char ** argv)
 	}
 
 	SwitchSection(TEXT);
+	ResolveDependencies();					// Late equates, shared fixup expressions
+
+	// Sizing passes stop here, RelaxUpdate() takes it from there
+	if (relax_pass)
+		return errcnt;
 
 	if (objfname == NULL)
 	{
@@ -765,11 +926,15 @@ int Process(int argc, char ** argv)
 	ResolveAllFixups();						// Do all fixups
 	StopMark();								// Stop mark tape-recorder
 
-	if (errcnt == 0)
+	if (errcnt == 0 && objmem_flag)
+		WriteObject(-1);					// Object image goes to memory
+	else if (errcnt == 0)
 	{
 		if ((fd = open(objfname, _OPEN_FLAGS, _PERM_MODE)) < 0)
 			CantCreateFile(objfname);
 
+		CacheNoteOutput(objfname);
+
 		if (verb_flag)
 		{
 			s = (prg_flag ? "executable" : "object");
@@ -789,18 +954,45 @@ int Process(int argc, char ** argv)
 			printf("[Wrapping-up listing file]\n");
 
 		listing = 1;
-		symtable();
+
+		if (list_json)
+			JsonListFiles();
+		else
+			symtable();
+
+		FlushListing();
 		close(list_fd);
 	}
 
 	if (err_flag)
+	{
+		FlushErrors();
 		close(err_fd);
+	}
 
 	DEBUG dump_everything();
 
 	return errcnt;
 }
 
+//
+// Check the command line for --relax. Relaxing needs every source file to be
+// read several times, so it's not possible when assembling from stdin.
+//
+static int RelaxRequested(int argc, char ** argv)
+{
+	for(int i=0; i<argc; i++)
+	{
+		if (strcmp(argv[i], "-") == 0)
+			return (relax_flag = 0);
+
+		if (strcmp(argv[i], "--relax") == 0)
+			relax_flag = 1;
+	}
+
+	return relax_flag;
+}
+
 //
 // Determine processor endianess
 //
@@ -815,24 +1007,447 @@ int GetEndianess(void)
 	return 1;
 }
 
+//
+// Do an assembly, given the command line arguments (without the program name)
+//
+static int AssembleCommandLine(int argc, char ** argv)
+{
+	RelaxReset();					// Nothing carries over from the last one
+
+	int errors = CacheLookup(argc, argv);
+
+	if (errors >= 0)
+		return errors;				// Outputs came out of the cache
+
+	if (RelaxRequested(argc, argv))
+	{
+		// Run sizing passes (which produce no output at all) until the
+		// sizes of all span-dependent instructions settle. Errors are
+		// left for the final, unrelaxed, pass to report.
+		for(relax_pass=1; ; relax_pass++)
+		{
+			if (Process(argc, argv) != 0)
+			{
+				RelaxAbandon();
+				break;
+			}
+
+			if (!RelaxUpdate())
+				break;
+
+			if (relax_pass == RELAX_MAXPASS)
+			{
+				RelaxAbandon();
+				break;
+			}
+		}
+
+		relax_pass = 0;
+	}
+
+	errors = Process(argc, argv);
+	CacheStore(errors);
+
+	return errors;
+}
+
+//
+// Give back the memory an assembly used. The Init*() functions free whatever
+// the last assembly on this thread left, so nothing is kept between calls (or
+// after the thread ends) but, for --watch, the list of files it read (see
+// FreeInputs()).
+//
+static void ReleaseAssembly(void)
+{
+	InitSymbolTable();
+	FreeInputs();
+	InitLineProcessor();
+	InitExpression();
+	InitSection();
+	InitMark();
+	InitMacro();
+	InitDepend();
+	RelaxReset();
+}
+
+//
+// librmac: do an assembly in-process (see librmac.h). Fatal errors end the
+// assembly instead of the process. The assembler's state is the calling
+// thread's own (ASMCTX), so assemblies can run on several threads at once;
+// anything an assembly leaves behind has to be reset here or in the Init*()
+// functions Process() calls.
+//
+int RmacAssemble(int argc, char ** argv)
+{
+	jmp_buf env;
+
+	// Reset what Process() leaves to the command line (a previous one's, now)
+	perm_verb_flag = 0;
+	cmdlnexec = "rmac";
+	endian = GetEndianess();
+	prg_flag = 0;
+	list_pag = 1;
+	list_fd = 0;
+	relax_flag = 0;
+	relax_pass = 0;
+
+	bailout = &env;
+
+	if (setjmp(env) == 0)
+		errcnt = AssembleCommandLine(argc, argv);
+	else
+	{
+		AbandonInput();
+		relax_pass = 0;
+		errcnt++;
+
+		if (list_fd > 0)
+			close(list_fd);
+
+		if (err_flag)
+			close(err_fd);
+	}
+
+	bailout = NULL;
+	ReleaseAssembly();
+
+	return errcnt;
+}
+
+//
+// Same, but the object file is handed back in memory (NULL if there were
+// errors) instead of being written out
+//
+int RmacAssembleToMemory(int argc, char ** argv, uint8_t ** image, size_t * size)
+{
+	objmem = NULL;
+	objmemsize = 0;
+	objmem_flag = 1;
+
+	if (RmacAssemble(argc, argv) != 0)
+	{
+		free(objmem);
+		objmem = NULL;
+		objmemsize = 0;
+	}
+
+	objmem_flag = 0;
+	*image = objmem;
+	*size = objmemsize;
+	objmem = NULL;
+
+	return errcnt;
+}
+
+//
+// Make 'text' readable by assemblies as the source file 'name'
+//
+void RmacAddSource(const char * name, const char * text, size_t size)
+{
+	AddMemorySource(name, text, size);
+}
+
+void RmacClearSources(void)
+{
+	ClearMemorySources();
+}
+
+#ifndef LIBRMAC
+//
+// Check the command line for -j[jobs]. Returns the number of jobs asked for
+// (all the processors if no number is given), or 0 if there's no -j.
+//
+static int JobsRequested(int argc, char ** argv)
+{
+	int jobs = 0;
+
+	for(int i=0; i<argc; i++)
+	{
+		if (argv[i][0] == '-' && (argv[i][1] == 'j' || argv[i][1] == 'J'))
+		{
+			jobs = atoi(argv[i] + 2);
+
+#if !defined(WIN32) && !defined(WIN64)
+			if (jobs <= 0)
+				jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+			if (jobs <= 0)
+				jobs = 1;
+		}
+		else if ((argv[i][0] == '-') && (argv[i][1] == 'o' || argv[i][1] == 'O')
+			&& (argv[i][2] == EOS))
+			i++;					// Skip -o's file name
+	}
+
+	return jobs;
+}
+
+#if !defined(WIN32) && !defined(WIN64)
+// An assembly started by AssembleEachFile()
+#define JOB struct _job
+JOB
+{
+	pid_t pid;				// Process doing it
+	int fd[2];				// Its stdout & stderr (-1 once at EOF)
+	char * out[2];			// What it wrote there
+	size_t outsize[2];
+	int status;				// Its exit status, once it's finished
+};
+
+//
+// Start assembling 'source' in a child process, with stdout & stderr going
+// to pipes
+//
+static void StartJob(JOB * job, char ** args, int nargs, char * source)
+{
+	int p[2][2];
+
+	memset(job, 0, sizeof(JOB));
+	fflush(stdout);
+
+	// A job that can't be started is left as one that's finished (no
+	// process, both pipes at EOF), with an error
+	job->pid = 0;
+	job->fd[0] = job->fd[1] = -1;
+	job->status = 1;
+
+	if (pipe(p[0]) != 0)
+	{
+		printf("-j: cannot start assembling %s\n", source);
+		return;
+	}
+
+	if (pipe(p[1]) != 0)
+	{
+		printf("-j: cannot start assembling %s\n", source);
+		close(p[0][0]); close(p[0][1]);
+		return;
+	}
+
+	if ((job->pid = fork()) < 0)
+	{
+		printf("-j: cannot start assembling %s\n", source);
+		job->pid = 0;
+		close(p[0][0]); close(p[0][1]);
+		close(p[1][0]); close(p[1][1]);
+		return;
+	}
+
+	if (job->pid == 0)
+	{
+		dup2(p[0][1], 1);
+		dup2(p[1][1], 2);
+		close(p[0][0]); close(p[0][1]);
+		close(p[1][0]); close(p[1][1]);
+		setvbuf(stdout, NULL, _IOLBF, 0);
+
+		args[nargs] = source;
+		int errors = AssembleCommandLine(nargs + 1, args);
+		fflush(stdout);
+		_exit(errors > 255 ? 255 : errors);
+	}
+
+	close(p[0][1]);
+	close(p[1][1]);
+	job->fd[0] = p[0][0];
+	job->fd[1] = p[1][0];
+	job->status = 0;
+}
+
+//
+// Read what's waiting in one of a job's pipes; returns 0 at EOF
+//
+static int ReadJob(JOB * job, int n)
+{
+	char buf[4096];
+	ssize_t size = read(job->fd[n], buf, sizeof(buf));
+
+	if (size <= 0)
+	{
+		close(job->fd[n]);
+		job->fd[n] = -1;
+		return 0;
+	}
+
+	job->out[n] = realloc(job->out[n], job->outsize[n] + size);
+	memcpy(job->out[n] + job->outsize[n], buf, size);
+	job->outsize[n] += size;
+
+	return 1;
+}
+#endif
+
+//
+// -j: assemble each source file on its own, into its own object file, up to
+// 'jobs' of them at once. Each file's messages are shown together, in
+// command line order. Returns the total number of errors (at most 255).
+//
+static int AssembleEachFile(int jobs, int argc, char ** argv)
+{
+	char ** args = malloc((argc + 1) * sizeof(char *));
+	char ** sources = malloc(argc * sizeof(char *));
+	int nargs = 0, nsources = 0, errors = 0;
+
+	// Everything but -j and the source files is passed on to each assembly
+	for(int i=0; i<argc; i++)
+	{
+		char * a = argv[i];
+
+		if (*a != '-' && *a != '+' && *a != '~')
+			sources[nsources++] = a;
+		else if (a[1] == 'j' || a[1] == 'J')
+			continue;
+		else if (a[1] == 'o' || a[1] == 'O' || a[1] == EOS
+			|| ((a[1] == 'e' || a[1] == 'E') && a[2] != EOS)
+			|| ((a[1] == 'l' || a[1] == 'L')
+			&& a[(a[2] == '*' || a[2] == '+') ? 3 : 2] != EOS))
+		{
+			printf("-j: %s can't be used, as every source file gets its own output files\n", a);
+			return 1;
+		}
+		else
+			args[nargs++] = a;
+	}
+
+	args[nargs + 1] = NULL;
+
+#if defined(WIN32) || defined(WIN64)
+	// No fork() here; assemble one after the other
+	for(int i=0; i<nsources; i++)
+	{
+		args[nargs] = sources[i];
+		errors += AssembleCommandLine(nargs + 1, args);
+	}
+#else
+	JOB * job = malloc(nsources * sizeof(JOB));
+	struct pollfd * pfd = malloc(nsources * 2 * sizeof(struct pollfd));
+	int started = 0, finished = 0, shown = 0;
+
+	while (shown < nsources)
+	{
+		while (started < nsources && started - finished < jobs)
+		{
+			// One that fails to start is retired in its turn, below
+			StartJob(&job[started], args, nargs, sources[started]);
+			started++;
+		}
+
+		// Collect output from the running jobs
+		int npfd = 0;
+
+		for(int i=finished; i<started; i++)
+		{
+			for(int n=0; n<2; n++)
+			{
+				if (job[i].fd[n] >= 0)
+				{
+					pfd[npfd].fd = job[i].fd[n];
+					pfd[npfd].events = POLLIN;
+					npfd++;
+				}
+			}
+		}
+
+		if (npfd > 0 && poll(pfd, npfd, -1) > 0)
+		{
+			for(int i=finished, k=0; i<started; i++)
+			{
+				for(int n=0; n<2; n++)
+				{
+					if (job[i].fd[n] >= 0 && (pfd[k++].revents & (POLLIN | POLLHUP)))
+						ReadJob(&job[i], n);
+				}
+			}
+		}
+
+		// Jobs are retired in order, so their output comes out in order
+		while (finished < started && job[finished].fd[0] < 0
+			&& job[finished].fd[1] < 0)
+		{
+			if (job[finished].pid > 0)
+			{
+				waitpid(job[finished].pid, &job[finished].status, 0);
+				job[finished].status = (WIFEXITED(job[finished].status)
+					? WEXITSTATUS(job[finished].status) : 1);
+			}
+
+			finished++;
+		}
+
+		for(; shown<finished; shown++)
+		{
+			fwrite(job[shown].out[0], 1, job[shown].outsize[0], stdout);
+			fflush(stdout);
+			fwrite(job[shown].out[1], 1, job[shown].outsize[1], stderr);
+			free(job[shown].out[0]);
+			free(job[shown].out[1]);
+			errors += job[shown].status;
+		}
+	}
+
+	free(pfd);
+	free(job);
+#endif
+
+	free(sources);
+	free(args);
+
+	return (errors > 255 ? 255 : errors);
+}
+
 //
 // Application entry point
 //
 int main(int argc, char ** argv)
 {
 	perm_verb_flag = 0;				// Clobber "permanent" verbose flag
-	legacy_flag = 1;				// Default is legacy mode on (:-P)
-	optim_flags[OPT_56K_SHORT] = 1; // This ensures compatibilty with Motorola's 56k assembler
 
 	cmdlnexec = argv[0];			// Obtain executable name
 	endian = GetEndianess();		// Get processor endianess
 
 	// If commands were passed in, process them
 	if (argc > 1)
-		return Process(argc - 1, argv + 1);
+	{
+		if (strncmp(argv[1], "--cache-stats=", 14) == 0)
+			return CacheStats(argv[1] + 14);
+
+		if (strncmp(argv[1], "--server=", 9) == 0)
+			return RunServer(argv[1] + 9);
+
+		if (strcmp(argv[1], "--watch") == 0)
+			return RunWatch(argc - 2, argv + 2);
+
+		if (strncmp(argv[1], "--connect=", 10) == 0)
+		{
+			int errors = RunClient(argv[1] + 10, argc - 2, argv + 2);
+
+			if (errors >= 0)
+				return errors;
+
+			// No server; do it here
+			argc--;
+			argv++;
+
+			if (argc == 1)
+			{
+				DisplayVersion();
+				DisplayHelp();
+				return 0;
+			}
+		}
+
+		int jobs = JobsRequested(argc - 1, argv + 1);
+
+		if (jobs)
+			return AssembleEachFile(jobs, argc - 1, argv + 1);
+
+		return AssembleCommandLine(argc - 1, argv + 1);
+	}
 
 	DisplayVersion();
 	DisplayHelp();
 
 	return 0;
 }
+#endif
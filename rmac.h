@@ -97,6 +97,18 @@
 
 #endif
 
+//
+// Assembler context: what an assembly changes is kept for each thread, so
+// librmac can do assemblies on several threads at once, every thread having
+// a context of its own (see librmac.h). Globals holding such state are
+// declared ASMCTX.
+//
+#ifdef _MSC_VER
+	#define ASMCTX __declspec(thread)
+#else
+	#define ASMCTX __thread
+#endif
+
 
 //
 // Endian related, for safe handling of endian-sensitive data
@@ -266,6 +278,8 @@ PTR
 #define UNDEF_EQUR   0x0010
 #define EQUATEDCC    0x0020
 #define UNDEF_CC     0x0040
+#define EQUATEDSET   0x0080		// Symbol was SET (can be set again)
+#define EQUATEDLATE  0x0100		// Equate waiting for a forward reference
 
 // Optimisation defines
 enum
@@ -286,39 +300,42 @@ enum
 	OPT_COUNT,                  // Dummy, used to count number of optimisation switches
     // These will be unaffected by "Oall"
 	OPT_PC_RELATIVE   = 30,		// Enforce PC relative
+	OPT_PC_CONVERT    = 31,		// Absolute long source operands to (d16,PC)
     OPT_COUNT_ALL               // Dummy, used to count all switches
 };
 
 // Exported variables
-extern int verb_flag;
-extern int debug;
-extern int rgpu, rdsp;
-extern int robjproc;
-extern int dsp56001;
-extern int err_flag;
-extern int err_fd;
-extern char * firstfname;
-extern int list_fd;
-extern int list_pag;
-extern int m6502;
-extern int list_flag;
-extern int glob_flag;
-extern int lsym_flag;
-extern int dsym_flag;
-extern int optim_warn_flag;
-extern int obj_format;
-extern int legacy_flag;
-extern int prg_flag;	// 1 = write ".PRG" relocatable executable
-extern LONG PRGFLAGS;
-extern int optim_flags[OPT_COUNT_ALL];
-extern int activecpu;
-extern int activefpu;
-extern uint32_t org68k_address;
-extern int org68k_active;
-extern int *regbase;
-extern int *regtab;
-extern int *regcheck;
-extern int *regaccept;
+extern ASMCTX int verb_flag;
+extern ASMCTX int debug;
+extern ASMCTX int rgpu, rdsp;
+extern ASMCTX int robjproc;
+extern ASMCTX int dsp56001;
+extern ASMCTX int err_flag;
+extern ASMCTX int err_fd;
+extern ASMCTX char * firstfname;
+extern ASMCTX int list_fd;
+extern ASMCTX int list_pag;
+extern ASMCTX int list_json;
+extern ASMCTX int m6502;
+extern ASMCTX int list_flag;
+extern ASMCTX int glob_flag;
+extern ASMCTX int lsym_flag;
+extern ASMCTX int dsym_flag;
+extern ASMCTX int optim_warn_flag;
+extern ASMCTX int obj_format;
+extern ASMCTX int legacy_flag;
+extern ASMCTX int prg_flag;	// 1 = write ".PRG" relocatable executable
+extern ASMCTX LONG PRGFLAGS;
+extern ASMCTX int optim_flags[OPT_COUNT_ALL];
+extern ASMCTX int fixup_threads;
+extern ASMCTX int activecpu;
+extern ASMCTX int activefpu;
+extern ASMCTX uint32_t org68k_address;
+extern ASMCTX int org68k_active;
+extern ASMCTX int *regbase;
+extern ASMCTX int *regtab;
+extern ASMCTX int *regcheck;
+extern ASMCTX int *regaccept;
 
 // Exported functions
 void strtoupper(char * s);
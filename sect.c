@@ -8,6 +8,7 @@
 
 #include "sect.h"
 #include "6502.h"
+#include "depend.h"
 #include "direct.h"
 #include "dsp56k.h"
 #include "error.h"
@@ -26,20 +27,23 @@ void MakeSection(int, uint16_t);
 void SwitchSection(int);
 
 // Section descriptors
-SECT sect[NSECTS];		// All sections...
-int cursect;			// Current section number
+ASMCTX SECT sect[NSECTS];		// All sections...
+ASMCTX int cursect;			// Current section number
 
 // These are copied from the section descriptor, the current code chunk
 // descriptor and the current fixup chunk descriptor when a switch is made into
 // a section. They are copied back to the descriptors when the section is left.
-uint16_t scattr;		// Section attributes
-uint32_t sloc;			// Current loc in section
+ASMCTX uint16_t scattr;		// Section attributes
+ASMCTX uint32_t sloc;			// Current loc in section
 
-CHUNK * scode;			// Current (last) code chunk
-uint32_t challoc;		// # bytes alloc'd to code chunk
-uint32_t ch_size;		// # bytes used in code chunk
-uint8_t * chptr;		// Deposit point in code chunk buffer
-uint8_t * chptr_opcode;	// Backup of chptr, updated before entering code generators
+ASMCTX CHUNK * scode;			// Current (last) code chunk
+ASMCTX uint32_t challoc;		// # bytes alloc'd to code chunk
+ASMCTX uint32_t ch_size;		// # bytes used in code chunk
+ASMCTX uint8_t * chptr;		// Deposit point in code chunk buffer
+ASMCTX uint8_t * chptr_opcode;	// Backup of chptr, updated before entering code generators
+
+static ASMCTX TOKEN * foldbuf;		// Folded fixup expression (AddFixup())
+static ASMCTX uint32_t foldsize;	// # of TOKENs in foldbuf
 
 // Return a size (SIZB, SIZW, SIZL) or 0, depending on what kind of fixup is
 // associated with a location.
@@ -72,9 +76,30 @@ static uint8_t fusizoffs[] = {
 //
 void InitSection(void)
 {
-	// Initialize all sections
+	// Free the last assembly's code chunks & fixups, then initialize all
+	// sections
 	for(int i=0; i<NSECTS; i++)
+	{
+		for(CHUNK * cp=sect[i].sfcode; cp!=NULL; )
+		{
+			CHUNK * next = cp->chnext;
+			free(cp);
+			cp = next;
+		}
+
+		for(FIXUP * fup=sect[i].sffix; fup!=NULL; )
+		{
+			FIXUP * next = fup->next;
+			free(fup);
+			fup = next;
+		}
+
 		MakeSection(i, 0);
+	}
+
+	free(foldbuf);
+	foldbuf = NULL;
+	foldsize = 0;
 
 	// Construct default sections, make TEXT the current section
 	MakeSection(ABS,     SUSED | SABS | SBSS);	// ABS
@@ -177,19 +202,45 @@ int fixtest(int sno, uint32_t loc)
 	// Ugly linear search for a mark on our location. The speed doesn't
 	// matter, since this is only done when generating a listing, which is
 	// SLOW anyway.
+	// A block fixup (dcb & co.) covers 'count' values, one after another.
 	for(FIXUP * fp=sect[sno].sffix; fp!=NULL; fp=fp->next)
 	{
-		uint32_t w = fp->attr;
-		uint32_t xloc = fp->loc + (int)fusizoffs[w & FUMASK];
+		uint32_t offs;
+		int size = FixupSize(fp->attr, &offs);
+		uint32_t xloc = fp->loc + offs;
 
 		if (xloc == loc)
-			return (int)fusiztab[w & FUMASK];
+			return size;
+
+		if (size > 0 && loc > xloc && (loc - xloc) % size == 0
+			&& (loc - xloc) / size < fp->count)
+			return size;
 	}
 
 	return 0;
 }
 
 
+//
+// Return the number of bytes a fixup covers (0 for fixups that aren't byte
+// aligned, like FU_QUICK) and set 'offs' to the offset of its first byte from
+// the fixup location
+//
+int FixupSize(uint32_t attr, uint32_t * offs)
+{
+	uint32_t w = attr & FUMASK;
+
+	if (w >= sizeof(fusiztab))
+	{
+		*offs = 0;
+		return 0;
+	}
+
+	*offs = fusizoffs[w];
+	return fusiztab[w];
+}
+
+
 //
 // Check that there are at least 'amt' bytes left in the current chunk. If
 // there are not, allocate another chunk of at least CH_CODE_SIZE bytes or
@@ -260,6 +311,196 @@ So the problem is, d_org sets sloc to the address of the ORG statement, and that
 }
 
 
+//
+// See if the tokens from p up to end are just "symbol" or "symbol + addend",
+// the only forms FoldFixupExpression() leaves a symbol in with an addend
+//
+static int SymbolTerm(TOKEN * p, TOKEN * end, uint64_t * addend)
+{
+	PTR tk;
+
+	if (end - p == 2 && p[0] == SYMBOL)
+	{
+		*addend = 0;
+		return 1;
+	}
+
+	if (end - p == 6 && p[0] == SYMBOL && p[2] == CONST && p[5] == '+')
+	{
+		tk.u32 = p + 3;
+		*addend = *tk.u64;
+		return 1;
+	}
+
+	return 0;
+}
+
+
+//
+// Put "symbol + addend" at p, in the form SymbolTerm() looks for. Returns
+// where it ends.
+//
+static TOKEN * PutSymbolTerm(TOKEN * p, TOKEN symno, uint64_t addend)
+{
+	PTR tk;
+	tk.u32 = p;
+	*tk.u32++ = SYMBOL;
+	*tk.u32++ = symno;
+
+	if (addend != 0)
+	{
+		*tk.u32++ = CONST;
+		*tk.u64++ = addend;
+		*tk.u32++ = '+';
+	}
+
+	return tk.u32;
+}
+
+
+//
+// Copy a fixup's expression to dst, replacing symbols that are defined and
+// absolute with their values, and folding whatever is constant after that.
+// Because symbols that are defined by now can change before the fixups are
+// resolved (think of a symbol that's SET several times, bug #176), they have
+// to go now anyway. A symbol plus or minus constants is gathered into the
+// form "symbol + addend". Returns the length of the result in TOKENs,
+// including ENDEXPR. dst needs room for twice the length of fexpr.
+//
+static uint16_t FoldFixupExpression(TOKEN * fexpr, TOKEN * dst)
+{
+	TOKEN * start[EVSTACKSIZE];		// Where each operand in dst starts
+	int depth = 0;					// # of operands in dst (-1 = don't fold)
+	PTR s, d, tk;
+	uint64_t a, b;
+	s.u32 = fexpr;
+	d.u32 = dst;
+
+	while (*s.u32 != ENDEXPR)
+	{
+		TOKEN t = *s.u32++;
+
+		switch (t)
+		{
+		case SYMBOL:
+		case CONST:
+		case FCONST:
+		case ACONST:
+			if (depth >= 0)
+			{
+				if (depth == EVSTACKSIZE)
+					depth = -1;
+				else
+					start[depth++] = d.u32;
+			}
+
+			if (t == SYMBOL)
+			{
+				SYM * sy = symbolPtr[*s.u32];
+
+				// Only convert symbols that are defined and are absolute
+				if ((sy->sattr & DEFINED) && !(sy->sattr & (TDB | M56KPXYL | M6502)))
+				{
+					*d.u32++ = CONST;
+					*d.u64++ = sy->svalue;
+					s.u32++;
+					break;
+				}
+			}
+
+			*d.u32++ = t;
+			*d.u32++ = *s.u32++;
+
+			if (t != SYMBOL)
+				*d.u32++ = *s.u32++;
+
+			break;
+
+		case UNMINUS:
+		case UNLT:
+		case UNGT:
+		case '!':
+		case '~':
+			if (depth > 0 && start[depth - 1][0] == CONST
+				&& start[depth - 1] + 3 == d.u32)
+			{
+				tk.u32 = start[depth - 1] + 1;
+				a = *tk.u64;
+
+				if (FoldOperator(t, &a, 0))
+				{
+					tk.u32 = start[depth - 1] + 1;
+					*tk.u64 = a;
+					break;
+				}
+			}
+
+			*d.u32++ = t;
+			break;
+
+		case '+': case '-': case '*': case '/': case '%':
+		case SHL: case SHR: case '&': case '^': case '|':
+		case LE: case GE: case '<': case '>': case NE: case '=':
+			if (depth >= 2)
+			{
+				TOKEN * left = start[depth - 2];
+				TOKEN * right = start[depth - 1];
+				depth--;
+
+				// constant OP constant
+				if (left[0] == CONST && left + 3 == right
+					&& right[0] == CONST && right + 3 == d.u32)
+				{
+					tk.u32 = left + 1;
+					a = *tk.u64;
+					tk.u32 = right + 1;
+					b = *tk.u64;
+
+					if (FoldOperator(t, &a, b))
+					{
+						tk.u32 = left + 1;
+						*tk.u64++ = a;
+						d.u32 = tk.u32;
+						break;
+					}
+				}
+				// (symbol + addend) +/- constant
+				else if ((t == '+' || t == '-') && right[0] == CONST
+					&& right + 3 == d.u32 && SymbolTerm(left, right, &a))
+				{
+					tk.u32 = right + 1;
+					a = (t == '+' ? a + *tk.u64 : a - *tk.u64);
+					d.u32 = PutSymbolTerm(left, left[1], a);
+					break;
+				}
+				// constant + (symbol + addend)
+				else if (t == '+' && left[0] == CONST && left + 3 == right
+					&& SymbolTerm(right, d.u32, &b))
+				{
+					tk.u32 = left + 1;
+					d.u32 = PutSymbolTerm(left, right[1], *tk.u64 + b);
+					break;
+				}
+			}
+			else
+				depth = -1;
+
+			*d.u32++ = t;
+			break;
+
+		default:
+			// Not something we know how to fold past
+			depth = -1;
+			*d.u32++ = t;
+		}
+	}
+
+	*d.u32++ = ENDEXPR;
+
+	return (uint16_t)(d.u32 - dst);
+}
+
+
 //
 // Arrange for a fixup on a location
 //
@@ -267,10 +508,12 @@ int AddFixup(uint32_t attr, uint32_t loc, TOKEN * fexpr)
 {
 	uint16_t exprlen = 0;
 	SYM * symbol = NULL;
+	uint64_t addend = 0;
 	uint32_t _orgaddr = 0;
 
-	// First, check to see if the expression is a bare label, otherwise, force
-	// the FU_EXPR flag into the attributes and count the tokens.
+	// First, check to see if the expression is a bare label, otherwise, fold
+	// it. If that leaves a symbol plus a constant, it's a symbol fixup all the
+	// same; if not, force the FU_EXPR flag into the attributes.
 	if ((fexpr[0] == SYMBOL) && (fexpr[2] == ENDEXPR))
 	{
 		symbol = symbolPtr[fexpr[1]];
@@ -281,8 +524,26 @@ int AddFixup(uint32_t attr, uint32_t loc, TOKEN * fexpr)
 	}
 	else
 	{
-		attr |= FU_EXPR;
 		exprlen = ExpressionLength(fexpr);
+
+		// Constants take up more space than symbols, so the folded expression
+		// can be longer (though never more than twice as long)
+		if (foldsize < (uint32_t)exprlen * 2)
+		{
+			foldsize = (uint32_t)exprlen * 2;
+			foldbuf = realloc(foldbuf, sizeof(TOKEN) * foldsize);
+		}
+
+		exprlen = FoldFixupExpression(fexpr, foldbuf);
+
+		if (SymbolTerm(foldbuf, foldbuf + exprlen - 1, &addend))
+		{
+			symbol = symbolPtr[foldbuf[1]];
+			attr |= FU_ADDEND;
+			exprlen = 0;
+		}
+		else
+			attr |= FU_EXPR;
 	}
 
 	// Second, check to see if it's a DSP56001 fixup, and force the FU_56001
@@ -295,7 +556,7 @@ int AddFixup(uint32_t attr, uint32_t loc, TOKEN * fexpr)
 	}
 
 	// Allocate space for the fixup + any expression
-	FIXUP * fixup = malloc(sizeof(FIXUP) + (sizeof(TOKEN) * exprlen)*2);
+	FIXUP * fixup = malloc(sizeof(FIXUP) + (sizeof(TOKEN) * exprlen));
 
 	// Store the relevant fixup information in the FIXUP
 	fixup->next = NULL;
@@ -305,58 +566,16 @@ int AddFixup(uint32_t attr, uint32_t loc, TOKEN * fexpr)
 	fixup->lineno = curlineno;
 	fixup->expr = NULL;
 	fixup->symbol = symbol;
+	fixup->addend = addend;
 	fixup->orgaddr = _orgaddr;
+	fixup->count = 1;
+	fixup->node = NONODE;
 
-	// Copy the passed in expression to the FIXUP, if any
+	// Copy the folded expression to the FIXUP, if any
 	if (exprlen > 0)
 	{
-		// Here we used to to a plain memcpy and punt on trying to evaluate the expression by then.
-		// As discussed in bug #176, this can lead to robustness issues because some symbols might
-		// have changed by the time we perform the relocations (think of a symbol that's SET multiple
-		// times). So instead we perform a symbol-by-symbol copy and check to see if there are any
-		// resolved symbols that can be evaluated immediately. Those, we replace with constants.
-		// Also of note: because "fixup" can be larger than what ExpressionLength() returns
-		// (due to constants taking up more space than symbols), we allocate twice as RAM as we should
-		// without expansions just to be on the safe side. The "correct" thing to do would be to
-		// modify ExpressionLength() to cater for defined symbols and return the exact amount of items.
-
 		fixup->expr = (TOKEN *)((uint8_t *)fixup + sizeof(FIXUP));
-		int i;
-		PTR dstexpr;
-		dstexpr.u32 = fixup->expr;
-		SYM *sy;
-		for (i = 0; i < exprlen; i++)
-		{
-			if (*fexpr == SYMBOL)
-			{
-				sy = symbolPtr[fexpr[1]];
-				if (sy->sattr & DEFINED && !(sy->sattr & (TDB| M56KPXYL|M6502)))
-				{
-					// Only convert symbols that are defined and are absolute
-					*dstexpr.u32++ = CONST;
-					*dstexpr.u64++ = sy->svalue;
-					fexpr += 2;
-					i++;
-				}
-				else
-				{
-					// Just copy the symbol
-					*dstexpr.u32++ = *fexpr++;
-					*dstexpr.u32++ = *fexpr++;
-					i++;
-				}
-			}
-			else if (*fexpr == CONST || *fexpr == FCONST)
-			{
-				// Copy constants
-				*dstexpr.u32++ = *fexpr++;
-				*dstexpr.u32++ = *fexpr++;
-				*dstexpr.u32++ = *fexpr++;
-				i += 2;
-			}
-			else
-				*dstexpr.u32++ = *fexpr++;
-		}
+		memcpy(fixup->expr, foldbuf, sizeof(TOKEN) * exprlen);
 	}
 
 	// Finally, put the FIXUP in the current section's linked list
@@ -400,23 +619,41 @@ int ResolveFixups(int sno)
 
 	// Get first fixup for the passed in section
 	FIXUP * fixup = sect[sno].sffix;
+	int lastfileno = -1;			// File fname was last looked up for
+	char * fname = NULL;			// Its name
+	uint32_t rep = 0;				// Which of the fixup's values is next
 
 	while (fixup != NULL)
 	{
 		// We do it this way because we have continues everywhere... :-P
 		FIXUP * fup = fixup;
-		fixup = fixup->next;
-
 		uint32_t dw = fup->attr;	// Fixup long (type + modes + flags)
 		uint32_t loc = fup->loc;	// Location to fixup
-		cfileno = fup->fileno;
-		curlineno = fup->lineno;
+
+		// A fixup covering several values comes round once for each
+		if (fup->count > 1)
+			loc += rep * ((dw & FUMASK) == FU_LONG ? 4 : (dw & FUMASK) == FU_WORD ? 2 : 1);
+
+		if (++rep >= fup->count)
+		{
+			fixup = fixup->next;
+			rep = 0;
+		}
+
 		DEBUG { printf("ResolveFixups: sect#=%u, l#=%u, attr=$%X, loc=$%X, expr=%p, sym=%p, org=$%X\n", sno, fup->lineno, fup->attr, fup->loc, (void *)fup->expr, (void *)fup->symbol, fup->orgaddr); }
 
-		// This is based on global vars cfileno, curfname :-P
-		// This approach is kinda meh as well. I think we can do better
-		// than this.
-		SetFilenameForErrorReporting();
+		// Messages are put down to the fixup's line. Finding the file's name
+		// walks the list of files, so only do it when the file changes;
+		// fixups come in source order, so that's seldom. (The listing's page
+		// titles show curfname.)
+		if (fup->fileno != lastfileno)
+		{
+			fname = FileName(fup->fileno);
+			lastfileno = fup->fileno;
+			curfname = fname;
+		}
+
+		SetErrorLocation(fname, fup->lineno);
 
 		if ((sno == M56001P) || (sno == M56001X) || (sno == M56001Y) || (sno == M56001L))
 			loc = fup->orgaddr;
@@ -453,44 +690,18 @@ int ResolveFixups(int sno)
 		uint64_t eval;				// Expression value
 		uint16_t flags;				// Mark flags
 
-		// Compute expression/symbol value and attributes
+		// Compute expression/symbol value and attributes (evexpr issues the
+		// errors/warnings, if any)
+		if (EvalFixup(fup, &eval, &eattr, &esym) != OK)
+			continue;
 
-		// Complex expression
-		if (dw & FU_EXPR)
+		if ((CHECK_OPTS(OPT_PC_RELATIVE)) && !(dw & (FU_PCREL | FU_PCRELX)) && (eattr & (DEFINED | REFERENCED | EQUATED)) == (DEFINED | REFERENCED))
 		{
-			// evexpr presumably issues the errors/warnings here
-			if (evexpr(fup->expr, &eval, &eattr, &esym) != OK)
-				continue;
-
-			if ((CHECK_OPTS(OPT_PC_RELATIVE)) && (eattr & (DEFINED | REFERENCED | EQUATED)) == (DEFINED | REFERENCED))
-			{
-				error("relocation not allowed when o30 is enabled");
-				continue;
-			}
+			error("relocation not allowed when o30 is enabled");
+			continue;
 		}
-		// Simple symbol
-		else
-		{
-			SYM * sy = fup->symbol;
-			eattr = sy->sattr;
 
-			if ((CHECK_OPTS(OPT_PC_RELATIVE)) && (eattr & (DEFINED | REFERENCED | EQUATED)) == (DEFINED | REFERENCED))
-			{
-				error("relocation not allowed when o30 is enabled");
-				continue;
-			}
-
-			if (eattr & DEFINED)
-				eval = sy->svalue;
-			else
-				eval = 0;
-
-			// If the symbol is not defined, but global, set esym to sy
-			if ((eattr & (GLOBAL | DEFINED)) == GLOBAL)
-				esym = sy;
-
-			DEBUG { printf("               name: %s, value: $%" PRIX64 "\n", sy->sname, sy->svalue); }
-		}
+		DEBUG { if (!(dw & FU_EXPR)) printf("               name: %s, value: $%" PRIX64 "\n", fup->symbol->sname, fup->symbol->svalue); }
 
 		uint16_t tdb = eattr & TDB;
 
@@ -766,7 +977,10 @@ int ResolveFixups(int sno)
 
 				if (dw & FU_SEXT)
 				{
-					if (eval + 0x10000 >= 0x20000)
+					// Like the defined case in ea0gen(), also take 32-bit
+					// addresses that sign extend from a word ($FFFF8000 & up)
+					if ((eval + 0x10000 >= 0x20000)
+						&& ((eval >> 32) || ((uint32_t)eval + 0x8000 >= 0x10000)))
 						goto rangeErr;
 				}
 				else
@@ -1022,6 +1236,8 @@ rangeErr:
 		error("expression out of range");
 	}
 
+	SetErrorLocation(NULL, 0);
+
 	return 0;
 }
 
@@ -1035,6 +1251,9 @@ int ResolveAllFixups(void)
 	if (glob_flag)
 		ForceUndefinedSymbolsGlobal();
 
+	// Evaluate the expressions on several threads first (--fixup-threads)
+	EvalFixupsInParallel(fixup_threads);
+
 	DEBUG printf("Resolving TEXT sections...\n");
 	ResolveFixups(TEXT);
 	DEBUG printf("Resolving DATA sections...\n");
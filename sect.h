@@ -85,6 +85,7 @@
 #define FU_SEXT      0x0010		// Ok to sign extend
 #define FU_PCREL     0x0020		// Subtract PC first
 #define FU_PCRELX    0x1000000	// 030 variant
+#define FU_ADDEND    0x2000000	// Symbol + addend (a folded expression)
 #define FU_EXPR      0x0040		// Expression (not symbol) follows
 
 #define FU_GLOBAL    0x0080		// Mark global symbol
@@ -149,7 +150,10 @@ FIXUP {
 	uint32_t lineno;	// Current line
 	TOKEN *  expr;		// Pointer to stored expression (if any)
 	SYM *    symbol;	// Pointer to symbol (if any)
+	uint64_t addend;	// Added to symbol's value
 	uint32_t orgaddr;	// Fixup origin address (used for FU_JR)
+	uint32_t count;		// # of values fixed up, one after another (dcb & co.)
+	uint32_t node;		// Expression's node in the dependency graph (depend.c)
 };
 
 // Section descriptor
@@ -191,21 +195,22 @@ SECT {
 #define CHECKNOFPU if (!activefpu) return error(unsupport)
 
 // Globals, external etc
-extern uint32_t sloc;
-extern uint16_t scattr;
-extern uint8_t * chptr;
-extern uint8_t * chptr_opcode;
-extern uint32_t ch_size;
-extern int cursect;
-extern SECT sect[];
-extern uint32_t challoc;
-extern CHUNK * scode;
+extern ASMCTX uint32_t sloc;
+extern ASMCTX uint16_t scattr;
+extern ASMCTX uint8_t * chptr;
+extern ASMCTX uint8_t * chptr_opcode;
+extern ASMCTX uint32_t ch_size;
+extern ASMCTX int cursect;
+extern ASMCTX SECT sect[];
+extern ASMCTX uint32_t challoc;
+extern ASMCTX CHUNK * scode;
 
 // Prototypes
 void InitSection(void);
 void SwitchSection(int);
 void SaveSection(void);
 int fixtest(int, uint32_t);
+int FixupSize(uint32_t, uint32_t *);
 void chcheck(uint32_t);
 int AddFixup(uint32_t, uint32_t, TOKEN *);
 int ResolveAllFixups(void);
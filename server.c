@@ -0,0 +1,312 @@
+//
+// RMAC - Renamed Macro Assembler for all Atari computers
+// SERVER.C - Resident Assembler Server
+// Copyright (C) 199x Landon Dyer, 2011-2022 Reboot and Friends
+// RMAC derived from MADMAC v1.07 Written by Landon Dyer, 1986
+// Source utilised with the kind permission of Landon Dyer
+//
+// "rmac --server=socket" stays resident and listens on a Unix domain socket.
+// "rmac --connect=socket ..." hands the rest of its command line, its current
+// directory and RMACPATH to the server, which does the assembly (one at a
+// time, through librmac) and sends back whatever it would have printed,
+// followed by a single byte holding the error count. Output files are written
+// by the server, in the client's directory. Source files read by the server
+// are kept in memory (see srccache_flag) for the next assemblies to use.
+//
+// Each assembly frees what it allocated before it returns (see RmacAssemble()),
+// so the server stays the same size from one request to the next, apart from
+// the source cache; files that have been deleted, replaced or changed are
+// dropped from that after each request.
+//
+// A request is a series of NUL terminated strings: the directory, RMACPATH
+// (empty if not set) and the command line arguments. It ends when the client
+// shuts down its side of the connection.
+//
+
+#include "server.h"
+#include "librmac.h"
+#include "token.h"
+
+#if !defined(WIN32) && !defined(WIN64)
+#include <errno.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+static char sockname[sizeof(((struct sockaddr_un *)0)->sun_path) + 512];
+
+//
+// Fill in the address of socket 'path'
+//
+static int SocketAddress(struct sockaddr_un * addr, char * path)
+{
+	if (strlen(path) >= sizeof(addr->sun_path))
+		return ERROR;
+
+	memset(addr, 0, sizeof(struct sockaddr_un));
+	addr->sun_family = AF_UNIX;
+	strcpy(addr->sun_path, path);
+
+	return OK;
+}
+
+//
+// Read everything the other end sends, until it's done. The result is NUL
+// terminated.
+//
+static char * ReadAll(int fd, size_t * size)
+{
+	char * buf = NULL;
+	size_t used = 0, bufsize = 0;
+	ssize_t n;
+
+	for(;;)
+	{
+		if (used + 1 >= bufsize)
+		{
+			bufsize = (bufsize ? bufsize * 2 : 4096);
+			buf = realloc(buf, bufsize);
+		}
+
+		n = read(fd, buf + used, bufsize - used - 1);
+
+		if (n < 0 && errno == EINTR)
+			continue;
+
+		if (n <= 0)
+			break;
+
+		used += n;
+	}
+
+	buf[used] = EOS;
+	*size = used;
+
+	return buf;
+}
+
+static void WriteAll(int fd, const void * buf, size_t size)
+{
+	const char * p = buf;
+
+	while (size > 0)
+	{
+		ssize_t n = write(fd, p, size);
+
+		if (n < 0 && errno == EINTR)
+			continue;
+
+		if (n <= 0)
+			return;
+
+		p += n;
+		size -= n;
+	}
+}
+
+//
+// Do the assembly requested on connection 'conn', with stdout & stderr going
+// to it
+//
+static void ServeRequest(int conn)
+{
+	size_t size;
+	char * req = ReadAll(conn, &size);
+	char ** args = malloc((size + 1) * sizeof(char *));
+	int nargs = 0;
+	uint8_t status = 1;
+
+	for(char * s=req; s<req+size; s+=strlen(s)+1)
+		args[nargs++] = s;
+
+	if (nargs < 2 || chdir(args[0]) != 0)
+	{
+		char msg[] = "rmac server: bad request\n";
+		WriteAll(conn, msg, sizeof(msg) - 1);
+	}
+	else
+	{
+		if (*args[1] != EOS)
+			setenv("RMACPATH", args[1], 1);
+		else
+			unsetenv("RMACPATH");
+
+		fflush(stdout);
+		int out = dup(1);
+		int err = dup(2);
+		dup2(conn, 1);
+		dup2(conn, 2);
+
+		int errors = RmacAssemble(nargs - 2, args + 2);
+
+		fflush(stdout);
+		dup2(out, 1);
+		dup2(err, 2);
+		close(out);
+		close(err);
+		status = (errors > 255 ? 255 : errors);
+	}
+
+	WriteAll(conn, &status, 1);
+	free(args);
+	free(req);
+}
+
+static void StopServer(int sig)
+{
+	unlink(sockname);
+	_exit(0);
+}
+
+//
+// --server: serve assemblies on socket 'path' until killed
+//
+int RunServer(char * path)
+{
+	struct sockaddr_un addr;
+	struct stat st;
+	int sock;
+
+	if (SocketAddress(&addr, path) != OK)
+	{
+		printf("--server: socket name too long: %s\n", path);
+		return 1;
+	}
+
+	// Requests change the current directory, so remember where it really is
+	sockname[0] = EOS;
+
+	if (*path != '/' && getcwd(sockname, sizeof(sockname) - strlen(path) - 2))
+		strcat(sockname, "/");
+
+	strcat(sockname, path);
+
+	// A server that's gone leaves its socket behind; anything else is left be
+	if (stat(path, &st) == 0 && S_ISSOCK(st.st_mode))
+		unlink(path);
+
+	if ((sock = socket(AF_UNIX, SOCK_STREAM, 0)) < 0
+		|| bind(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0
+		|| listen(sock, 16) != 0)
+	{
+		printf("--server: cannot listen on %s\n", path);
+		return 1;
+	}
+
+	signal(SIGPIPE, SIG_IGN);
+	signal(SIGINT, StopServer);
+	signal(SIGTERM, StopServer);
+	srccache_flag = 1;
+
+	for(;;)
+	{
+		int conn = accept(sock, NULL, NULL);
+
+		if (conn < 0)
+		{
+			if (errno == EINTR || errno == ECONNABORTED)
+				continue;
+
+			printf("--server: %s\n", strerror(errno));
+			break;
+		}
+
+		ServeRequest(conn);
+		close(conn);
+		PruneSourceCache();
+	}
+
+	close(sock);
+	unlink(sockname);
+
+	return 1;
+}
+
+//
+// --connect: have the server on socket 'path' do the assembly. Returns the
+// number of errors, or -1 if it's to be done here after all.
+//
+int RunClient(char * path, int argc, char ** argv)
+{
+	struct sockaddr_un addr;
+	char cwd[4096];
+	char * rmacpath = getenv("RMACPATH");
+	int sock;
+
+	// Nothing to do, or stdin to be read: leave that to the local assembler
+	for(int i=0; i<argc; i++)
+	{
+		if (strcmp(argv[i], "-") == 0)
+			return -1;
+	}
+
+	if (argc == 0 || SocketAddress(&addr, path) != OK
+		|| getcwd(cwd, sizeof(cwd)) == NULL)
+		return -1;
+
+	if ((sock = socket(AF_UNIX, SOCK_STREAM, 0)) < 0)
+		return -1;
+
+	if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0)
+	{
+		close(sock);
+		return -1;
+	}
+
+	signal(SIGPIPE, SIG_IGN);
+	WriteAll(sock, cwd, strlen(cwd) + 1);
+	WriteAll(sock, (rmacpath ? rmacpath : ""), (rmacpath ? strlen(rmacpath) : 0) + 1);
+
+	for(int i=0; i<argc; i++)
+		WriteAll(sock, argv[i], strlen(argv[i]) + 1);
+
+	shutdown(sock, SHUT_WR);
+
+	// Pass on what comes back, except for the last byte: the error count
+	char buf[4096];
+	int status = -1;
+	ssize_t n;
+
+	while ((n = read(sock, buf, sizeof(buf))) != 0)
+	{
+		if (n < 0)
+		{
+			if (errno == EINTR)
+				continue;
+
+			break;
+		}
+
+		if (status >= 0)
+			putchar(status);
+
+		fwrite(buf, 1, n - 1, stdout);
+		status = (uint8_t)buf[n - 1];
+	}
+
+	close(sock);
+
+	if (status < 0)
+	{
+		printf("--connect: no answer from the server on %s\n", path);
+		return 1;
+	}
+
+	return status;
+}
+
+#else
+
+int RunServer(char * path)
+{
+	printf("--server: not available on this platform\n");
+	return 1;
+}
+
+int RunClient(char * path, int argc, char ** argv)
+{
+	return -1;
+}
+
+#endif
+
@@ -0,0 +1,19 @@
+//
+// RMAC - Renamed Macro Assembler for all Atari computers
+// SERVER.H - Resident Assembler Server
+// Copyright (C) 199x Landon Dyer, 2011-2022 Reboot and Friends
+// RMAC derived from MADMAC v1.07 Written by Landon Dyer, 1986
+// Source utilised with the kind permission of Landon Dyer
+//
+
+#ifndef __SERVER_H__
+#define __SERVER_H__
+
+#include "rmac.h"
+
+// Exported functions
+int RunServer(char *);
+int RunClient(char *, int, char **);
+
+#endif // __SERVER_H__
+
@@ -0,0 +1,218 @@
+//
+// RMAC - Renamed Macro Assembler for all Atari computers
+// SNAPSHOT.C - Snapshots at Include Boundaries
+// Copyright (C) 199x Landon Dyer, 2011-2022 Reboot and Friends
+// RMAC derived from MADMAC v1.07 Written by Landon Dyer, 1986
+// Source utilised with the kind permission of Landon Dyer
+//
+// With "rmac --watch --snapshots ...", the assembler's state is kept as it
+// was at the start of each .include in the top level source file, so the next
+// assembly can go on from there if nothing read before it has changed.
+//
+// Rather than copying out the symbol table, sections, fixups, marks, macros,
+// .if stack and the rest, the whole process is kept: at each .include it
+// forks, the child goes on with the assembly and the parent (the snapshot)
+// waits. When it gets SIGUSR1, it forks again and a new child assembles from
+// the .include on; SIGKILL is how a snapshot that's no longer any use goes.
+//
+// What the processes tell the one running --watch goes down 'snap_fd', a line
+// at a time (only one of them is ever assembling):
+//
+//   F <hash> <name>   a file read (hash of its contents), or looked for and
+//                     not found (hash all '-'), since the last snapshot
+//   S <pid>           a snapshot, depending on all of the files so far
+//   R <pid>           the process now doing the assembly
+//   W <found> <name>  once done, all of the files read or looked for
+//   D <errors>        done
+//
+
+#include "snapshot.h"
+#include "cache.h"
+#include "error.h"
+#include "token.h"
+
+// Exported variables
+ASMCTX int snap_fd = -1;				// Where snapshots are reported (-1: not taken)
+
+#if !defined(WIN32) && !defined(WIN64)
+#include <errno.h>
+#include <signal.h>
+#include <stdarg.h>
+
+#ifdef __linux__
+#include <sys/prctl.h>
+#endif
+
+// Internal variables
+static ASMCTX int nreported;			// # of infiles reported so far
+static ASMCTX volatile sig_atomic_t resume;	// Set on SIGUSR1
+
+//
+// Send a line to the process running --watch
+//
+static void Report(const char * text, ...)
+{
+	char buf[FNSIZ * 4 + 128];
+	va_list arg;
+
+	va_start(arg, text);
+	int size = vsnprintf(buf, sizeof(buf), text, arg);
+	va_end(arg);
+
+	if (size >= (int)sizeof(buf))
+		size = sizeof(buf) - 1;
+
+	for(char * p=buf; size>0; )
+	{
+		ssize_t n = write(snap_fd, p, size);
+
+		if (n < 0 && errno == EINTR)
+			continue;
+
+		if (n <= 0)
+			return;
+
+		p += n;
+		size -= n;
+	}
+}
+
+static void Resume(int sig)
+{
+	resume = 1;
+}
+
+//
+// Called in each new process: it goes when the one that started it does, so
+// nothing's left behind once --watch is stopped
+//
+static void FollowParent(int parent)
+{
+#ifdef __linux__
+	prctl(PR_SET_PDEATHSIG, SIGKILL);
+#endif
+
+	if (getppid() != parent)
+		_exit(1);
+}
+
+//
+// Report the files read since the last snapshot, with their hashes
+//
+static void ReportNewFiles(void)
+{
+	char hash[HASHSIZE];
+	int n = 0;
+
+	for(INFILE * inf=infiles; inf!=NULL; inf=inf->next, n++)
+	{
+		if (n < nreported)
+			continue;
+
+		// A file that can't be read now never matches
+		if (!inf->found)
+			memset(hash, '-', HASHSIZE - 1);
+		else if (HashFile(inf->name, hash) != OK)
+			memset(hash, '?', HASHSIZE - 1);
+
+		hash[HASHSIZE - 1] = EOS;
+		Report("F %s %s\n", hash, inf->name);
+	}
+
+	nreported = n;
+}
+
+//
+// Set up for snapshots to be reported on 'fd', in a process started by
+// 'parent'
+//
+void SnapshotStart(int fd, int parent)
+{
+	FollowParent(parent);
+	snap_fd = fd;
+	nreported = 0;
+	Report("R %d\n", (int)getpid());
+}
+
+//
+// Take a snapshot; called at the start of each top level .include. Returns in
+// the process that's to go on with the assembly.
+//
+void Snapshot(void)
+{
+	sigset_t mask, wait;
+
+	if (snap_fd < 0)
+		return;
+
+	ReportNewFiles();
+
+	// Where the listing & error file were, as that's where a resumed
+	// assembly's writes go (what's still in their buffers is written later)
+	off_t listpos = (list_fd > 0 ? lseek(list_fd, 0, SEEK_CUR) : -1);
+	off_t errpos = (err_flag ? lseek(err_fd, 0, SEEK_CUR) : -1);
+
+	signal(SIGUSR1, Resume);
+	sigemptyset(&mask);
+	sigaddset(&mask, SIGUSR1);
+	sigprocmask(SIG_BLOCK, &mask, &wait);
+	sigdelset(&wait, SIGUSR1);
+	fflush(stdout);
+
+	pid_t self = getpid();
+	Report("S %d\n", (int)self);
+
+	for(;;)
+	{
+		pid_t pid = fork();
+
+		if (pid == 0)
+			break;
+
+		// Can't fork: go on without it, as if it had been thrown away
+		if (pid < 0)
+			return;
+
+		for(resume=0; !resume; )
+			sigsuspend(&wait);
+	}
+
+	FollowParent(self);
+	Report("R %d\n", (int)getpid());
+
+	if (listpos >= 0 && ftruncate(list_fd, listpos) == 0)
+		lseek(list_fd, listpos, SEEK_SET);
+
+	if (errpos >= 0 && ftruncate(err_fd, errpos) == 0)
+		lseek(err_fd, errpos, SEEK_SET);
+}
+
+//
+// The assembly's done, with 'errors' errors
+//
+void SnapshotDone(int errors)
+{
+	fflush(stdout);
+
+	for(INFILE * inf=infiles; inf!=NULL; inf=inf->next)
+		Report("W %d %s\n", inf->found, inf->name);
+
+	Report("D %d\n", errors);
+}
+
+#else
+
+void SnapshotStart(int fd, int parent)
+{
+}
+
+void Snapshot(void)
+{
+}
+
+void SnapshotDone(int errors)
+{
+}
+
+#endif
+
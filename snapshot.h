@@ -0,0 +1,23 @@
+//
+// RMAC - Renamed Macro Assembler for all Atari computers
+// SNAPSHOT.H - Snapshots at Include Boundaries
+// Copyright (C) 199x Landon Dyer, 2011-2022 Reboot and Friends
+// RMAC derived from MADMAC v1.07 Written by Landon Dyer, 1986
+// Source utilised with the kind permission of Landon Dyer
+//
+
+#ifndef __SNAPSHOT_H__
+#define __SNAPSHOT_H__
+
+#include "rmac.h"
+
+// Exported variables
+extern ASMCTX int snap_fd;
+
+// Exported functions
+void SnapshotStart(int, int);
+void Snapshot(void);
+void SnapshotDone(int);
+
+#endif // __SNAPSHOT_H__
+
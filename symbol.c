@@ -6,6 +6,7 @@
 // Source utilised with the kind permission of Landon Dyer
 //
 
+#include "rmac.h"
 #include "symbol.h"
 #include "dsp56k.h"
 #include "error.h"
@@ -17,14 +18,14 @@
 // Macros
 #define NBUCKETS 256				// Number of hash buckets (power of 2)
 
-static SYM * symbolTable[NBUCKETS];	// User symbol-table header
-int curenv;							// Current enviroment number
-static SYM * sorder;				// * -> Symbols, in order of reference
-static SYM * sordtail;				// * -> Last symbol in sorder list
-static SYM * sdecl;					// * -> Symbols, in order of declaration
-static SYM * sdecltail;				// * -> Last symbol in sdecl list
-static uint32_t currentUID;			// Symbol UID tracking (done by NewSymbol())
-uint32_t firstglobal; // Index of the first global symbol in an ELF object.
+static ASMCTX SYM * symbolTable[NBUCKETS];	// User symbol-table header
+ASMCTX int curenv;							// Current enviroment number
+static ASMCTX SYM * sorder;				// * -> Symbols, in order of reference
+static ASMCTX SYM * sordtail;				// * -> Last symbol in sorder list
+static ASMCTX SYM * sdecl;					// * -> Symbols, in order of declaration
+static ASMCTX SYM * sdecltail;				// * -> Last symbol in sdecl list
+static ASMCTX uint32_t currentUID;			// Symbol UID tracking (done by NewSymbol())
+ASMCTX uint32_t firstglobal; // Index of the first global symbol in an ELF object.
 
 // Tags for marking symbol spaces:
 // a = absolute
@@ -44,6 +45,25 @@ static uint16_t WriteLODSection(int, uint16_t);
 //
 void InitSymbolTable(void)
 {
+	// Free the last assembly's symbols (all of them are on the sorder list),
+	// and the lines of its macros
+	while (sorder != NULL)
+	{
+		SYM * sy = sorder;
+		sorder = sy->sorder;
+
+		while (sy->lineList != NULL)
+		{
+			LLIST * ll = sy->lineList;
+			sy->lineList = ll->next;
+			free(ll->line);
+			free(ll);
+		}
+
+		free(sy->sname);
+		free(sy);
+	}
+
 	for(int i=0; i<NBUCKETS; i++)			// Initialise symbol hash table
 		symbolTable[i] = NULL;
 
@@ -98,6 +118,8 @@ SYM * NewSymbol(const uint8_t * name, int type, int envno)
 	symbol->sattre = 0;
 	symbol->svalue = 0;
 	symbol->sorder = NULL;
+	symbol->lineList = NULL;
+	symbol->last   = NULL;
 	symbol->uid    = currentUID++;
 	// We don't set st_type, st_desc, or st_other here because they are only
 	// used by stabs debug symbols, which are always initialized by
@@ -562,6 +584,8 @@ int symtable(void)
 		eject();
 	}
 
+	free(sy);
+
 	return 0;
 }
 
@@ -43,8 +43,8 @@ SYM
 };
 
 // Exported variables
-extern int curenv;
-extern uint32_t firstglobal;// Index of the fist global symbol in an ELF object.
+extern ASMCTX int curenv;
+extern ASMCTX uint32_t firstglobal;// Index of the fist global symbol in an ELF object.
 
 // Exported functions
 SYM * lookup(uint8_t *, int, int);
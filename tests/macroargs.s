@@ -0,0 +1,34 @@
+; Macro arguments go into expanded lines as tokens. Listing must not change
+; that: "make check" assembles this with and without -l and compares the
+; objects, which have to be the same.
+
+	.macro hi
+	dc.l \1>>32
+	dc.l \1
+	.endm
+
+	.macro flt
+	dc.s \1
+	dc.d \1
+	.endm
+
+	.macro rep
+	.rept 2
+	dc.l \1>>32, \1
+	dc.d \2
+	.endr
+	.endm
+
+	.macro byt
+	dc.b \1,\1+1
+	.endm
+
+	hi $123456789ab
+	hi 7
+	flt 1.5
+	flt 0.1
+	flt 1.0
+	flt 100000000000000000000.0
+	flt 0.0000001
+	rep $fedcba9876543210,2.718281828
+	byt 'x'
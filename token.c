@@ -9,6 +9,12 @@
 #include "token.h"
 
 #include <errno.h>
+#include <time.h>
+
+#if !defined(WIN32) && !defined(WIN64)
+#include <sys/mman.h>
+#endif
+#include "cache.h"
 #include "direct.h"
 #include "error.h"
 #include "macro.h"
@@ -28,35 +34,84 @@
 #include "unarytab.h"		// Incl generated unary tables & defs
 
 
-int lnsave;					// 1; strcpy() text of current line
-uint32_t curlineno;			// Current line number (64K max currently)
-int totlines;				// Total # of lines
-int mjump_align = 0;		// mjump alignment flag
-char lntag;					// Line tag
-char * curfname;			// Current filename
-char tolowertab[128];		// Uppercase ==> lowercase
-int8_t hextab[128];			// Table of hex values
-char dotxtab[128];			// Table for ".b", ".s", etc.
-char irbuf[LNSIZ];			// Text for .rept block line
-char lnbuf[LNSIZ];			// Text of current line
-WORD filecount;				// Unique file number counter
-WORD cfileno;				// Current file number
-TOKEN * tok;				// Ptr to current token
-TOKEN * etok;				// Ptr past last token in tokbuf[]
+ASMCTX int lnsave;					// 1; strcpy() text of current line
+ASMCTX uint32_t curlineno;			// Current line number (64K max currently)
+ASMCTX int totlines;				// Total # of lines
+ASMCTX int mjump_align = 0;		// mjump alignment flag
+ASMCTX char lntag;					// Line tag
+ASMCTX char * curfname;			// Current filename
+ASMCTX char tolowertab[128];		// Uppercase ==> lowercase
+ASMCTX int8_t hextab[128];			// Table of hex values
+ASMCTX char dotxtab[128];			// Table for ".b", ".s", etc.
+ASMCTX char irbuf[LNSIZ];			// Text for .rept block line
+ASMCTX char lnbuf[LNSIZ];			// Text of current line
+ASMCTX WORD filecount;				// Unique file number counter
+ASMCTX WORD cfileno;				// Current file number
+ASMCTX TOKEN * tok;				// Ptr to current token
+ASMCTX TOKEN * etok;				// Ptr past last token in tokbuf[]
 TOKEN tokeol[1] = {EOL};	// Bailout end-of-line token
-char * string[TOKBUFSIZE*2];// Token buffer string pointer storage
-int optimizeOff;			// Optimization override flag
+ASMCTX char * string[TOKBUFSIZE*2];// Token buffer string pointer storage
+ASMCTX int optimizeOff;			// Optimization override flag
+
+
+ASMCTX FILEREC * filerec;
+ASMCTX FILEREC * last_fr;
+ASMCTX INFILE * infiles;			// Files read (or looked for) by this assembly
+
+ASMCTX INOBJ * cur_inobj;			// Ptr current input obj (IFILE/IMACRO)
+// Input objects are only ever popped in the reverse of the order they were
+// pushed, so they (and whatever goes with them) are carved out of a stack of
+// blocks. Blocks are kept for the rest of the assembly once allocated, so
+// there's no malloc() at all once the deepest nesting so far has been
+// reached, and fpop() gives back everything above the object it pops in one
+// go.
+#define INBLOCKSIZE	0x10000		// Usual size of an input stack block
+
+INBLOCK {
+	INBLOCK * next;			// Block above this one
+	size_t size;			// # bytes in this block
+	size_t used;			// # bytes of it in use
+};
+
+static ASMCTX INBLOCK * inbase;	// Bottom of the input stack
+static ASMCTX INBLOCK * inblock;	// Block in use at the top (NULL: stack empty)
 
+static ASMCTX TOKEN tokbuf[TOKBUFSIZE];	// Token buffer (stack-like, all files)
 
-FILEREC * filerec;
-FILEREC * last_fr;
+// In-memory source files (handed to us through librmac, or cached files)
+#define MEMSRC struct _memsrc
+MEMSRC
+{
+	char * name;			// Name it's opened by (NULL: a cached file)
+	const char * text;		// Text (not NUL terminated; ours if cached)
+	size_t size;			// Its size
+	char * path;			// Cached file's full name (see PruneSourceCache())
+	dev_t dev;				// Cached file's identity
+	ino_t ino;
+	time_t mtime;			// Cached file's time stamp
+	int racy;				// 1, changed too recently to trust mtime
+};
 
-INOBJ * cur_inobj;			// Ptr current input obj (IFILE/IMACRO)
-static INOBJ * f_inobj;		// Ptr list of free INOBJs
-static IFILE * f_ifile;		// Ptr list of free IFILEs
-static IMACRO * f_imacro;	// Ptr list of free IMACROs
+static ASMCTX MEMSRC * memsrc;		// In-memory sources
+static ASMCTX int nmemsrc;			// # of them
+ASMCTX int srccache_flag;			// 1, keep source files in memory once read
+ASMCTX int keepinputs_flag;			// 1, keep infiles after the assembly
 
-static TOKEN tokbuf[TOKBUFSIZE];	// Token buffer (stack-like, all files)
+// Binary files read for .incbin, kept for the rest of the assembly
+#define BINFILE struct _binfile
+BINFILE
+{
+	BINFILE * next;
+	char * name;			// Name it was opened by
+	uint8_t * data;			// Its contents
+	size_t size;			// Its size
+	int mapped;				// 1, data is mmap()ed (else it's malloc()ed)
+};
+
+static ASMCTX BINFILE * binfiles;	// Binary files read so far
+
+static ASMCTX INFILE * lastinput;	// File OpenSource() last opened, for include()
+static ASMCTX int lastinputhandle;	// Its handle
 
 uint8_t chrtab[0x100] = {
 	ILLEG, ILLEG, ILLEG, ILLEG,			// NUL SOH STX ETX
@@ -155,6 +210,65 @@ static char * regname[] = {
 };
 
 
+static void FreeInfiles(void)
+{
+	while (infiles != NULL)
+	{
+		INFILE * inf = infiles;
+		infiles = inf->next;
+		free(inf->name);
+		free(inf);
+	}
+}
+
+
+//
+// Free the last assembly's input stack, file names and binary files. With
+// keepinputs_flag, the list of the files it read (infiles) is kept until the
+// next one starts.
+//
+void FreeInputs(void)
+{
+	curfname = "";							// No file, empty filename
+	inblock = NULL;
+	cur_inobj = NULL;
+
+	while (inbase != NULL)
+	{
+		INBLOCK * block = inbase;
+		inbase = block->next;
+		free(block);
+	}
+
+	while (filerec != NULL)
+	{
+		FILEREC * fr = filerec;
+		filerec = fr->frec_next;
+		free(fr->frec_name);
+		free(fr);
+	}
+
+	last_fr = NULL;
+
+	while (binfiles != NULL)
+	{
+		BINFILE * bf = binfiles;
+		binfiles = bf->next;
+#if !defined(WIN32) && !defined(WIN64)
+		if (bf->mapped)
+			munmap(bf->data, bf->size);
+		else
+#endif
+		free(bf->data);
+		free(bf->name);
+		free(bf);
+	}
+
+	if (!keepinputs_flag)
+		FreeInfiles();
+}
+
+
 //
 // Initialize tokenizer
 //
@@ -164,18 +278,14 @@ void InitTokenizer(void)
 	char * htab = "0123456789abcdefABCDEF";	// Hex character table
 
 	lnsave = 0;								// Don't save lines
-	curfname = "";							// No file, empty filename
 	filecount = (WORD)-1;
 	cfileno = (WORD)-1;						// cfileno gets bumped to 0
 	curlineno = 0;
 	totlines = 0;
 	etok = tokbuf;
-	f_inobj = NULL;
-	f_ifile = NULL;
-	f_imacro = NULL;
-	cur_inobj = NULL;
-	filerec = NULL;
-	last_fr = NULL;
+	FreeInputs();
+	FreeInfiles();
+
 	lntag = SPACE;
 
 	// Initialize hex, "dot" and tolower tables
@@ -216,16 +326,14 @@ void InitTokenizer(void)
 }
 
 
-void SetFilenameForErrorReporting(void)
+//
+// Return the name of file # 'fnum', for error messages
+//
+char * FileName(WORD fnum)
 {
-	WORD fnum = cfileno;
-
 	// Check for absolute top filename (this should never happen)
 	if (fnum == (uint16_t)-1)
-	{
-		curfname = "(*top*)";
-		return;
-	}
+		return "(*top*)";
 
 	FILEREC * fr = filerec;
 
@@ -238,61 +346,78 @@ void SetFilenameForErrorReporting(void)
 
 	// Check for file # record not found (this should never happen either)
 	if (fr == NULL)
-	{
-		curfname = "(*NOT FOUND*)";
-		return;
-	}
+		return "(*NOT FOUND*)";
 
-	curfname = fr->frec_name;
+	return fr->frec_name;
+}
+
+
+void SetFilenameForErrorReporting(void)
+{
+	curfname = FileName(cfileno);
 }
 
 
 //
-// Allocate an IFILE or IMACRO
+// Allocate 'size' bytes on the input stack; they last until the input object
+// on top of the stack is popped
 //
-INOBJ * a_inobj(int typ)
+void * AllocInput(size_t size)
 {
-	INOBJ * inobj;
-	IFILE * ifile;
-	IMACRO * imacro;
+	size = (size + 7) & ~(size_t)7;
 
-	// Allocate and initialize INOBJ first
-	if (f_inobj == NULL)
-		inobj = malloc(sizeof(INOBJ));
-	else
+	if (inblock == NULL || inblock->used + size > inblock->size)
 	{
-		inobj = f_inobj;
-		f_inobj = f_inobj->in_link;
+		INBLOCK * block = (inblock == NULL ? inbase : inblock->next);
+
+		// Put a new block in if the next one's missing, or too small
+		if (block == NULL || block->size < size)
+		{
+			size_t bsize = (size > INBLOCKSIZE ? size : INBLOCKSIZE);
+			INBLOCK * new = malloc(sizeof(INBLOCK) + bsize);
+			new->next = block;
+			new->size = bsize;
+
+			if (inblock == NULL)
+				inbase = new;
+			else
+				inblock->next = new;
+
+			block = new;
+		}
+
+		block->used = 0;
+		inblock = block;
 	}
 
+	void * p = (uint8_t *)(inblock + 1) + inblock->used;
+	inblock->used += size;
+
+	return p;
+}
+
+
+//
+// Allocate an IFILE, IMACRO or IREPT
+//
+INOBJ * a_inobj(int typ)
+{
+	INBLOCK * block = inblock;
+	size_t used = (inblock == NULL ? 0 : inblock->used);
+	INOBJ * inobj = AllocInput(sizeof(INOBJ));
+
 	switch (typ)
 	{
 	case SRC_IFILE:							// Alloc and init an IFILE
-		if (f_ifile == NULL)
-			ifile = malloc(sizeof(IFILE));
-		else
-		{
-			ifile = f_ifile;
-			f_ifile = f_ifile->if_link;
-		}
-
-		inobj->inobj.ifile = ifile;
+		inobj->inobj.ifile = AllocInput(sizeof(IFILE));
 		break;
 
 	case SRC_IMACRO:						// Alloc and init an IMACRO
-		if (f_imacro == NULL)
-			imacro = malloc(sizeof(IMACRO));
-		else
-		{
-			imacro = f_imacro;
-			f_imacro = f_imacro->im_link;
-		}
-
-		inobj->inobj.imacro = imacro;
+		inobj->inobj.imacro = AllocInput(sizeof(IMACRO));
 		break;
 
 	case SRC_IREPT:							// Alloc and init an IREPT
-		inobj->inobj.irept = malloc(sizeof(IREPT));
+		inobj->inobj.irept = AllocInput(sizeof(IREPT));
 		DEBUG { printf("alloc IREPT\n"); }
 		break;
 	}
@@ -303,21 +428,202 @@ INOBJ * a_inobj(int typ)
 	inobj->in_otok = tok;
 	inobj->in_etok = etok;
 	inobj->in_link = cur_inobj;
+	inobj->in_block = block;
+	inobj->in_used = used;
 	cur_inobj = inobj;
 
 	return inobj;
 }
 
 
+//
+// Convert a macro argument (a string of tokens terminated with EOL) back into
+// text at 'dst'. Numbers come out in a form that tokenizes back to the same
+// value (hex for integers, all 64 bits of them). Returns where the text ends,
+// or NULL if it doesn't fit before 'edst'.
+//
+static char * ArgumentText(TOKEN * tk, char ** symbolString, char * dst, char * edst)
+{
+	char numbuf[32];		// Buffer for text of CONSTs & FCONSTs
+	char * d;
+	PTR tp;
+
+	while (*tk != EOL)
+	{
+		// Reverse-translation from a token number to a string.
+		// This is a hack. It might be better table-driven.
+		d = NULL;
+
+		if (*tk >= REG68_D0)
+			d = regname[(int)*tk++ - REG68_D0];
+		else
+		{
+			switch ((int)*tk++)
+			{
+			case SYMBOL:
+				d = symbolString[*tk++];
+DEBUG { printf("ExM: SYMBOL=\"%s\"", d); }
+				break;
+			case STRING:
+			case STRINGA8:
+			{
+				char q = (*(tk - 1) == STRING ? '"' : '\'');
+				d = symbolString[*tk++];
+
+				if (dst >= edst)
+					return NULL;
+
+				*dst++ = q;
+
+				while (*d != EOS)
+				{
+					if (dst >= edst)
+						return NULL;
+
+					*dst++ = *d++;
+				}
+
+				if (dst >= edst)
+					return NULL;
+
+				*dst++ = q;
+				continue;
+			}
+			case CONST:
+				tp.u32 = tk;
+				sprintf(numbuf, "$%" PRIX64, *tp.u64);
+				tk += 2;
+				d = numbuf;
+				break;
+			case FCONST:
+			{
+				// Shortest text that reads back as the same double; the
+				// tokenizer only takes it as a float with digits after a '.'
+				tp.u32 = tk;
+				tk += 2;
+
+				for(int prec=1; prec<=17; prec++)
+				{
+					sprintf(numbuf, "%.*g", prec, *tp.dp);
+
+					if (strtod(numbuf, NULL) == *tp.dp)
+						break;
+				}
+
+				if (strchr(numbuf, '.') == NULL)
+				{
+					char * e = strchr(numbuf, 'e');
+
+					if (e == NULL)
+						e = numbuf + strlen(numbuf);
+
+					memmove(e + 2, e, strlen(e) + 1);
+					e[0] = '.';
+					e[1] = '0';
+				}
+
+				d = numbuf;
+				break;
+			}
+			case DEQUALS:
+				d = "==";
+				break;
+			case SET:
+				d = "set";
+				break;
+			case COLON:
+				d = ":";
+				break;
+			case DCOLON:
+				d = "::";
+				break;
+			case GE:
+				d = ">=";
+				break;
+			case LE:
+				d = "<=";
+				break;
+			case NE:
+				d = "<>";
+				break;
+			case SHR:
+				d = ">>";
+				break;
+			case SHL:
+				d = "<<";
+				break;
+			case DOTB:
+				d = ".b";
+				break;
+			case DOTW:
+				d = ".w";
+				break;
+			case DOTL:
+				d = ".l";
+				break;
+			case CR_ABSCOUNT:
+				d = "^^abscount";
+				break;
+			case CR_FILESIZE:
+				d = "^^filesize";
+				break;
+			case CR_DATE:
+				d = "^^date";
+				break;
+			case CR_TIME:
+				d = "^^time";
+				break;
+			case CR_DEFINED:
+				d = "^^defined ";
+				break;
+			case CR_REFERENCED:
+				d = "^^referenced ";
+				break;
+			case CR_STREQ:
+				d = "^^streq ";
+				break;
+			case CR_MACDEF:
+				d = "^^macdef ";
+				break;
+			default:
+				if (dst >= edst)
+					return NULL;
+
+				*dst++ = (char)*(tk - 1);
+				break;
+			}
+		}
+
+		// If 'd' != NULL, copy string to destination
+		if (d != NULL)
+		{
+			DEBUG printf("d='%s'\n", d);
+
+			while (*d != EOS)
+			{
+				if (dst >= edst)
+					return NULL;
+
+				*dst++ = *d++;
+			}
+		}
+	}
+
+	return dst;
+}
+
+
 //
 // Perform macro substitution from 'orig' to 'dest'. Return OK or some error.
 // A macro reference is in one of two forms:
 // \name <non-name-character>
 // \{name}
 // A doubled backslash (\\) is compressed to a single backslash (\).
-// Argument definitions have been pre-tokenized, so we have to turn them back
-// into text. This means that numbers, in particular, become hex, regardless of
-// their representation when the macro was invoked. This is a hack.
+// Argument definitions have been pre-tokenized. An argument standing on its own
+// (not in a string, nor pasted onto other text) is left for the tokenizer to
+// copy its tokens in (see ARGSPLICE); otherwise it's turned back into text
+// (see ArgumentText()). Lines kept for listings or definitions get the text of
+// spliced arguments from TokenizeLine().
 // A label may appear at the beginning of the line:
 // :<name><whitespace>
 // (the colon must be in the first column). These labels are stripped before
@@ -340,6 +646,7 @@ int ExpandMacro(char * src, char * dest, int destsiz)
 
 	char * dst = dest;						// Next dest slot
 	char * edst = dest + destsiz - 1;		// End + 1(?) of dest buffer
+	char quote = 0;							// Quote of the string we're in
 
 	// Check for (and skip over) any "label" on the line
 	char * s = src;
@@ -368,6 +675,11 @@ int ExpandMacro(char * src, char * dest, int destsiz)
 			if ((*s == ';') || ((*s == '/') && (*(s + 1) == '/')))
 				goto skipcomments;
 
+			if (*s == '"' || *s == '\'')
+				quote = (quote == 0 ? *s : quote == *s ? 0 : quote);
+			else if (*s == ARGSPLICE && quote == 0)
+				return error("illegal character $%02X found", *s);
+
 			*dst++ = *s++;
 		}
 		// Do macro expansion
@@ -500,144 +812,22 @@ arg_num:
 					continue;
 				}
 
-				// Argument # is in range, so expand it
-				if (tk != NULL)
+				// An argument on its own goes in as its tokens
+				if (tk != NULL && quote == 0 && dst > dest
+					&& strchr(" \t,([#+-*/&|^~=", dst[-1]) != NULL
+					&& strchr(" \t,()[]+-*/;&|^<>=!", *s) != NULL)
 				{
-					while (*tk != EOL)
-					{
-						// Reverse-translation from a token number to a string.
-						// This is a hack. It might be better table-driven.
-						d = NULL;
-
-						if (*tk >= REG68_D0)
-						{
-							d = regname[(int)*tk++ - REG68_D0];
-							goto strcopy;
-						}
-						else
-						{
-							switch ((int)*tk++)
-							{
-							case SYMBOL:
-								d = symbolString[*tk++];
-DEBUG { printf("ExM: SYMBOL=\"%s\"", d); }
-								break;
-							case STRING:
-								d = symbolString[*tk++];
-
-								if (dst >= edst)
-									goto overflow;
-
-								*dst++ = '"';
-
-								while (*d != EOS)
-								{
-									if (dst >= edst)
-										goto overflow;
-									else
-										*dst++ = *d++;
-								}
-
-								if (dst >= edst)
-									goto overflow;
-
-								*dst++ = '"';
-								continue;
-								break;
-// Shamus: Changing the format specifier from %lx to %ux caused the assembler
-//         to choke on legitimate code... Need to investigate this further
-//         before changing anything else here!
-							case CONST:
-//								sprintf(numbuf, "$%lx", (uint64_t)*tk++);
-								sprintf(numbuf, "$%" PRIX64, (uint64_t)*tk++);
-								tk++;
-								d = numbuf;
-								break;
-							case DEQUALS:
-								d = "==";
-								break;
-							case SET:
-								d = "set";
-								break;
-							case COLON:
-								d = ":";
-								break;
-							case DCOLON:
-								d = "::";
-								break;
-							case GE:
-								d = ">=";
-								break;
-							case LE:
-								d = "<=";
-								break;
-							case NE:
-								d = "<>";
-								break;
-							case SHR:
-								d = ">>";
-								break;
-							case SHL:
-								d = "<<";
-								break;
-							case DOTB:
-								d = ".b";
-								break;
-							case DOTW:
-								d = ".w";
-								break;
-							case DOTL:
-								d = ".l";
-								break;
-							case CR_ABSCOUNT:
-								d = "^^abscount";
-								break;
-							case CR_FILESIZE:
-								d = "^^filesize";
-								break;
-							case CR_DATE:
-								d = "^^date";
-								break;
-							case CR_TIME:
-								d = "^^time";
-								break;
-							case CR_DEFINED:
-								d = "^^defined ";
-								break;
-							case CR_REFERENCED:
-								d = "^^referenced ";
-								break;
-							case CR_STREQ:
-								d = "^^streq ";
-								break;
-							case CR_MACDEF:
-								d = "^^macdef ";
-								break;
-							default:
-								if (dst >= edst)
-									goto overflow;
-
-								*dst++ = (char)*(tk - 1);
-								break;
-							}
-						}
+					if (dst + 1 >= edst)
+						goto overflow;
 
-						// If 'd' != NULL, copy string to destination
-						if (d != NULL)
-						{
-strcopy:
-							DEBUG printf("d='%s'\n", d);
-
-							while (*d != EOS)
-							{
-								if (dst >= edst)
-									goto overflow;
-								else
-									*dst++ = *d++;
-							}
-						}
-					}
+					*dst++ = ARGSPLICE;
+					*dst++ = (char)(i + 1);
+					continue;
 				}
+
+				// Argument # is in range, so expand it
+				if (tk != NULL && (dst = ArgumentText(tk, symbolString, dst, edst)) == NULL)
+					goto overflow;
 			}
 		}
 	}
@@ -752,6 +942,24 @@ int include(int handle, char * fname)
 
 	ifile->ifhandle = handle;			// Setup file handle
 	ifile->ifind = ifile->ifcnt = 0;	// Setup buffer indices
+
+	if (handle <= MEMHANDLE)			// Reading from memory?
+	{
+		ifile->ifmem = memsrc[MEMHANDLE - handle].text;
+		ifile->ifmemleft = memsrc[MEMHANDLE - handle].size;
+	}
+
+	// For the output cache, what's read is hashed as it's read
+	ifile->ifinput = NULL;
+
+	if (lastinput != NULL && handle == lastinputhandle && CacheHashing())
+	{
+		ifile->ifinput = lastinput;
+		SHA256Init(&ifile->ifsha);
+	}
+
+	lastinput = NULL;
+
 	ifile->ifoldlineno = curlineno;		// Save old line number
 	ifile->ifoldfname = curfname;		// Save old filename
 	ifile->ifno = cfileno;				// Save old file number
@@ -778,6 +986,350 @@ int include(int handle, char * fname)
 }
 
 
+//
+// Open a source file through the source cache (see srccache_flag). Files are
+// known by their identity rather than their name, as names are relative to
+// whichever directory an assembly is run in; a file whose size or time stamp
+// has changed since it was cached is read in again. Time stamps only go by the
+// second, so files modified within a second of being cached are always read
+// again.
+//
+static int CachedSource(char * fname)
+{
+	struct stat st;
+	int i, handle;
+
+	if (stat(fname, &st) != 0)
+		return -1;
+
+	for(i=0; i<nmemsrc; i++)
+	{
+		if (memsrc[i].name == NULL && memsrc[i].dev == st.st_dev
+			&& memsrc[i].ino == st.st_ino)
+		{
+			if (!memsrc[i].racy && memsrc[i].size == (size_t)st.st_size
+				&& memsrc[i].mtime == st.st_mtime)
+				return MEMHANDLE - i;
+
+			break;
+		}
+	}
+
+	if ((handle = open(fname, _OPEN_INC)) < 0)
+		return handle;
+
+	char * text = malloc(st.st_size + 1);
+	size_t size = 0;
+	ssize_t n;
+
+	while (size < (size_t)st.st_size
+		&& (n = read(handle, text + size, st.st_size - size)) > 0)
+		size += n;
+
+	if (size != (size_t)st.st_size)
+	{
+		// Changing under us; just read it the usual way
+		free(text);
+		lseek(handle, 0, SEEK_SET);
+		return handle;
+	}
+
+	close(handle);
+
+	if (i == nmemsrc)
+	{
+		memsrc = realloc(memsrc, (nmemsrc + 1) * sizeof(MEMSRC));
+		nmemsrc++;
+	}
+	else
+	{
+		free((char *)memsrc[i].text);
+		free(memsrc[i].path);
+	}
+
+	// (Assemblies may be run in other directories)
+	if ((memsrc[i].path = realpath(fname, NULL)) == NULL)
+		memsrc[i].path = strdup(fname);
+
+	memsrc[i].name = NULL;
+	memsrc[i].text = text;
+	memsrc[i].size = size;
+	memsrc[i].dev = st.st_dev;
+	memsrc[i].ino = st.st_ino;
+	memsrc[i].mtime = st.st_mtime;
+	memsrc[i].racy = (time(NULL) - st.st_mtime <= 1);
+
+	return MEMHANDLE - i;
+}
+
+
+//
+// Drop the cached files that have since been deleted, replaced or changed, so
+// a resident rmac (--server, --watch) doesn't hang on to them for good. This
+// renumbers the in-memory sources, so it's only for between assemblies.
+//
+void PruneSourceCache(void)
+{
+	struct stat st;
+	int n = 0;
+
+	for(int i=0; i<nmemsrc; i++)
+	{
+		MEMSRC * m = &memsrc[i];
+
+		if (m->name == NULL && (stat(m->path, &st) != 0
+			|| st.st_dev != m->dev || st.st_ino != m->ino
+			|| (size_t)st.st_size != m->size || st.st_mtime != m->mtime))
+		{
+			free((char *)m->text);
+			free(m->path);
+			continue;
+		}
+
+		memsrc[n++] = *m;
+	}
+
+	nmemsrc = n;
+}
+
+
+//
+// Open a source file by name for include(). In-memory sources are looked at
+// before the file system. Returns a handle, or -1 if there's no such file.
+//
+int OpenSource(char * fname)
+{
+	for(int i=0; i<nmemsrc; i++)
+	{
+		if (memsrc[i].name != NULL && strcmp(memsrc[i].name, fname) == 0)
+		{
+			CacheDontStore();
+			lastinput = NULL;
+			return MEMHANDLE - i;
+		}
+	}
+
+	int handle = (srccache_flag ? CachedSource(fname) : open(fname, 0));
+
+	INFILE * inf = NoteInput(fname, handle != -1);
+	lastinput = (handle != -1 ? inf : NULL);
+	lastinputhandle = handle;
+
+	return handle;
+}
+
+
+//
+// Open a file that's read other than as source (.incbin & co.)
+//
+int OpenInput(const char * fname)
+{
+	int fd = open(fname, _OPEN_INC);
+
+	NoteInput(fname, fd >= 0);
+
+	return fd;
+}
+
+
+//
+// Record the hash of what was read of a file. A file read twice over with
+// different contents can't go in the output cache.
+//
+static void NoteInputHash(INFILE * inf, const char * hash)
+{
+	if (inf->hash[0] == EOS)
+		strcpy(inf->hash, hash);
+	else if (strcmp(inf->hash, hash) != 0)
+		CacheDontStore();
+}
+
+
+//
+// Get the contents of binary file 'fname' (for .incbin), and its size. The
+// file is mapped in where possible, and kept for any further use in this
+// assembly. Returns NULL if it can't be opened.
+//
+const uint8_t * MapInput(const char * fname, size_t * size)
+{
+	BINFILE * bf;
+
+	for(bf=binfiles; bf!=NULL; bf=bf->next)
+	{
+		if (strcmp(bf->name, fname) == 0)
+		{
+			*size = bf->size;
+			return bf->data;
+		}
+	}
+
+	int fd = OpenInput(fname);
+	off_t end;
+
+	if (fd < 0)
+		return NULL;
+
+	if ((end = lseek(fd, 0L, SEEK_END)) < 0)
+		end = 0;
+
+	bf = malloc(sizeof(BINFILE));
+	bf->name = strdup(fname);
+	bf->size = end;
+	bf->mapped = 0;
+	bf->data = NULL;
+
+#if !defined(WIN32) && !defined(WIN64)
+	// (A mapped file changing under us could give other bytes than those
+	// hashed for the output cache, so then it's read in)
+	if (bf->size > 0 && !CacheHashing())
+	{
+		void * map = mmap(NULL, bf->size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+		if (map != MAP_FAILED)
+		{
+			bf->data = map;
+			bf->mapped = 1;
+		}
+	}
+#endif
+
+	// Can't be mapped: read it in
+	if (!bf->mapped)
+	{
+		size_t got = 0;
+		ssize_t n;
+
+		bf->data = malloc(bf->size + 1);
+		lseek(fd, 0L, SEEK_SET);
+
+		while (got < bf->size && (n = read(fd, bf->data + got, bf->size - got)) > 0)
+			got += n;
+
+		bf->size = got;
+	}
+
+	close(fd);
+	bf->next = binfiles;
+	binfiles = bf;
+	*size = bf->size;
+
+	if (CacheHashing())
+	{
+		SHA256 sha;
+		char hash[HASHSIZE];
+
+		SHA256Init(&sha);
+		SHA256Update(&sha, bf->data, bf->size);
+		SHA256Final(&sha, hash);
+		NoteInputHash(NoteInput(fname, 1), hash);
+	}
+
+	return bf->data;
+}
+
+
+//
+// Add a file to the list of files the assembly read (or, if not 'found',
+// looked for). The output cache and --watch go by it.
+//
+INFILE * NoteInput(const char * fname, int found)
+{
+	INFILE ** link = &infiles;
+
+	for(; *link!=NULL; link=&(*link)->next)
+	{
+		if (strcmp((*link)->name, fname) == 0)
+			return *link;
+	}
+
+	*link = malloc(sizeof(INFILE));
+	(*link)->next = NULL;
+	(*link)->name = strdup(fname);
+	(*link)->found = found;
+	(*link)->hash[0] = EOS;
+
+	return *link;
+}
+
+
+//
+// Done with a source file that's being hashed: hash whatever wasn't read of
+// it, and record the hash
+//
+static void FinishInputHash(IFILE * ifile)
+{
+	char buf[QUANTUM];
+	ssize_t n;
+
+	if (ifile->ifhandle >= 0)
+	{
+		while ((n = read(ifile->ifhandle, buf, sizeof(buf))) > 0)
+			SHA256Update(&ifile->ifsha, buf, n);
+
+		if (n < 0)
+		{
+			CacheDontStore();
+			return;
+		}
+	}
+	else
+		SHA256Update(&ifile->ifsha, ifile->ifmem, ifile->ifmemleft);
+
+	SHA256Final(&ifile->ifsha, buf);
+	NoteInputHash(ifile->ifinput, buf);
+}
+
+
+//
+// Make 'text' available as the source file 'name'. The text isn't copied, so
+// it has to stay put until ClearMemorySources().
+//
+void AddMemorySource(const char * name, const char * text, size_t size)
+{
+	memsrc = realloc(memsrc, (nmemsrc + 1) * sizeof(MEMSRC));
+	memsrc[nmemsrc].name = strdup(name);
+	memsrc[nmemsrc].text = text;
+	memsrc[nmemsrc].size = size;
+	nmemsrc++;
+}
+
+
+void ClearMemorySources(void)
+{
+	while (nmemsrc > 0)
+	{
+		nmemsrc--;
+
+		if (memsrc[nmemsrc].name == NULL)
+		{
+			free((char *)memsrc[nmemsrc].text);
+			free(memsrc[nmemsrc].path);
+		}
+		else
+			free(memsrc[nmemsrc].name);
+	}
+
+	free(memsrc);
+	memsrc = NULL;
+}
+
+
+//
+// Close every source file still open, after an assembly was given up on
+//
+void AbandonInput(void)
+{
+	for(INOBJ * inobj=cur_inobj; inobj!=NULL; inobj=inobj->in_link)
+	{
+		// (Not stdin, though; that isn't ours to close)
+		if (inobj->in_type == SRC_IFILE && inobj->inobj.ifile->ifhandle > 0)
+			close(inobj->inobj.ifile->ifhandle);
+	}
+
+	cur_inobj = NULL;
+}
+
+
 //
 // Pop the current input level
 //
@@ -814,9 +1366,13 @@ int fpop(void)
 		DEBUG { printf("[Leaving: %s]\n", curfname); }
 
 		IFILE * ifile = inobj->inobj.ifile;
-		ifile->if_link = f_ifile;
-		f_ifile = ifile;
-		close(ifile->ifhandle);			// Close source file
+
+		if (ifile->ifinput != NULL)
+			FinishInputHash(ifile);
+
+		if (ifile->ifhandle >= 0)
+			close(ifile->ifhandle);		// Close source file
+
 DEBUG { printf("[fpop (pre):  curfname=%s]\n", curfname); }
 		curfname = ifile->ifoldfname;	// Set current filename
 DEBUG { printf("[fpop (post): curfname=%s]\n", curfname); }
@@ -828,33 +1384,20 @@ DEBUG { printf("[fpop: (post) cfileno=%d ifile->ifno=%d]\n", (int)cfileno, (int)
 		break;
 	}
 
-	case SRC_IMACRO:					// Pop and release an IMACRO
-	{
-		IMACRO * imacro = inobj->inobj.imacro;
-		imacro->im_link = f_imacro;
-		f_imacro = imacro;
+	case SRC_IMACRO:					// Pop an IMACRO (and its arguments)
 		break;
-	}
 
-	case SRC_IREPT:						// Pop and release an IREPT
-	{
+	case SRC_IREPT:						// Pop an IREPT (and its lines)
 		DEBUG { printf("dealloc IREPT\n"); }
-		LLIST * p = inobj->inobj.irept->ir_firstln;
-
-		// Deallocate repeat lines
-		while (p != NULL)
-		{
-			free(p->line);
-			p = p->next;
-		}
-
 		break;
 	}
-	}
 
+	// Release the object, and everything allocated since it was pushed
 	cur_inobj = inobj->in_link;
-	inobj->in_link = f_inobj;
-	f_inobj = inobj;
+	inblock = inobj->in_block;
+
+	if (inblock != NULL)
+		inblock->used = inobj->in_used;
 
 	return 0;
 }
@@ -941,10 +1484,29 @@ char * GetNextLine(void)
 			fl->ifind = fl->ifcnt & 1;
 		}
 
-		readamt = read(fl->ifhandle, &fl->ifbuf[fl->ifind + fl->ifcnt], QUANTUM);
+		if (fl->ifhandle >= 0)
+			readamt = read(fl->ifhandle, &fl->ifbuf[fl->ifind + fl->ifcnt], QUANTUM);
+		else
+		{
+			readamt = (fl->ifmemleft < QUANTUM ? fl->ifmemleft : QUANTUM);
+			memcpy(&fl->ifbuf[fl->ifind + fl->ifcnt], fl->ifmem, readamt);
+			fl->ifmem += readamt;
+			fl->ifmemleft -= readamt;
+		}
 
 		if (readamt < 0)
+		{
+			if (fl->ifinput != NULL)
+			{
+				CacheDontStore();
+				fl->ifinput = NULL;
+			}
+
 			return NULL;
+		}
+
+		if (fl->ifinput != NULL)
+			SHA256Update(&fl->ifsha, &fl->ifbuf[fl->ifind + fl->ifcnt], readamt);
 
 		if ((fl->ifcnt += readamt) == 0)
 			return NULL;
@@ -952,6 +1514,78 @@ char * GetNextLine(void)
 }
 
 
+//
+// Look up the symbol from 'p' to 'ln' (of length 'j') as a register, then as a
+// keyword. Returns its token, or -1 if it's neither.
+//
+static int SymbolKeyword(uint8_t * p, uint8_t * ln, int j)
+{
+	int state = 0;
+
+	// If the symbol is small, check to see if it's really the name of
+	// a register.
+	uint8_t *p2 = p;
+	if (j <= 5)
+	{
+		for (state = 0; state >= 0;)
+		{
+			j = (int)tolowertab[*p++];
+			j += regbase[state];
+
+			if (regcheck[j] != state)
+			{
+				j = -1;
+				break;
+			}
+
+			if (*p == EOS || p == ln)
+			{
+				j = regaccept[j];
+				goto skip_keyword;
+				break;
+			}
+
+			state = regtab[j];
+		}
+	}
+
+	// Scan for keywords
+	if ((j <= 0 || state <= 0) || p==p2)
+	{
+		if (j <= KWSIZE)
+		{
+			for (state = 0; state >= 0;)
+			{
+				j = (int)tolowertab[*p2++];
+				j += kwbase[state];
+
+				if (kwcheck[j] != state)
+				{
+					j = -1;
+					break;
+				}
+
+				if (*p == EOS || p2 == ln)
+				{
+					j = kwaccept[j];
+					break;
+				}
+
+				state = kwtab[j];
+			}
+		}
+		else
+		{
+			j = -1;
+		}
+	}
+
+	skip_keyword:
+
+	return ((j < 0) || (state < 0) ? -1 : j);
+}
+
+
 //
 // Tokenize a line
 //
@@ -1043,7 +1677,28 @@ DEBUG { printf("TokenizeLine: Calling fpop() from SRC_IFILE...\n"); }
 		if (strlen(ln) > LNSIZ)
 			return error("line too long (%d, max %d)", strlen(ln), LNSIZ);
 
-		strcpy(lnbuf, ln);
+		// Macro arguments spliced in as tokens are written out as text, as
+		// the line may be listed or become part of a definition
+		char * s = (char *)ln, * d = lnbuf;
+
+		while (*s != EOS)
+		{
+			if (*s == ARGSPLICE && cur_inobj->in_type == SRC_IMACRO
+				&& s[1] >= 1 && s[1] <= cur_inobj->inobj.imacro->im_nargs)
+			{
+				TOKENSTREAM * arg = &cur_inobj->inobj.imacro->argument[s[1] - 1];
+				s += 2;
+
+				if ((d = ArgumentText(arg->token, arg->string, d, lnbuf + LNSIZ - 1)) == NULL)
+					return error("line too long as a result of macro expansion");
+			}
+			else if (d >= lnbuf + LNSIZ - 1)
+				return error("line too long as a result of macro expansion");
+			else
+				*d++ = *s++;
+		}
+
+		*d = EOS;
 	}
 
 	// General housekeeping
@@ -1089,6 +1744,74 @@ DEBUG { printf("TokenizeLine: Calling fpop() from SRC_IFILE...\n"); }
 		if (*ln == EOS || *ln == ';'|| ((*ln == '/') && (*(ln + 1) == '/')))
 			break;
 
+		// Macro argument left as tokens by ExpandMacro(): copy them in.
+		// Symbols are looked at again, as registers and .equr's may not be
+		// what they were when the macro was invoked.
+		if (*ln == ARGSPLICE && cur_inobj->in_type == SRC_IMACRO
+			&& ln[1] >= 1 && ln[1] <= cur_inobj->inobj.imacro->im_nargs)
+		{
+			TOKENSTREAM * arg = &cur_inobj->inobj.imacro->argument[ln[1] - 1];
+			ln += 2;
+
+			if (tk.cp + (TS_MAXTOKENS * sizeof(TOKEN)) >= ((uint8_t *)(&tokbuf[TOKBUFSIZE])) - 20)
+				return error("token buffer overrun");
+
+			for(TOKEN * t=arg->token; *t!=EOL;)
+			{
+				switch (*t)
+				{
+				case CONST:
+				case FCONST:
+				case ACONST:
+					*tk.u32++ = *t++;
+					*tk.u32++ = *t++;
+					*tk.u32++ = *t++;
+					break;
+				case STRING:
+				case STRINGA8:
+					*tk.u32++ = *t;
+					string[stringNum] = arg->string[t[1]];
+					*tk.u32++ = stringNum++;
+					t += 2;
+					break;
+				case SYMBOL:
+				{
+					char * name = arg->string[t[1]];
+					int len = strlen(name);
+					t += 2;
+					j = SymbolKeyword(name, name + len, len);
+
+					if (j == KW_EQURUNDEF)
+					{
+						equrundef = 1;
+						j = -1;
+					}
+
+					if (j < 0 && !equrundef && !disabled
+						&& (sy = lookup(name, LABEL, 0)) != NULL
+						&& (sy->sattre & EQUATEDREG))
+						j = sy->svalue;
+
+					if (j >= 0)
+						*tk.u32++ = (TOKEN)j;
+					else
+					{
+						*tk.u32++ = SYMBOL;
+						string[stringNum] = name;
+						*tk.u32++ = stringNum++;
+					}
+
+					break;
+				}
+				default:
+					*tk.u32++ = *t++;
+					break;
+				}
+			}
+
+			continue;
+		}
+
 		// Handle start of symbol. Symbols are null-terminated in place. The
 		// termination is always one symbol behind, since there may be no place
 		// for a null in the case that an operator immediately follows the name.
@@ -1149,65 +1872,7 @@ DEBUG { printf("TokenizeLine: Calling fpop() from SRC_IFILE...\n"); }
 					return error("misuse of '.'; not allowed in symbols");
 			}
 
-			// If the symbol is small, check to see if it's really the name of
-			// a register.
-			uint8_t *p2 = p;
-			if (j <= 5)
-			{
-				for (state = 0; state >= 0;)
-				{
-					j = (int)tolowertab[*p++];
-					j += regbase[state];
-
-					if (regcheck[j] != state)
-					{
-						j = -1;
-						break;
-					}
-
-					if (*p == EOS || p == ln)
-					{
-						j = regaccept[j];
-						goto skip_keyword;
-						break;
-					}
-
-					state = regtab[j];
-				}
-			}
-
-			// Scan for keywords
-			if ((j <= 0 || state <= 0) || p==p2)
-			{
-				if (j <= KWSIZE)
-				{
-					for (state = 0; state >= 0;)
-					{
-						j = (int)tolowertab[*p2++];
-						j += kwbase[state];
-			
-						if (kwcheck[j] != state)
-						{
-							j = -1;
-							break;
-						}
-			
-						if (*p == EOS || p2 == ln)
-						{
-							j = kwaccept[j];
-							break;
-						}
-			
-						state = kwtab[j];
-					}
-				}
-				else
-				{
-					j = -1;
-				}
-			}
-
-			skip_keyword:
+			j = SymbolKeyword(p, ln, j);
 
 			// If we detected equrundef/regundef set relevant flag
 			if (j == KW_EQURUNDEF)
@@ -1217,7 +1882,7 @@ DEBUG { printf("TokenizeLine: Calling fpop() from SRC_IFILE...\n"); }
 			}
 
 			// If not tokenized keyword OR token was not found
-			if ((j < 0) || (state < 0))
+			if (j < 0)
 			{
 				// Only proceed if no equrundef has been detected. In that case we need to store the symbol
 				// because the directive handler (d_equrundef) will run outside this loop, further into procln.c
@@ -10,6 +10,7 @@
 #define __TOKEN_H__
 
 #include "rmac.h"
+#include "cache.h"
 
 // Include Files and Macros
 #define SRC_IFILE       0			// Input source is IFILE
@@ -24,6 +25,7 @@
 #define IMACRO		struct _imacro
 #define IREPT		struct _irept
 #define IFENT		struct _ifent
+#define INBLOCK		struct _inblock
 
 // Tunable definitions
 #define LNSIZ           1024		// Maximum size of a line of text
@@ -67,6 +69,10 @@
 #define UNLT            0x81		// Unary '<' (low byte)
 #define UNGT            0x82		// Unary '>' (high byte)
 
+// In an expanded macro line, ARGSPLICE and (argument # + 1) stand for the
+// argument's tokens, which the tokenizer copies in as they are
+#define ARGSPLICE       0x01
+
 // ^^ operators
 #define CR_DEFINED      'p'			// ^^defined - is symbol defined?
 #define CR_REFERENCED   'q'			// ^^referenced - was symbol referenced?
@@ -113,40 +119,59 @@ INOBJ {
 	TOKEN * in_otok;		// Old `tok' value
 	TOKEN * in_etok;		// Old `etok' value
 	IUNION inobj;			// IFILE or IMACRO or IREPT
+	INBLOCK * in_block;		// Input stack block & use before this object
+	size_t in_used;
+};
+
+// Every file an assembly read, or looked for and didn't find
+#define INFILE struct _infile
+INFILE
+{
+	INFILE * next;
+	char * name;			// Name it was opened by
+	int found;				// 0, it wasn't there
+	char hash[HASHSIZE];	// Hash of what was read ("" if not known)
 };
 
 // Information about a file
 IFILE {
-	IFILE * if_link;		// Pointer to ancient IFILEs
 	char * ifoldfname;		// Old file's name
 	int ifoldlineno;		// Old line number
 	int ifind;				// Position in file buffer
 	int ifcnt;				// #chars left in file buffer
-	int ifhandle;			// File's descriptor
+	int ifhandle;			// File's descriptor (MEMHANDLE for memory sources)
+	const char * ifmem;		// Rest of an in-memory source
+	size_t ifmemleft;		// # bytes left in it
 	WORD ifno;				// File number
+	INFILE * ifinput;		// Its INFILE, when hashing for the output cache
+	SHA256 ifsha;			// Hash of what's been read so far
 	char ifbuf[LNBUFSIZ];	// Line buffer
 };
 
+// In-memory source files are opened as handles below -1
+#define MEMHANDLE		(-2)	// Handle of the first in-memory source
+
 // Consts for maximums in TOKENSTREAM
 #define TS_MAXTOKENS	64	// 32 ought to be enough for anybody (including XiA!)
 #define TS_MAXSTRINGS	32	// same for attached strings
 #define TS_MAXARGS		20	// Assume no more than 20 arguments in an invocation
 
+// A macro argument: tokens (EOL terminated) and their strings, allocated to fit
+// with the IMACRO
 TOKENSTREAM {
-	TOKEN token[TS_MAXTOKENS];
-	char * string[TS_MAXSTRINGS];
+	TOKEN * token;
+	char ** string;
 };
 
 // Information about a macro invocation
 IMACRO {
-	IMACRO * im_link;		// Pointer to ancient IMACROs
 	LLIST * im_nextln;		// Next line to include
 	WORD im_nargs;			// # of arguments supplied on invocation
 	WORD im_siz;			// Size suffix supplied on invocation
 	LONG im_olduniq;		// Old value of 'macuniq'
 	SYM * im_macro;			// Pointer to macro we're in
 	char im_lnbuf[LNSIZ];	// Line buffer
-	TOKENSTREAM argument[TS_MAXARGS];
+	TOKENSTREAM * argument;	// Arguments (im_nargs of them)
 };
 
 // Information about a .rept invocation
@@ -166,28 +191,42 @@ FILEREC
 };
 
 // Exported variables
-extern int lnsave;
-extern uint32_t curlineno;
-extern char * curfname;
-extern WORD cfileno;
-extern TOKEN * tok;
-extern char lnbuf[];
-extern char lntag;
-extern char tolowertab[];
-extern INOBJ * cur_inobj;
-extern int mjump_align;
-extern char * string[];
-extern int optimizeOff;
-extern FILEREC * filerec;
+extern ASMCTX int lnsave;
+extern ASMCTX uint32_t curlineno;
+extern ASMCTX char * curfname;
+extern ASMCTX WORD cfileno;
+extern ASMCTX TOKEN * tok;
+extern ASMCTX char lnbuf[];
+extern ASMCTX char lntag;
+extern ASMCTX char tolowertab[];
+extern ASMCTX INOBJ * cur_inobj;
+extern ASMCTX int mjump_align;
+extern ASMCTX char * string[];
+extern ASMCTX int optimizeOff;
+extern ASMCTX FILEREC * filerec;
+extern ASMCTX INFILE * infiles;
+extern ASMCTX int srccache_flag;
+extern ASMCTX int keepinputs_flag;
 
 // Exported functions
 int include(int, char *);
+int OpenSource(char *);
+int OpenInput(const char *);
+const uint8_t * MapInput(const char *, size_t *);
+INFILE * NoteInput(const char *, int);
+void AddMemorySource(const char *, const char *, size_t);
+void ClearMemorySources(void);
+void PruneSourceCache(void);
+void AbandonInput(void);
+void FreeInputs(void);
 void InitTokenizer(void);
+char * FileName(WORD);
 void SetFilenameForErrorReporting(void);
 int TokenizeLine(void);
 int fpop(void);
 int d_goto(WORD);
 INOBJ * a_inobj(int);
+void * AllocInput(size_t);
 void DumpToken(TOKEN);
 void DumpTokenBuffer(void);
 
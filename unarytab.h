@@ -0,0 +1,104 @@
+#ifdef DEF_UNARY
+/*
+ *  Keyword definitions
+ */
+#define	UNARY_ABSCOUNT	122
+#define	UNARY_DATE	121
+#define	UNARY_DEFINED	112
+#define	UNARY_FILESIZE	70
+#define	UNARY_MACDEF	119
+#define	UNARY_REFERENCED	113
+#define	UNARY_STREQ	118
+#define	UNARY_TIME	120
+#endif
+
+#ifdef DECL_UNARY
+/*
+ *  keyword state-machine tables
+ *
+ */
+
+int unarybase[44] = {
+ 0, 0, 2, 0, 4, 3, 1, 1,
+ 3, 3, 5, 0, 11, 9, 6, 3,
+ 14, 20, 17, 22, 24, 24, 25, 26,
+ 17, 19, 15, 30, 18, 20, 17, 34,
+ 31, 35, 37, 29, 40, 19, 32, 27,
+ 43, 46, 45, 47
+};
+
+int unarytab[175] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 1, 8, 9, 2, 12, 3, 10,
+ 13, 11, 15, 18, 19, 4, 20, 21,
+ 23, 24, 5, 6, 7, 14, 16, 17,
+ 22, -2, 25, 26, 27, 28, 29, -2,
+ 30, 31, 32, 33, 34, -2, 35, 36,
+ 37, -2, 38, 39, -2, 40, 41, -2,
+ -2, 42, 43, -2, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1
+};
+
+int unarycheck[175] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 0, 1, 2, 0, 4, 0, 2,
+ 5, 3, 7, 10, 11, 0, 12, 13,
+ 15, 16, 0, 0, 0, 6, 8, 9,
+ 14, 17, 18, 19, 20, 21, 22, 23,
+ 24, 25, 26, 27, 28, 29, 30, 31,
+ 32, 33, 34, 35, 36, 37, 38, 39,
+ 40, 41, 42, 43, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1
+};
+
+int unaryaccept[175] = {
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, 121, -1, -1, -1, -1, -1, 120,
+ -1, -1, -1, -1, -1, 118, -1, -1,
+ -1, 119, -1, -1, 112, -1, -1, 122,
+ 70, -1, -1, 113, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1, -1,
+ -1, -1, -1, -1, -1, -1, -1
+};
+#endif
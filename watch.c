@@ -0,0 +1,482 @@
+//
+// RMAC - Renamed Macro Assembler for all Atari computers
+// WATCH.C - Reassembling on File Changes
+// Copyright (C) 199x Landon Dyer, 2011-2022 Reboot and Friends
+// RMAC derived from MADMAC v1.07 Written by Landon Dyer, 1986
+// Source utilised with the kind permission of Landon Dyer
+//
+// "rmac --watch ..." does the assembly, then waits for one of the files it
+// read (or looked for and didn't find; see infiles) to change, and does it
+// again, until interrupted. The directories holding the files are watched
+// rather than the files themselves, as editors tend to save by writing a new
+// file and renaming it over the old one. Source files stay in memory between
+// assemblies (see srccache_flag), so only the changed ones are read again.
+//
+// The watches are kept while the next assembly is done, and the events that
+// came in meanwhile are looked at once it's over, so a file changed while it
+// was being assembled gets it done again. Files in directories that weren't
+// watched yet (the first time round, or a new .include directory) are checked
+// by their time stamps instead.
+//
+// With --snapshots as well, each assembly is done by another process, which
+// leaves snapshots of itself behind at the top level .includes (see
+// snapshot.c). The next assembly is picked up from the last one taken before
+// any of the files that changed were read, rather than done from the top.
+// Messages printed before that point aren't printed again.
+//
+
+#include "watch.h"
+#include "cache.h"
+#include "librmac.h"
+#include "snapshot.h"
+#include "token.h"
+
+#ifdef __linux__
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/inotify.h>
+#include <time.h>
+
+// A file being watched for
+#define WATCH struct _watch
+WATCH
+{
+	int wd;					// Watch on its directory
+	char * base;			// Its name in there
+	char * name;			// Its name as it was opened
+};
+
+// A snapshot left by an assembly
+#define SNAP struct _snap
+SNAP
+{
+	pid_t pid;				// Process waiting to go on
+	int nfiles;				// # of snapfiles[] it depends on
+};
+
+// A file a snapshot depends on
+#define SNAPFILE struct _snapfile
+SNAPFILE
+{
+	char * name;			// Its name as it was opened
+	char hash[HASHSIZE];	// Hash of its contents, or all '-' if not found
+};
+
+static SNAP snaps[WATCH_MAXSNAP];	// Snapshots, in the order taken
+static int nsnaps;					// # of snapshots
+static SNAPFILE * snapfiles;		// Files read by the assembly, in order
+static int nsnapfiles;				// # of snapfiles
+static int snapfilesize;			// # of snapfiles there's room for
+static INFILE * snapinfiles;		// All files the last assembly read
+
+//
+// Watch the directories of all of the files in 'list' on inotify instance
+// 'fd'. Returns the list of files (NULL-named at the end).
+//
+static WATCH * WatchInputs(int fd, INFILE * list)
+{
+	int n = 0;
+
+	for(INFILE * inf=list; inf!=NULL; inf=inf->next)
+		n++;
+
+	WATCH * watch = malloc((n + 1) * sizeof(WATCH));
+	n = 0;
+
+	for(INFILE * inf=list; inf!=NULL; inf=inf->next)
+	{
+		char * dir = strdup(inf->name);
+		char * slash = strrchr(dir, '/');
+
+		if (slash == dir)
+			slash[1] = EOS;
+		else if (slash != NULL)
+			*slash = EOS;
+		else
+			strcpy(dir, ".");
+
+		watch[n].wd = inotify_add_watch(fd, dir, IN_CLOSE_WRITE | IN_CREATE
+			| IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_ATTRIB);
+		watch[n].base = (slash != NULL ? strrchr(inf->name, '/') + 1 : inf->name);
+		watch[n].name = inf->name;
+		free(dir);
+
+		if (watch[n].wd >= 0)
+			n++;
+	}
+
+	watch[n].name = NULL;
+
+	return watch;
+}
+
+//
+// Read the events waiting on 'fd'; returns the name of the first watched
+// file that changed, or NULL
+//
+static char * ChangedFile(int fd, WATCH * watch)
+{
+	char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+	char * changed = NULL;
+	ssize_t size = read(fd, buf, sizeof(buf));
+
+	for(char * p=buf; p<buf+size; )
+	{
+		struct inotify_event * ev = (struct inotify_event *)p;
+
+		for(WATCH * w=watch; w->name!=NULL && changed==NULL; w++)
+		{
+			if (ev->wd == w->wd && ev->len > 0 && strcmp(ev->name, w->base) == 0)
+				changed = w->name;
+		}
+
+		p += sizeof(struct inotify_event) + ev->len;
+	}
+
+	return changed;
+}
+
+//
+// Stop watching the directories in 'old' that aren't in 'watch'
+//
+static void UnwatchOld(int fd, WATCH * old, WATCH * watch)
+{
+	for(WATCH * o=old; o!=NULL && o->name!=NULL; o++)
+	{
+		WATCH * w = watch;
+
+		while (w->name != NULL && w->wd != o->wd)
+			w++;
+
+		if (w->name == NULL)
+			inotify_rm_watch(fd, o->wd);
+	}
+}
+
+//
+// Returns the name of the first file in 'list' that came, went or was
+// modified between 'start' and 'end', or NULL. (Time stamps later than that
+// are left alone; they don't say when the file changed.)
+//
+static char * ChangedSince(INFILE * list, struct timespec * start, struct timespec * end)
+{
+	struct stat st;
+
+	for(INFILE * inf=list; inf!=NULL; inf=inf->next)
+	{
+		int found = (stat(inf->name, &st) == 0);
+
+		if (found != inf->found)
+			return inf->name;
+
+		if (found
+			&& (st.st_mtim.tv_sec > start->tv_sec || (st.st_mtim.tv_sec == start->tv_sec
+				&& st.st_mtim.tv_nsec >= start->tv_nsec))
+			&& (st.st_mtim.tv_sec < end->tv_sec || (st.st_mtim.tv_sec == end->tv_sec
+				&& st.st_mtim.tv_nsec <= end->tv_nsec)))
+			return inf->name;
+	}
+
+	return NULL;
+}
+
+//
+// Throw away the snapshots from 'first' on, and the files only they needed
+//
+static void DropSnapshots(int first)
+{
+	for(int i=first; i<nsnaps; i++)
+		kill(snaps[i].pid, SIGKILL);
+
+	nsnaps = first;
+	int n = (first > 0 ? snaps[first - 1].nfiles : 0);
+
+	while (nsnapfiles > n)
+		free(snapfiles[--nsnapfiles].name);
+}
+
+//
+// Deal with one line from an assembly. Returns 1 when it's done.
+//
+static int SnapshotReport(char * line, pid_t * running, int * errors, INFILE *** tail)
+{
+	char * arg = line + 2;
+
+	if (line[0] == EOS || line[1] != ' ')
+		return 0;
+
+	switch (line[0])
+	{
+	case 'F':
+		if (strlen(arg) <= HASHSIZE)
+			break;
+
+		if (nsnapfiles == snapfilesize)
+		{
+			snapfilesize = (snapfilesize ? snapfilesize * 2 : 64);
+			snapfiles = realloc(snapfiles, snapfilesize * sizeof(SNAPFILE));
+		}
+
+		memcpy(snapfiles[nsnapfiles].hash, arg, HASHSIZE - 1);
+		snapfiles[nsnapfiles].hash[HASHSIZE - 1] = EOS;
+		snapfiles[nsnapfiles++].name = strdup(arg + HASHSIZE);
+		break;
+	case 'S':
+		// No room for it: let it go
+		if (nsnaps == WATCH_MAXSNAP)
+		{
+			kill(atoi(arg), SIGKILL);
+			break;
+		}
+
+		snaps[nsnaps].pid = atoi(arg);
+		snaps[nsnaps++].nfiles = nsnapfiles;
+		break;
+	case 'R':
+		*running = atoi(arg);
+		break;
+	case 'W':
+		**tail = malloc(sizeof(INFILE));
+		(**tail)->name = strdup(arg + 2);
+		(**tail)->found = (*arg == '1');
+		(**tail)->next = NULL;
+		*tail = &(**tail)->next;
+		break;
+	case 'D':
+		*errors = atoi(arg);
+		return 1;
+	}
+
+	return 0;
+}
+
+//
+// Take in what the assembly running as process 'running' reports on 'fd'
+// until it's done; returns its error count
+//
+static int SnapshotWait(int fd, pid_t running)
+{
+	static char * buf;
+	static size_t bufsize;
+	size_t used = 0;
+	int errors = 1;
+	INFILE ** tail = &snapinfiles;
+
+	while (snapinfiles != NULL)
+	{
+		INFILE * next = snapinfiles->next;
+		free(snapinfiles->name);
+		free(snapinfiles);
+		snapinfiles = next;
+	}
+
+	for(;;)
+	{
+		struct pollfd pfd = { fd, POLLIN, 0 };
+
+		if (poll(&pfd, 1, 1000) <= 0)
+		{
+			// Nothing heard: make sure it's still going
+			if (kill(running, 0) != 0 && errno == ESRCH)
+			{
+				printf("--watch: assembly died\n");
+				DropSnapshots(0);
+				return 1;
+			}
+
+			continue;
+		}
+
+		if (used + 1 >= bufsize)
+		{
+			bufsize = (bufsize ? bufsize * 2 : 4096);
+			buf = realloc(buf, bufsize);
+		}
+
+		ssize_t n = read(fd, buf + used, bufsize - used - 1);
+
+		if (n <= 0)
+			continue;
+
+		used += n;
+		buf[used] = EOS;
+
+		// Deal with the complete lines, keeping the rest for later
+		char * line = buf, * nl;
+
+		while ((nl = strchr(line, '\n')) != NULL)
+		{
+			*nl = EOS;
+
+			if (SnapshotReport(line, &running, &errors, &tail))
+				return errors;
+
+			line = nl + 1;
+		}
+
+		used -= line - buf;
+		memmove(buf, line, used);
+	}
+}
+
+//
+// Do an assembly with snapshots, reported on pipe 'report': from the last
+// snapshot whose files are all as they were, or from the top. Returns the
+// number of errors.
+//
+static int SnapshotAssemble(int * report, int argc, char ** argv)
+{
+	char hash[HASHSIZE];
+	int checked = 0;
+	int resumed = -1;
+
+	// Hash the files in order, for as long as they haven't changed
+	while (checked < nsnapfiles)
+	{
+		if (HashFile(snapfiles[checked].name, hash) != OK)
+			memset(hash, '-', HASHSIZE - 1);
+
+		if (memcmp(hash, snapfiles[checked].hash, HASHSIZE - 1) != 0)
+			break;
+
+		checked++;
+	}
+
+	for(int i=nsnaps-1; i>=0 && resumed<0; i--)
+	{
+		if (snaps[i].nfiles <= checked && kill(snaps[i].pid, SIGUSR1) == 0)
+			resumed = i;
+	}
+
+	DropSnapshots(resumed + 1);
+
+	if (resumed >= 0)
+		return SnapshotWait(report[0], snaps[resumed].pid);
+
+	fflush(stdout);
+	pid_t self = getpid();
+	pid_t pid = fork();
+
+	if (pid == 0)
+	{
+		SnapshotStart(report[1], self);
+		SnapshotDone(RmacAssemble(argc, argv));
+		_exit(0);
+	}
+
+	if (pid < 0)
+	{
+		printf("--watch: %s\n", strerror(errno));
+		return 1;
+	}
+
+	return SnapshotWait(report[0], pid);
+}
+
+//
+// Whether --snapshots can be used with these options
+//
+static int WantSnapshots(int argc, char ** argv)
+{
+	int want = 0;
+
+	for(int i=0; i<argc; i++)
+	{
+		if (strcmp(argv[i], "--snapshots") == 0)
+			want = 1;
+		else if (strcmp(argv[i], "--relax") == 0
+			|| strncmp(argv[i], "--cache=", 8) == 0
+			|| strcmp(argv[i], "-") == 0)
+			return 0;
+	}
+
+	return want;
+}
+
+//
+// --watch: assemble, and again every time the files read change
+//
+int RunWatch(int argc, char ** argv)
+{
+	int report[2] = { -1, -1 };
+	int errors;
+	WATCH * watch = NULL;
+	struct timespec start, end;
+
+	srccache_flag = keepinputs_flag = 1;
+
+	// Set up before the first assembly, to be watching all along
+	int fd = inotify_init();
+
+	if (fd < 0)
+	{
+		printf("--watch: %s\n", strerror(errno));
+		return 1;
+	}
+
+	if (WantSnapshots(argc, argv))
+	{
+		if (pipe(report) != 0)
+			report[0] = -1;
+
+		// Nothing waits for the processes assembling
+		signal(SIGCHLD, SIG_IGN);
+	}
+
+	for(;;)
+	{
+		// (File time stamps are taken from the coarse clock)
+		clock_gettime(CLOCK_REALTIME_COARSE, &start);
+
+		if (report[0] >= 0)
+			errors = SnapshotAssemble(report, argc, argv);
+		else
+			errors = RmacAssemble(argc, argv);
+
+		fflush(stdout);
+		PruneSourceCache();
+
+		INFILE * inputs = (report[0] >= 0 ? snapinfiles : infiles);
+		WATCH * old = watch;
+		watch = WatchInputs(fd, inputs);
+		clock_gettime(CLOCK_REALTIME, &end);
+		UnwatchOld(fd, old, watch);
+		free(old);
+
+		// Did anything change while the assembly was being done?
+		char * changed = ChangedSince(inputs, &start, &end);
+		struct pollfd pfd = { fd, POLLIN, 0 };
+
+		while (poll(&pfd, 1, 0) > 0)
+		{
+			char * name = ChangedFile(fd, watch);
+
+			if (changed == NULL)
+				changed = name;
+		}
+
+		// If not, wait for a change; then for things to settle down
+		while (changed == NULL)
+		{
+			if (poll(&pfd, 1, -1) > 0)
+				changed = ChangedFile(fd, watch);
+		}
+
+		while (poll(&pfd, 1, WATCH_SETTLE) > 0)
+			ChangedFile(fd, watch);
+
+		printf("--watch: %s changed, assembling again\n", changed);
+	}
+}
+
+#else
+
+int RunWatch(int argc, char ** argv)
+{
+	printf("--watch: not available on this platform\n");
+	return 1;
+}
+
+#endif
+
@@ -0,0 +1,22 @@
+//
+// RMAC - Renamed Macro Assembler for all Atari computers
+// WATCH.H - Reassembling on File Changes
+// Copyright (C) 199x Landon Dyer, 2011-2022 Reboot and Friends
+// RMAC derived from MADMAC v1.07 Written by Landon Dyer, 1986
+// Source utilised with the kind permission of Landon Dyer
+//
+
+#ifndef __WATCH_H__
+#define __WATCH_H__
+
+#include "rmac.h"
+
+// Tunable definitions
+#define WATCH_SETTLE	100			// ms without changes before reassembling
+#define WATCH_MAXSNAP	256			// Most snapshots kept with --snapshots
+
+// Exported functions
+int RunWatch(int, char **);
+
+#endif // __WATCH_H__
+